@@ -137,6 +137,10 @@ function(pal_compile_definitions)
         endif()
     endif()
 
+    if (PAL_BUILD_GFXIP_SPECIALIZED_DRAWS)
+        target_compile_definitions(pal PRIVATE PAL_BUILD_GFXIP_SPECIALIZED_DRAWS=1)
+    endif()
+
 #if PAL_DEVELOPER_BUILD
     if(PAL_DEVELOPER_BUILD)
         target_compile_definitions(pal PUBLIC PAL_DEVELOPER_BUILD=1)
@@ -102,6 +102,8 @@ macro(pal_options)
 
     option(PAL_DISPLAY_DCC "Enable DISPLAY DCC?" ON)
 
+    option(PAL_BUILD_GFXIP_SPECIALIZED_DRAWS "Build draw-time validation specialized per GFXIP level?" OFF)
+
 #if PAL_DEVELOPER_BUILD
     option(PAL_DEVELOPER_BUILD "Enable developer build" OFF)
 
@@ -59,7 +59,17 @@ union CmdAllocatorCreateFlags
                                               ///  not returned to the allocator before the GPU has finished processing
                                               ///  them.  Failure to guarantee this will result in undefined behavior.
                                               ///  This flag has no effect if @ref autoMemoryReuse is not set.
+#if PAL_CLIENT_INTERFACE_MAJOR_VERSION >= 642
+        uint32 useHugePages             :  1; ///< If set, system-memory command chunks are backed by huge pages
+                                              ///  where the OS supports them, and are faulted in when they are
+                                              ///  allocated rather than when commands are first written to them.  This
+                                              ///  reduces TLB misses and page faults while recording large command
+                                              ///  buffers.  Clients which pass their own Util::VirtualLinearAllocator
+                                              ///  to ICmdBuffer::Begin() can request the same for it at construction.
+        uint32 reserved                 : 28; ///< Reserved for future use.
+#else
         uint32 reserved                 : 29; ///< Reserved for future use.
+#endif
     };
 
     uint32     u32All;          ///< Flags packed as 32-bit uint.
@@ -96,6 +106,18 @@ struct CmdAllocatorCreateInfo
     } allocInfo[CmdAllocatorTypeCount];   ///< Information for each allocation type.
 };
 
+#if PAL_CLIENT_INTERFACE_MAJOR_VERSION >= 642
+/// Statistics describing the memory owned by an ICmdAllocator.
+///
+/// @see ICmdAllocator::GetStats
+struct CmdAllocatorStats
+{
+    uint64 prefaultedPages; ///< Number of OS pages of system-memory command chunks which were faulted in when they were
+                            ///  allocated, because the allocator was created with the useHugePages flag.  Each one is
+                            ///  a page fault which command recording no longer takes.
+};
+#endif
+
 /**
  ***********************************************************************************************************************
  * @interface ICmdAllocator
@@ -125,6 +147,17 @@ public:
     ///          + ErrorUnknown if an internal PAL error occurs.
     virtual Result Reset() = 0;
 
+#if PAL_CLIENT_INTERFACE_MAJOR_VERSION >= 642
+    /// Reports statistics about the memory owned by this command allocator.
+    ///
+    /// @param [out] pStats Statistics about this allocator's memory.
+    ///
+    /// @returns Success if the statistics were written to pStats.  Otherwise, one of the following errors may be
+    ///          returned:
+    ///          + ErrorInvalidPointer if pStats is null.
+    virtual Result GetStats(CmdAllocatorStats* pStats) const = 0;
+#endif
+
     /// Returns the value of the associated arbitrary client data pointer.
     /// Can be used to associate arbitrary data with a particular PAL object.
     ///
@@ -497,12 +497,21 @@ union CmdBufferBuildFlags
         /// non-TMZ memory, the results are undefined. Only valid for graphics and compute.
         uint32  enableTmz                    :  1;
 
+#if PAL_CLIENT_INTERFACE_MAJOR_VERSION >= 642
+        /// Enables the lightweight CPU statistics which can be queried with ICmdBuffer::GetStats().  The counters are
+        /// cheap enough to be left on in production builds.
+        uint32 enableStats                   :  1;
+#endif
+
 #if PAL_CLIENT_INTERFACE_MAJOR_VERSION < 621
         /// Reserved for future use.
         uint32 reserved                      :  21;
-#else
+#elif PAL_CLIENT_INTERFACE_MAJOR_VERSION < 642
         /// Reserved for future use.
         uint32 reserved                      :  22;
+#else
+        /// Reserved for future use.
+        uint32 reserved                      :  21;
 #endif
 
     };
@@ -539,8 +548,44 @@ struct CmdBufferBuildInfo
 
     uint64 execMarkerClientHandle; ///< Client/app data handle. This can have an arbitrary value and is used to uniquely
                                    ///  identify this command buffer.
+#if PAL_CLIENT_INTERFACE_MAJOR_VERSION >= 642
+
+    /// Optional client-defined tag identifying the kind of command buffer being built, such as a hash of the
+    /// recording call site or render pass.  If non-zero, the command allocator remembers how many command and embedded
+    /// data chunks command buffers with this tag needed, and PAL obtains that many chunks up front when the next one
+    /// begins instead of pulling them one at a time during recording.  Zero disables the prediction.
+    uint32 usageTag;
+#endif
 };
 
+#if PAL_CLIENT_INTERFACE_MAJOR_VERSION >= 642
+/// CPU-side statistics describing how a command buffer was built.  Only available for command buffers begun with the
+/// enableStats build flag.  All counts cover the commands recorded since the last call to ICmdBuffer::Begin(),
+/// including any commands PAL recorded internally on the client's behalf.
+///
+/// @see ICmdBuffer::GetStats
+struct CmdBufferStats
+{
+    uint32 numDraws;               ///< Number of draws, including indirect draws and draws generated by PAL.
+    uint32 numDispatches;          ///< Number of dispatches, including indirect dispatches and internal dispatches.
+    uint32 numBarriers;            ///< Number of CmdBarrier(), CmdRelease(), CmdAcquire() and CmdReleaseThenAcquire()
+                                   ///  calls.
+    uint32 numCmdChunks;           ///< Number of command chunks allocated across all of the command streams.
+    uint64 cmdDataDwords;          ///< Number of DWORDs written to all of the command streams.
+    uint64 embeddedDataBytes;      ///< Number of bytes of embedded data allocated by the command buffer.
+    uint64 pm4OptKeptRegWrites;    ///< Number of register writes the PM4 optimizer had to keep.  Zero if the PM4
+                                   ///  optimizer was not enabled for this command buffer.
+    uint64 pm4OptSkippedRegWrites; ///< Number of redundant register writes the PM4 optimizer skipped.
+    uint32 numPrefetchedChunks;    ///< Number of command and embedded data chunks obtained at Begin() based on the
+                                   ///  chunk usage of earlier command buffers with the same
+                                   ///  @ref CmdBufferBuildInfo::usageTag.
+    uint32 numUnusedPrefetchedChunks; ///< Number of the prefetched chunks which recording has not needed (yet).
+    uint32 numOnDemandChunks;      ///< Number of command and embedded data chunks which had to be obtained from the
+                                   ///  command allocator during recording.  Together with the prefetch counts, this
+                                   ///  gives the hit rate of the chunk usage prediction.
+};
+#endif
+
 /// Specifies info on how a compute shader should use resources.
 struct DynamicComputeShaderInfo
 {
@@ -3815,6 +3860,19 @@ public:
     virtual uint32 GetUsedSize(
         CmdAllocType type) const = 0;
 
+#if PAL_CLIENT_INTERFACE_MAJOR_VERSION >= 642
+    /// Reports the CPU-side statistics gathered while building this command buffer.  It's legal to call this function
+    /// while in the command building state, in which case the statistics reflect the commands recorded so far.
+    ///
+    /// @param [out] pStats  Filled with the command buffer's statistics.
+    ///
+    /// @returns Success if the statistics were reported.  Otherwise, one of the following errors may be returned:
+    ///          + ErrorInvalidPointer if pStats is null.
+    ///          + ErrorUnavailable if the command buffer was not begun with the enableStats build flag.
+    virtual Result GetStats(
+        CmdBufferStats* pStats) const = 0;
+#endif
+
     /// Returns the value of the associated arbitrary client data pointer.
     /// Can be used to associate arbitrary data with a particular PAL object.
     ///
@@ -0,0 +1,320 @@
+/*
+ ***********************************************************************************************************************
+ *
+ *  Copyright (c) 2020 Advanced Micro Devices, Inc. All Rights Reserved.
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy
+ *  of this software and associated documentation files (the "Software"), to deal
+ *  in the Software without restriction, including without limitation the rights
+ *  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *  copies of the Software, and to permit persons to whom the Software is
+ *  furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in all
+ *  copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ *  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *  SOFTWARE.
+ *
+ **********************************************************************************************************************/
+/**
+ ***********************************************************************************************************************
+ * @file  palCmdTokenStream.h
+ * @brief Defines the Platform Abstraction Library (PAL) ICmdTokenStream interface and related types.
+ ***********************************************************************************************************************
+ */
+
+#pragma once
+
+#include "pal.h"
+#include "palCmdBuffer.h"
+#include "palDestroyable.h"
+
+#if PAL_CLIENT_INTERFACE_MAJOR_VERSION >= 642
+namespace Pal
+{
+
+/// Specifies properties for creation of an ICmdTokenStream object.  Input structure to IDevice::CreateCmdTokenStream().
+struct CmdTokenStreamCreateInfo
+{
+    size_t initialSize;  ///< Initial size, in bytes, of the token storage.  The storage doubles in size whenever a
+                         ///  recording runs out of space.  Zero selects a PAL-defined default.
+};
+
+/**
+ ***********************************************************************************************************************
+ * @interface ICmdTokenStream
+ * @brief     A recording of command buffer calls which can be replayed into any number of command buffers.
+ *
+ * The recording is captured once between Begin() and End() and only stores the call arguments, so recording is cheap
+ * and no PAL validation is done until the stream is replayed.  Each call to Replay() issues the recorded calls, in
+ * order, on the given command buffer, which must be in the building state.  Replay() does not modify the stream, so
+ * several threads may replay the same stream into different command buffers at once.  The stream must not be
+ * recorded while it is being replayed.
+ *
+ * Replay() goes through the public ICmdBuffer methods, so every replay pays the same state validation and PM4
+ * generation cost as issuing the calls directly.  The stream saves the client from re-walking its own state to rebuild
+ * the calls, but it does not cache generated PM4.  Only the calls exposed by this interface can be recorded; a call
+ * whose arguments can't be stored safely, or a call made outside Begin() and End(), causes End() or Replay() to fail
+ * so that the stream is never replayed with a command missing.
+ *
+ * Values which change between replays are recorded as patch slots instead of values.  Each replay supplies an array of
+ * 64-bit patch values which is indexed by patch slot.  User data entries use the low 32 bits of their patch value;
+ * GPU addresses use all 64 bits.
+ *
+ * Objects referenced by the recording (pipelines, state objects and GPU memory) must remain valid until the last
+ * command buffer containing a replay of the stream has finished executing.
+ *
+ * @see IDevice::CreateCmdTokenStream()
+ ***********************************************************************************************************************
+ */
+class ICmdTokenStream : public IDestroyable
+{
+public:
+    /// Discards any previous recording and starts a new one.
+    ///
+    /// @returns Success if recording started, or ErrorOutOfMemory if the token storage could not be allocated.
+    virtual Result Begin() = 0;
+
+    /// Finishes the current recording.  The stream can be replayed after this call succeeds.
+    ///
+    /// @returns Success if every recorded call was stored.  Otherwise, the stream can't be replayed until it is
+    ///          recorded again and one of the following errors is returned:
+    ///          + ErrorOutOfMemory if the token storage ran out of memory during the recording.
+    ///          + ErrorInvalidValue if a call had arguments which the stream can't store, see the call's documentation.
+    ///          + ErrorUnavailable if a call was made while the stream was not being recorded.
+    virtual Result End() = 0;
+
+    /// Records a call to ICmdBuffer::CmdBindPipeline().
+    ///
+    /// @param [in] params  Parameters necessary to bind a new pipeline.
+    virtual void CmdBindPipeline(
+        const PipelineBindParams& params) = 0;
+
+    /// Records a call to ICmdBuffer::CmdBindMsaaState().
+    ///
+    /// @param [in] pMsaaState  New MSAA state to be bound, or null.
+    virtual void CmdBindMsaaState(
+        const IMsaaState* pMsaaState) = 0;
+
+    /// Records a call to ICmdBuffer::CmdBindColorBlendState().
+    ///
+    /// @param [in] pColorBlendState  New color blend state to be bound, or null.
+    virtual void CmdBindColorBlendState(
+        const IColorBlendState* pColorBlendState) = 0;
+
+    /// Records a call to ICmdBuffer::CmdBindDepthStencilState().
+    ///
+    /// @param [in] pDepthStencilState  New depth/stencil state to be bound, or null.
+    virtual void CmdBindDepthStencilState(
+        const IDepthStencilState* pDepthStencilState) = 0;
+
+    /// Records a call to ICmdBuffer::CmdSetViewports().
+    ///
+    /// @param [in] params  Parameters for setting the specified number of viewports.
+    virtual void CmdSetViewports(
+        const ViewportParams& params) = 0;
+
+    /// Records a call to ICmdBuffer::CmdSetScissorRects().
+    ///
+    /// @param [in] params  Parameters for setting the specified number of scissor regions.
+    virtual void CmdSetScissorRects(
+        const ScissorRectParams& params) = 0;
+
+    /// Records a call to ICmdBuffer::CmdBindTargets().
+    ///
+    /// @param [in] params  Specifies which targets to bind.
+    virtual void CmdBindTargets(
+        const BindTargetParams& params) = 0;
+
+    /// Records a call to ICmdBuffer::CmdSetVertexBuffers().  The buffer views are copied into the stream.
+    ///
+    /// @param [in] firstBuffer  First vertex buffer slot to update.
+    /// @param [in] bufferCount  Number of vertex buffer slots to update; size of the pBuffers array.
+    /// @param [in] pBuffers     Array of buffer views describing the vertex buffers.
+    virtual void CmdSetVertexBuffers(
+        uint32                firstBuffer,
+        uint32                bufferCount,
+        const BufferViewInfo* pBuffers) = 0;
+
+    /// Records a call to ICmdBuffer::CmdBarrier().  The pipe point, GPU event, target and transition arrays are copied
+    /// into the stream.  Transitions with a custom sample pattern (non-null imageInfo.pQuadSamplePattern) can't be
+    /// recorded and make End() return ErrorInvalidValue.
+    ///
+    /// @param [in] barrierInfo  Describes the barrier.
+    virtual void CmdBarrier(
+        const BarrierInfo& barrierInfo) = 0;
+
+    /// Records a call to ICmdBuffer::CmdSetUserData() with values that are the same for every replay.
+    ///
+    /// @param [in] bindPoint     Specifies which type of user data is being set (graphics or compute).
+    /// @param [in] firstEntry    First user data entry to be updated.
+    /// @param [in] entryCount    Number of user data entries to update; size of the pEntryValues array.
+    /// @param [in] pEntryValues  Array of 32-bit values to be copied into the stream.
+    virtual void CmdSetUserData(
+        PipelineBindPoint bindPoint,
+        uint32            firstEntry,
+        uint32            entryCount,
+        const uint32*     pEntryValues) = 0;
+
+    /// Records a call to ICmdBuffer::CmdSetUserData() whose values are supplied by each replay.  User data entry
+    /// (firstEntry + i) is set to the low 32 bits of patch slot (firstPatchSlot + i).
+    ///
+    /// @param [in] bindPoint       Specifies which type of user data is being set (graphics or compute).
+    /// @param [in] firstEntry      First user data entry to be updated.
+    /// @param [in] entryCount      Number of user data entries to update.
+    /// @param [in] firstPatchSlot  Patch slot providing the value of the first entry.
+    virtual void CmdSetPatchedUserData(
+        PipelineBindPoint bindPoint,
+        uint32            firstEntry,
+        uint32            entryCount,
+        uint32            firstPatchSlot) = 0;
+
+    /// Records a call to ICmdBuffer::CmdSetUserData() which writes a GPU address supplied by each replay into two
+    /// consecutive user data entries: the low 32 bits to firstEntry and the high 32 bits to (firstEntry + 1).
+    ///
+    /// @param [in] bindPoint   Specifies which type of user data is being set (graphics or compute).
+    /// @param [in] firstEntry  User data entry which receives the low 32 bits of the address.
+    /// @param [in] patchSlot   Patch slot providing the GPU address.
+    virtual void CmdSetPatchedGpuAddress(
+        PipelineBindPoint bindPoint,
+        uint32            firstEntry,
+        uint32            patchSlot) = 0;
+
+    /// Records a call to ICmdBuffer::CmdBindIndexData().
+    ///
+    /// @param [in] gpuAddr     GPU virtual address of the index data.
+    /// @param [in] indexCount  Number of indices in the buffer.
+    /// @param [in] indexType   Specifies the size of each index (8-, 16- or 32-bit).
+    virtual void CmdBindIndexData(
+        gpusize   gpuAddr,
+        uint32    indexCount,
+        IndexType indexType) = 0;
+
+    /// Records a call to ICmdBuffer::CmdBindIndexData() whose index data address is supplied by each replay.
+    ///
+    /// @param [in] patchSlot   Patch slot providing the GPU virtual address of the index data.
+    /// @param [in] indexCount  Number of indices in the buffer.
+    /// @param [in] indexType   Specifies the size of each index (8-, 16- or 32-bit).
+    virtual void CmdBindPatchedIndexData(
+        uint32    patchSlot,
+        uint32    indexCount,
+        IndexType indexType) = 0;
+
+    /// Records a call to ICmdBuffer::CmdDraw().
+    ///
+    /// @param [in] firstVertex    Starting index value for the draw.
+    /// @param [in] vertexCount    Number of vertices to draw.
+    /// @param [in] firstInstance  Starting instance for the draw.
+    /// @param [in] instanceCount  Number of instances to draw.
+    /// @param [in] drawId         Draw index for the draw.
+    virtual void CmdDraw(
+        uint32 firstVertex,
+        uint32 vertexCount,
+        uint32 firstInstance,
+        uint32 instanceCount,
+        uint32 drawId) = 0;
+
+    /// Records a call to ICmdBuffer::CmdDrawIndexed().
+    ///
+    /// @param [in] firstIndex     Starting index buffer slot for the draw.
+    /// @param [in] indexCount     Number of vertices to draw.
+    /// @param [in] vertexOffset   Offset added to the index fetched from the index buffer.
+    /// @param [in] firstInstance  Starting instance for the draw.
+    /// @param [in] instanceCount  Number of instances to draw.
+    /// @param [in] drawId         Draw index for the draw.
+    virtual void CmdDrawIndexed(
+        uint32 firstIndex,
+        uint32 indexCount,
+        int32  vertexOffset,
+        uint32 firstInstance,
+        uint32 instanceCount,
+        uint32 drawId) = 0;
+
+    /// Records a call to ICmdBuffer::CmdDrawIndirectMulti().
+    ///
+    /// @param [in] gpuMemory     GPU memory object where the indirect argument data is located.
+    /// @param [in] offset        Offset in bytes into gpuMemory where the indirect argument data is located.
+    /// @param [in] stride        Stride in memory from one data structure to the next.
+    /// @param [in] maximumCount  Maximum count of data structures to loop through.
+    /// @param [in] countGpuAddr  GPU virtual address where the number of draws is stored, or zero.
+    virtual void CmdDrawIndirectMulti(
+        const IGpuMemory& gpuMemory,
+        gpusize           offset,
+        uint32            stride,
+        uint32            maximumCount,
+        gpusize           countGpuAddr) = 0;
+
+    /// Records a call to ICmdBuffer::CmdDrawIndexedIndirectMulti().
+    ///
+    /// @param [in] gpuMemory     GPU memory object where the indirect argument data is located.
+    /// @param [in] offset        Offset in bytes into gpuMemory where the indirect argument data is located.
+    /// @param [in] stride        Stride in memory from one data structure to the next.
+    /// @param [in] maximumCount  Maximum count of data structures to loop through.
+    /// @param [in] countGpuAddr  GPU virtual address where the number of draws is stored, or zero.
+    virtual void CmdDrawIndexedIndirectMulti(
+        const IGpuMemory& gpuMemory,
+        gpusize           offset,
+        uint32            stride,
+        uint32            maximumCount,
+        gpusize           countGpuAddr) = 0;
+
+    /// Records a call to ICmdBuffer::CmdDispatchIndirect().
+    ///
+    /// @param [in] gpuMemory  GPU memory object where the dispatch arguments are located.
+    /// @param [in] offset     Offset in bytes into the GPU memory object where the dispatch arguments are located.
+    virtual void CmdDispatchIndirect(
+        const IGpuMemory& gpuMemory,
+        gpusize           offset) = 0;
+
+    /// Records a call to ICmdBuffer::CmdDispatch().
+    ///
+    /// @param [in] x  Thread groups to dispatch in the X dimension.
+    /// @param [in] y  Thread groups to dispatch in the Y dimension.
+    /// @param [in] z  Thread groups to dispatch in the Z dimension.
+    virtual void CmdDispatch(
+        uint32 x,
+        uint32 y,
+        uint32 z) = 0;
+
+    /// Returns the number of patch values each replay must supply: one more than the highest patch slot referenced by
+    /// the current recording.
+    virtual uint32 GetPatchSlotCount() const = 0;
+
+    /// Issues the recorded calls on the given command buffer.
+    ///
+    /// @param [in] pCmdBuffer       Command buffer to replay into.  It must be in the building state.
+    /// @param [in] patchValueCount  Number of entries in pPatchValues.  Must be at least GetPatchSlotCount().
+    /// @param [in] pPatchValues     Values of the patch slots for this replay.  May be null if the recording has no
+    ///                              patch slots.
+    ///
+    /// @returns Success if the stream was replayed.  ErrorUnknown if the token storage is corrupt, in which case the
+    ///          replay stops at the corrupt token.  Otherwise, nothing is replayed and one of the following errors is
+    ///          returned:
+    ///          + ErrorInvalidPointer if pCmdBuffer is null, or if pPatchValues is null and patches are required.
+    ///          + ErrorInvalidValue if patchValueCount is less than GetPatchSlotCount().
+    ///          + ErrorUnavailable if the stream is being recorded, has no successful recording, or a call was made on
+    ///            it since its last recording ended.
+    virtual Result Replay(
+        ICmdBuffer*   pCmdBuffer,
+        uint32        patchValueCount,
+        const uint64* pPatchValues) const = 0;
+
+protected:
+    /// @internal Constructor. Prevent use of new operator on this interface. Client must create objects by explicitly
+    /// called the proper create method.
+    ICmdTokenStream() { }
+
+    /// @internal Destructor.  Prevent use of delete operator on this interface.  Client must destroy objects by
+    /// explicitly calling IDestroyable::Destroy() and is responsible for freeing the system memory allocated for the
+    /// object on their own.
+    virtual ~ICmdTokenStream() { }
+};
+
+} // Pal
+#endif
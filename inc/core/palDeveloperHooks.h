@@ -447,6 +447,11 @@ struct OptimizedRegistersData
     const uint32* pCtxRegSeenSets;
     ///< Array containing the number of times the PM4 optimizer kept a SET or RMW packet which modified each register
     const uint32* pCtxRegKeptSets;
+#if PAL_CLIENT_INTERFACE_MAJOR_VERSION >= 642
+    /// Array containing the number of times each register was the first non-redundant context register write since the
+    /// previous draw, making it the cause of that draw's context roll
+    const uint32* pCtxRegRollCauses;
+#endif
     uint32        ctxRegCount;      ///< Number of context registers
     uint16        ctxRegBase;       ///< Base address of context registers
 };
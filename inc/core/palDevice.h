@@ -47,6 +47,7 @@ namespace Pal
 class  IBorderColorPalette;
 class  ICmdAllocator;
 class  ICmdBuffer;
+class  ICmdTokenStream;
 class  IColorBlendState;
 class  IColorTargetView;
 class  IDepthStencilState;
@@ -69,6 +70,7 @@ class  ISwapChain;
 struct BorderColorPaletteCreateInfo;
 struct CmdAllocatorCreateInfo;
 struct CmdBufferCreateInfo;
+struct CmdTokenStreamCreateInfo;
 struct ColorBlendStateCreateInfo;
 struct ColorTargetViewCreateInfo;
 struct ComputePipelineCreateInfo;
@@ -4315,6 +4317,39 @@ public:
         void*                                 pPlacementAddr,
         IIndirectCmdGenerator**               ppGenerator) const = 0;
 
+#if PAL_CLIENT_INTERFACE_MAJOR_VERSION >= 642
+    /// Determines the amount of system memory required for a command token stream object.  An allocation of this
+    /// amount of memory must be provided in the pPlacementAddr parameter of CreateCmdTokenStream().
+    ///
+    /// @param [in]  createInfo Command token stream properties.
+    /// @param [out] pResult    The validation result if pResult is non-null.  This argument can be null to avoid the
+    ///                         additional validation.
+    ///
+    /// @returns Size, in bytes, of system memory required for an ICmdTokenStream object with the specified
+    ///          properties.  A return value of 0 indicates the createInfo was invalid.
+    virtual size_t GetCmdTokenStreamSize(
+        const CmdTokenStreamCreateInfo& createInfo,
+        Result*                         pResult) const = 0;
+
+    /// Creates a command token stream object which records command buffer calls once and replays them into any number
+    /// of command buffers.  The stream is independent of any particular command buffer or queue type.
+    ///
+    /// @param [in]  createInfo     Command token stream properties.
+    /// @param [in]  pPlacementAddr Pointer to the location where PAL should construct this object.  There must be as
+    ///                             much size available here as reported by calling GetCmdTokenStreamSize() with the
+    ///                             same createInfo param.
+    /// @param [out] ppTokenStream  Constructed command token stream object.  When successful, the returned address
+    ///                             will be the same as specified in pPlacementAddr.
+    ///
+    /// @returns Success if the command token stream was successfully created.  Otherwise, one of the following errors
+    ///          may be returned:
+    ///          + ErrorInvalidPointer if pPlacementAddr or ppTokenStream is null.
+    virtual Result CreateCmdTokenStream(
+        const CmdTokenStreamCreateInfo& createInfo,
+        void*                           pPlacementAddr,
+        ICmdTokenStream**               ppTokenStream) = 0;
+#endif
+
     /// Determines the amount of system memory required for a perf experiment object.  An allocation of this amount of
     /// memory must be provided in the pPlacementAddr parameter of CreatePerfExperiment().
     ///
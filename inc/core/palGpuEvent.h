@@ -44,11 +44,19 @@ struct GpuEventCreateInfo
     {
         struct
         {
-            uint32 gpuAccessOnly :  1; ///< If true, GetStatus(), Set(), and Reset() must never be called.
-            uint32 reserved      : 31; ///< Reserved for future use.
+            uint32 gpuAccessOnly   :  1; ///< If true, GetStatus(), Set(), and Reset() must never be called.
+#if PAL_CLIENT_INTERFACE_MAJOR_VERSION >= 642
+            uint32 internalMemBind :  1; ///< If true, PAL sub-allocates the event's GPU memory from a device-owned
+                                         ///  pool and binds it during creation.  The client must not call
+                                         ///  BindGpuMemory() or make the memory resident.  Many events share each
+                                         ///  pool allocation, which keeps creation cheap and the residency list short.
+            uint32 reserved        : 30; ///< Reserved for future use.
+#else
+            uint32 reserved        : 31; ///< Reserved for future use.
+#endif
         };
-        uint32 u32All;                 ///< Flags packed as 32-bit uint.
-    } flags;                           ///< GPU event property flags.
+        uint32 u32All;                   ///< Flags packed as 32-bit uint.
+    } flags;                             ///< GPU event property flags.
 };
 
 /**
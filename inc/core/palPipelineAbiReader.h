@@ -59,11 +59,13 @@ typedef HashMap<const char*,
                 StringJenkinsHashFunc,
                 StringEqualFunc,
                 HashAllocator<IndirectAllocator>,
-                PAL_CACHE_LINE_BYTES * 2> GenericSymbolMap;
+                PAL_CACHE_LINE_BYTES * 2> SymbolMap;
 
 public:
     template <typename Allocator>
     PipelineAbiReader(Allocator* const pAllocator, const void* pData);
+    ~PipelineAbiReader();
+
     Result Init();
 
     ElfReader::Reader& GetElfReader() { return m_elfReader; }
@@ -102,15 +104,22 @@ public:
     const Elf::SymbolTableEntry* GetGenericSymbol(const char* pName) const;
 
 private:
+    static uint32 CountSymbols(const ElfReader::Reader& elfReader);
+
     IndirectAllocator m_allocator;
     ElfReader::Reader m_elfReader;
 
-    /// The symbols, cached for lookup.
+    /// The pipeline ABI symbols, cached for lookup.
     ///
     /// If the section index of the symbol is 0, it does not exist.
     SymbolEntry m_pipelineSymbols[static_cast<uint32>(PipelineSymbolType::Count)];
 
-    GenericSymbolMap m_genericSymbolsMap;
+    /// Index of every defined symbol by name, built once in Init() after the ELF header has been validated.
+    /// Relocations, pipeline and library uploads all resolve symbols through it instead of walking the ELF symbol
+    /// tables.
+    SymbolMap* m_pSymbolsMap;
+
+    PAL_DISALLOW_COPY_AND_ASSIGN(PipelineAbiReader);
 };
 
 // =====================================================================================================================
@@ -119,7 +128,7 @@ PipelineAbiReader::PipelineAbiReader(Allocator* const pAllocator, const void* pD
     :
     m_allocator(pAllocator),
     m_elfReader(pData),
-    m_genericSymbolsMap(16u, &m_allocator)
+    m_pSymbolsMap(nullptr)
 {
     PAL_ASSERT(pAllocator);
 
@@ -94,7 +94,15 @@ struct QueryPoolCreateInfo
             /// buffers to perform these operations (using @ref ICmdBuffer::CmdResetQueryPool and
             /// @ref ICmdBuffer::CmdResolveQuery).
             uint32  enableCpuAccess :  1;
+#if PAL_CLIENT_INTERFACE_MAJOR_VERSION >= 642
+            /// If true, PAL sub-allocates the pool's GPU memory from a device-owned pool and binds it during creation.
+            /// The client must not call @ref IGpuMemoryBindable::BindGpuMemory or make the memory resident.  This is
+            /// intended for small query pools, where a dedicated allocation per pool would be wasteful.
+            uint32  internalMemBind :  1;
+            uint32  reserved        : 30;   ///< Reserved for future use.
+#else
             uint32  reserved        : 31;   ///< Reserved for future use.
+#endif
         };
         uint32  u32All; ///< Flags packed together as a uint32.
     } flags;            ///< Flags controlling QueryPool behavior.
@@ -394,10 +394,24 @@ struct PresentSwapChainInfo
         struct
         {
             uint32 notifyOnly           :  1;   ///< True if it is a notify-only present
+#if PAL_CLIENT_INTERFACE_MAJOR_VERSION >= 642
+            uint32 paced                :  1;   ///< The present is held back until targetPresentTime and until
+                                                ///  presentInterval has passed since the previous paced present.
+                                                ///  Paced presents are never executed inline on the client's queue.
+            uint32 reserved             : 30;   ///< Reserved for future use.
+#else
             uint32 reserved             : 31;   ///< Reserved for future use.
+#endif
         };
         uint32 u32All;                          ///< Flags packed as 32-bit uint.
     } flags;                                    ///< PresentSwapChainInfo flags.
+#if PAL_CLIENT_INTERFACE_MAJOR_VERSION >= 642
+    uint64      targetPresentTime;  ///< If flags.paced is set, the earliest time the present may be queued to the OS,
+                                    ///  in Util::GetPerfCpuTime() ticks.  Zero means no absolute target.
+    uint64      presentInterval;    ///< If flags.paced is set, the minimum number of Util::GetPerfCpuTime() ticks
+                                    ///  between queuing the previous paced present and this one.  Zero means no
+                                    ///  minimum interval.
+#endif
 #if PAL_AMDGPU_BUILD && (PAL_CLIENT_INTERFACE_MAJOR_VERSION >= 582)
     MscInfo mscInfo;                            ///< Media stream counter information
 #endif
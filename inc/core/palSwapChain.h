@@ -197,6 +197,50 @@ struct AcquireNextImageInfo
     IFence*          pFence;     ///< If non-null, signal this fence when it is safe to render into the image.
 };
 
+/// Timing of a single present executed by a swap chain.  All times are in Util::GetPerfCpuTime() ticks.
+///
+/// @see ISwapChain::GetPresentTimings
+struct PresentTimingRecord
+{
+    uint64 presentId;      ///< Sequence number of the present, counting from one over the swap chain's lifetime.
+    uint32 imageIndex;     ///< Index of the presented swap chain image.
+    union
+    {
+        struct
+        {
+            uint32 inlined  :  1; ///< The present was queued directly on the client's queue.
+            uint32 paced    :  1; ///< The present was paced with PresentSwapChainInfo::flags::paced.
+            uint32 dropped  :  1; ///< PAL failed to queue the present to the OS; completedTime is when it gave up.
+            uint32 reserved : 29; ///< Reserved for future use.
+        };
+        uint32 u32All;            ///< Flags packed as 32-bit uint.
+    } flags;                      ///< PresentTimingRecord flags.
+    uint64 requestedTime;  ///< When the client requested the present.
+    uint64 targetTime;     ///< When a paced present was scheduled to be queued.  Zero if the present wasn't paced.
+    uint64 dequeuedTime;   ///< When PAL began processing the present.  Equals requestedTime for inlined presents.
+    uint64 submittedTime;  ///< When PAL began queuing the present to the OS, after any pacing delay.
+    uint64 completedTime;  ///< When the OS accepted the present.  This is not necessarily when the image was flipped.
+};
+
+/// Number of buckets in PresentTimingStats::latencyHistogram.
+constexpr uint32 PresentLatencyHistogramBuckets = 24;
+
+/// Aggregate present timing statistics of a swap chain, accumulated over its whole lifetime.
+///
+/// @see ISwapChain::GetPresentTimings
+struct PresentTimingStats
+{
+    uint64 numPresents;   ///< Number of presents the swap chain has processed, including dropped ones.
+    uint64 numPaced;      ///< Number of those presents which were paced.
+    uint64 numDropped;    ///< Number of those presents which PAL failed to queue to the OS.
+    uint64 numOverflowed; ///< Number of timing records which were overwritten before the client retrieved them.
+
+    /// Histogram of the latency from requestedTime to completedTime of all non-dropped presents.  Bucket i counts the
+    /// presents whose latency in microseconds was in [2^i, 2^(i+1)), except that bucket zero also counts latencies
+    /// below one microsecond and the last bucket also counts all longer latencies.
+    uint64 latencyHistogram[PresentLatencyHistogramBuckets];
+};
+
 /**
  ***********************************************************************************************************************
  * @interface ISwapChain
@@ -247,6 +291,27 @@ public:
     /// @returns True if window size is possibly changed.
     virtual bool NeedWindowSizeChangedCheck() const = 0;
 
+#if PAL_CLIENT_INTERFACE_MAJOR_VERSION >= 642
+    /// Retrieves the timing records of the swap chain's most recent presents, oldest first.  Each record is returned
+    /// exactly once; the swap chain keeps at most MaxPresentTimingRecords records which have not been retrieved yet and
+    /// overwrites the oldest ones beyond that.
+    ///
+    /// @param [in,out] pNumRecords  Input: the capacity of pRecords.  Output: the number of records written.  If
+    ///                              pRecords is null, the number of records available is returned instead.
+    /// @param [out]    pRecords     Optional array of at least *pNumRecords records.
+    /// @param [out]    pStats       Optional.  Filled with the lifetime statistics of the swap chain.
+    ///
+    /// @returns Success if the records were retrieved.  Otherwise, one of the following errors may be returned:
+    ///          + ErrorInvalidPointer if pNumRecords is null.
+    virtual Result GetPresentTimings(
+        uint32*              pNumRecords,
+        PresentTimingRecord* pRecords,
+        PresentTimingStats*  pStats) = 0;
+#endif
+
+    /// Maximum number of timing records a swap chain keeps for GetPresentTimings().
+    static constexpr uint32 MaxPresentTimingRecords = 64;
+
     /// Returns the value of the associated arbitrary client data pointer.
     /// Can be used to associate arbitrary data with a particular PAL object.
     ///
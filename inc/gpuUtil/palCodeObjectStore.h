@@ -0,0 +1,142 @@
+/*
+ ***********************************************************************************************************************
+ *
+ *  Copyright (c) 2020 Advanced Micro Devices, Inc. All Rights Reserved.
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy
+ *  of this software and associated documentation files (the "Software"), to deal
+ *  in the Software without restriction, including without limitation the rights
+ *  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *  copies of the Software, and to permit persons to whom the Software is
+ *  furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in all
+ *  copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ *  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *  SOFTWARE.
+ *
+ **********************************************************************************************************************/
+/**
+ ***********************************************************************************************************************
+ * @file  palCodeObjectStore.h
+ * @brief PAL GPU utility CodeObjectStore class.
+ ***********************************************************************************************************************
+ */
+
+#pragma once
+
+#include "palHashMap.h"
+#include "palMutex.h"
+#include "palPipeline.h"
+#include "palPlatform.h"
+
+namespace GpuUtil
+{
+
+/// Memory accounting of a @ref CodeObjectStore, reported by CodeObjectStore::GetStats().
+struct CodeObjectStoreStats
+{
+    Pal::uint32 numReferences;      ///< Number of sessions (and other owners) currently referencing the store.
+    Pal::uint32 numCodeObjects;     ///< Number of unique pipeline and library code objects held.
+    Pal::uint32 numShaderRecords;   ///< Number of shader ISA records held.
+    Pal::uint64 codeObjectBytes;    ///< System memory used by the code object records.
+    Pal::uint64 shaderRecordBytes;  ///< System memory used by the shader ISA records.
+    Pal::uint64 numHits;            ///< Number of registrations which found their code object already stored.
+};
+
+/**
+***********************************************************************************************************************
+* @class CodeObjectStore
+* @brief Shared, reference-counted store of the pipeline binaries and shader ISA records captured by GpaSessions.
+*
+* Every GpaSession needs the code object of each registered pipeline to write RGP traces. Without sharing, each session
+* keeps its own copy of every binary, which adds up quickly when tools keep one session per captured frame. A store
+* holds each unique code object once, keyed by its internal pipeline (or library) hash. Sessions only keep pointers to
+* the stored records.
+*
+* A client typically creates one store per device and hands it to every GpaSession it creates on that device. Sessions
+* which are not given a store create a private one, and session copies share the store of their source. The store is
+* destroyed along with its records once the last reference is released.
+*
+* All methods are thread safe.
+***********************************************************************************************************************
+*/
+class CodeObjectStore
+{
+public:
+    /// One variable-size record in RGP file format, owned by the store once inserted.
+    struct Record
+    {
+        Pal::uint32 recordSize;  ///< Size of the record data in bytes.
+        void*       pRecord;     ///< Record data, allocated from the store's platform.
+    };
+
+    /// Everything captured for one pipeline or library.
+    struct Entry
+    {
+        Record      codeObject;                          ///< SqttCodeObjectDatabaseRecord followed by the binary.
+        Pal::uint32 numShaderRecords;                    ///< Number of valid entries in shaderRecords.
+        Record      shaderRecords[Pal::NumShaderTypes];  ///< SqttIsaDbRecord records of the pipeline's shaders.
+    };
+
+    /// Creates a store holding one reference, which the caller must eventually release.
+    ///
+    /// @param [in]  pPlatform  Platform used to allocate the store and all of its records.
+    /// @param [out] ppStore    The new store.
+    ///
+    /// @returns Success, or ErrorOutOfMemory if the store could not be allocated.
+    static Pal::Result Create(Pal::IPlatform* pPlatform, CodeObjectStore** ppStore);
+
+    /// Adds a reference to the store.
+    void AddRef();
+
+    /// Releases a reference; the store and all of its records are destroyed when the last one is released.
+    void Release();
+
+    /// Looks up the records of a pipeline or library.
+    ///
+    /// @param [in] hash  Internal pipeline hash or internal library hash of the code object.
+    ///
+    /// @returns The stored records, which stay valid as long as the caller holds a reference, or null.
+    const Entry* Find(Pal::uint64 hash);
+
+    /// Adds the records of a pipeline or library. The store takes ownership of the records in entry, which must have
+    /// been allocated from the store's platform. If another thread stored the same code object first, the given
+    /// records are freed and the existing entry is returned instead.
+    ///
+    /// @returns The stored records, or null if the entry could not be added (the records are freed in that case).
+    const Entry* Insert(Pal::uint64 hash, const Entry& entry);
+
+    /// Reports the store's memory usage.
+    void GetStats(CodeObjectStoreStats* pStats) const;
+
+    /// Returns the platform which allocates the store's records.
+    Pal::IPlatform* GetPlatform() const { return m_pPlatform; }
+
+private:
+    explicit CodeObjectStore(Pal::IPlatform* pPlatform);
+    ~CodeObjectStore();
+
+    Pal::Result Init();
+    void        FreeRecords(Entry* pEntry);
+    void        FreeEntry(Entry* pEntry);
+
+    typedef Util::HashMap<Pal::uint64, Entry*, Pal::IPlatform, Util::JenkinsHashFunc> EntryMap;
+
+    Pal::IPlatform*const m_pPlatform;
+    volatile Pal::uint32 m_refCount;
+    mutable Util::Mutex  m_lock;         // Guards m_entries and m_stats.
+    EntryMap             m_entries;
+    CodeObjectStoreStats m_stats;        // Everything except numReferences.
+
+    PAL_DISALLOW_DEFAULT_CTOR(CodeObjectStore);
+    PAL_DISALLOW_COPY_AND_ASSIGN(CodeObjectStore);
+};
+
+} // GpuUtil
@@ -31,6 +31,7 @@
 
 #pragma once
 
+#include "palCodeObjectStore.h"
 #include "palDeque.h"
 #include "palDevice.h"
 #include "palGpuUtil.h"
@@ -410,6 +411,10 @@ public:
     typedef Util::Deque<PerfExperimentMemory, GpaAllocator> PerfExpMemDeque;
 
     /// Constructor.
+    ///
+    /// @param [in] pCodeObjectStore  Optional store shared with other sessions on the same device, see
+    ///                               @ref CodeObjectStore. The session holds a reference to it until destruction. If
+    ///                               null, the session creates a private store in Init().
     GpaSession(
         Pal::IPlatform*      pPlatform,
         Pal::IDevice*        pDevice,
@@ -420,7 +425,12 @@ public:
 #endif
         Pal::uint16          rgpInstrumentationSpecVer = 0,
         Pal::uint16          rgpInstrumentationApiVer  = 0,
+#if PAL_CLIENT_INTERFACE_MAJOR_VERSION >= 642
+        PerfExpMemDeque*     pAvailablePerfExpMem      = nullptr,
+        CodeObjectStore*     pCodeObjectStore          = nullptr);
+#else
         PerfExpMemDeque*     pAvailablePerfExpMem      = nullptr);
+#endif
 
     ~GpaSession();
 
@@ -440,6 +450,10 @@ public:
     /// Initialize the newly constructed GPA session.
     Pal::Result Init();
 
+    /// Returns the store which holds the code objects and shader records of the pipelines registered with this
+    /// session. Its statistics report how much memory those records use across all sessions sharing the store.
+    CodeObjectStore* GetCodeObjectStore() const { return m_pCodeObjectStore; }
+
     /// Registers a queue with the GpaSession that will be submitted to using TimedSubmit. This must be called on any
     /// queues that are submitted to via the Timed* functions.
     Pal::Result RegisterTimedQueue(Pal::IQueue* pQueue,
@@ -816,6 +830,10 @@ private:
 
     Util::RWLock m_registerPipelineLock;
 
+    // Owns the code object and shader records referenced by the lists above. Shared with session copies and with any
+    // other session the client handed the same store.
+    CodeObjectStore* m_pCodeObjectStore;
+
     // Event type for timed queue events
     enum class TimedQueueEventType : Pal::uint32
     {
@@ -989,6 +1007,17 @@ private:
     // Helper function to destroy the GpuMemoryInfo object
     void DestroyGpuMemoryInfo(GpuMemoryInfo* pGpuMemoryInfo);
 
+    template <typename CodeObjectSource>
+    Pal::Result CreateCodeObjectRecord(const CodeObjectSource* pSource, CodeObjectStore::Record* pRecord);
+
+    Pal::Result StoreCodeObjectRecords(
+        Pal::uint64                    codeObjectHash,
+        Pal::Result                    captureResult,
+        CodeObjectStore::Entry*        pEntry,
+        const CodeObjectStore::Entry** ppStored);
+
+    Pal::Result AddCodeObjectRecords(const CodeObjectStore::Entry& entry);
+
     Pal::Result CreateShaderRecord(
         Pal::ShaderType       shaderType,
         const Pal::IPipeline* pPipeline,
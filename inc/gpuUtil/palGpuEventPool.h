@@ -33,12 +33,14 @@
 
 #include "palDeque.h"
 #include "palPlatform.h"
+#include "palThread.h"
 
 // Forward declarations.
 namespace Pal
 {
 
 class ICmdBuffer;
+class IFence;
 class IGpuEvent;
 }
 
@@ -53,16 +55,28 @@ namespace GpuUtil
 * A GpuEventPool is a container for a set of GPU event objects. Its main purpose is to provide client with a utility to
 * efficiently manage PAL's GPU events.
 *
-* @warning GpuEventPool is not thread safe.  Acquire event or recycle event from different threads should use
-*          different pool objects.
+* The pool may be shared by any number of threads without external synchronization. Each thread which touches the pool
+* gets its own cache of free events, so acquiring and returning events never takes a lock. New events are created in
+* slabs of EventsPerSlab objects which share one system memory allocation and are bound back-to-back in one GPU memory
+* allocation owned by the pool, so events stay valid independently of the command buffers they are used in. Threads
+* which return more events than they acquire periodically hand whole batches of free events to the other threads through
+* a lock-free list.
+*
+* Events can also be handed back together with the fence of the submission which uses them. Such events are recycled
+* once that fence is signaled, which saves the client from tracking command buffer retirement itself.
+*
+* @warning Reset() and destruction must not overlap with any other call on the pool. When the pool is used from multiple
+*          threads, both allocators must be thread safe.
 ***********************************************************************************************************************
 */
 template <typename PlatformAllocator, typename GpuEventAllocator>
 class GpuEventPool
 {
-    typedef Util::Deque<Pal::IGpuEvent*, PlatformAllocator> GpuEventDeque;
-
 public:
+    /// Number of GPU events created together whenever a thread's cache runs dry. This is also the granularity at which
+    /// free events move between threads.
+    static constexpr Pal::uint32 EventsPerSlab = 32;
+
     /// Constructor.
     ///
     /// @param [in] pDevice             The device this pool is based on.
@@ -82,11 +96,11 @@ public:
     /// This should only be called after all work referring to those events have finished on GPU.
     Pal::Result Reset();
 
-    /// Provide an available GPU event from free event list, or allocate a new one if the list is empty.
-    /// A newly created GPU event gets a new allocated GPU memory, the backing video mem is GPU-access only scratch
-    /// memory from the invisible heap.
+    /// Provide an available GPU event from the calling thread's free event list, or allocate a new slab of events if no
+    /// free event is available. Newly created GPU events are GPU-access only and are bound to GPU memory owned by the
+    /// pool, which stays resident until Reset() or destruction.
     ///
-    /// @param [in]  pCmdBuffer  Provides an allocator and a way to allocate video memory for GPU event.
+    /// @param [in]  pCmdBuffer  Command buffer the event is requested for.  The event does not depend on it.
     /// @param [out] ppEvent     The provided available event.
     Pal::Result GetFreeEvent(Pal::ICmdBuffer* pCmdBuffer, Pal::IGpuEvent**const ppEvent);
 
@@ -95,16 +109,92 @@ public:
     /// client needs to reset the value before use. Need to reset from GPU because the video memory is GPU-access only.
     Pal::Result ReturnEvent(Pal::IGpuEvent* pEvent);
 
+    /// Return a set of GPU events which are still referenced by in-flight GPU work. The events are handed out again by
+    /// the calling thread once pFence is signaled. The fence must stay alive until then, or until Reset() is called.
+    ///
+    /// @param [in] pFence      Fence which signals once the work referencing the events has retired.
+    /// @param [in] eventCount  Number of events in ppEvents.
+    /// @param [in] ppEvents    The events to recycle.
+    Pal::Result ReturnEventsOnFence(
+        const Pal::IFence*     pFence,
+        Pal::uint32            eventCount,
+        Pal::IGpuEvent*const*  ppEvents);
+
 private:
-    // Create a new GPU event object and allocate video memory for it. A GPU-access only scratch memory from the
-    // invisible heap is allocated.
-    Pal::Result CreateNewEvent(Pal::ICmdBuffer* pCmdBuffer, Pal::IGpuEvent**const ppEvent);
+    typedef Util::Deque<Pal::IGpuEvent*, PlatformAllocator> GpuEventDeque;
+
+    // A thread's cache starts handing batches of free events to other threads once it holds this many.
+    static constexpr Pal::uint32 SpillThreshold = 2 * EventsPerSlab;
+
+    // A group of free events which is either waiting on a fence or being passed between threads.
+    struct EventBatch
+    {
+        EventBatch*        pNext;
+        const Pal::IFence* pFence;                 // Fence guarding the events, null if they are already free.
+        Pal::uint32        count;
+        Pal::IGpuEvent*    pEvents[EventsPerSlab];
+    };
+
+    // Header of one system memory allocation holding EventsPerSlab GPU event objects. The event objects follow it.
+    struct EventSlab
+    {
+        EventSlab*       pNext;
+        Pal::uint32      count;                    // Number of events which were successfully created.
+        Pal::IGpuEvent*  pEvents[EventsPerSlab];
+        Pal::IGpuMemory* pGpuMemory;               // Resident GPU memory all events of the slab are bound to.
+    };
+
+    // Per-thread state. Only the owning thread touches a cache, except for Reset() and destruction.
+    struct ThreadCache
+    {
+        ThreadCache(PlatformAllocator* pAllocator, Pal::uint64 ownerThreadId)
+            :
+            pNext(nullptr),
+            threadId(ownerThreadId),
+            freeList(pAllocator),
+            pRetiringHead(nullptr),
+            pRetiringTail(nullptr),
+            pSpareBatches(nullptr),
+            pSlabs(nullptr)
+        {}
+
+        ThreadCache*  pNext;                       // Next cache registered with the pool.
+        Pal::uint64   threadId;                    // Thread which owns this cache.
+        GpuEventDeque freeList;
+        EventBatch*   pRetiringHead;               // Batches waiting on a fence, in the order they were returned.
+        EventBatch*   pRetiringTail;
+        EventBatch*   pSpareBatches;               // Empty batches available for reuse.
+        EventSlab*    pSlabs;                      // Slabs created by this thread.
+    };
+
+    ThreadCache* GetThreadCache();
+    EventBatch*  AcquireBatch(ThreadCache* pCache);
+    void         ReleaseBatch(ThreadCache* pCache, EventBatch* pBatch);
+
+    void         RecycleRetiredEvents(ThreadCache* pCache);
+    void         AcquireSharedEvents(ThreadCache* pCache);
+    void         SpillFreeEvents(ThreadCache* pCache);
+
+    // Create a new slab of GPU event objects and bind them to one new GPU memory allocation owned by the slab.
+    Pal::Result CreateEventSlab(ThreadCache* pCache);
+    Pal::Result CreateSlabGpuMemory(EventSlab* pSlab);
+    void        DestroyEventSlab(EventSlab* pSlab);
+
+    void ReleaseAll(bool destroyCaches);
 
     Pal::IDevice*const      m_pDevice;
+    PlatformAllocator*const m_pPlatformAllocator;
     GpuEventAllocator*const m_pAllocator; // System memory allocator that allocates GPU event objects
 
-    GpuEventDeque m_freeEventList;
-    GpuEventDeque m_globalEventList;
+    // Every ThreadCache ever created for this pool. Caches are only ever pushed while the pool is in use. A thread finds
+    // its cache by walking this short list, which avoids spending one of the process' few thread-local keys per pool.
+    ThreadCache*volatile    m_pCaches;
+
+    // Batches of free events spilled by one thread for the others. Pushed with a compare-and-swap and always drained in
+    // full with an exchange, which keeps the list free of ABA hazards.
+    EventBatch*volatile     m_pSharedBatches;
+
+    volatile Pal::uint32    m_numEvents;  // Total number of GPU events created by this pool.
 
     PAL_DISALLOW_DEFAULT_CTOR(GpuEventPool);
     PAL_DISALLOW_COPY_AND_ASSIGN(GpuEventPool);
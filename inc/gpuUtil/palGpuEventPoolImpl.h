@@ -1,7 +1,7 @@
 /*
  ***********************************************************************************************************************
  *
- *  Copyright (c) 2019-2020 Advanced Micro Devices, Inc. All Rights Reserved.
+ *  Copyright (c) 2018-2020 Advanced Micro Devices, Inc. All Rights Reserved.
  *
  *  Permission is hereby granted, free of charge, to any person obtaining a copy
  *  of this software and associated documentation files (the "Software"), to deal
@@ -27,9 +27,12 @@
 
 #include "palCmdBuffer.h"
 #include "palDequeImpl.h"
+#include "palFence.h"
 #include "palGpuEvent.h"
 #include "palGpuEventPool.h"
+#include "palGpuMemory.h"
 #include "palLinearAllocator.h"
+#include "palMutex.h"
 
 namespace GpuUtil
 {
@@ -42,9 +45,11 @@ GpuEventPool<PlatformAllocator, GpuEventAllocator>::GpuEventPool(
     GpuEventAllocator* pAllocator)
     :
     m_pDevice(pDevice),
+    m_pPlatformAllocator(pPlatformAllocator),
     m_pAllocator(pAllocator),
-    m_freeEventList(pPlatformAllocator),
-    m_globalEventList(pPlatformAllocator)
+    m_pCaches(nullptr),
+    m_pSharedBatches(nullptr),
+    m_numEvents(0)
 {
 }
 
@@ -52,119 +57,560 @@ GpuEventPool<PlatformAllocator, GpuEventAllocator>::GpuEventPool(
 template <typename PlatformAllocator, typename GpuEventAllocator>
 GpuEventPool<PlatformAllocator, GpuEventAllocator>::~GpuEventPool()
 {
-    DXC_ASSERT(m_freeEventList.NumElements() == m_globalEventList.NumElements());
+    ReleaseAll(true);
+}
+
+// =====================================================================================================================
+// Unmap the backing video memory, free up the system memory of the IGpuEvent objects. And release all the event entries
+// from the lists.
+template <typename PlatformAllocator, typename GpuEventAllocator>
+Pal::Result GpuEventPool<PlatformAllocator, GpuEventAllocator>::Reset()
+{
+    // The thread caches themselves stay registered so their threads keep finding them.
+    ReleaseAll(false);
 
-    while (m_freeEventList.NumElements() > 0)
+    return Pal::Result::Success;
+}
+
+// =====================================================================================================================
+// Destroys every GPU event and frees every batch owned by the pool. The caller guarantees that no other thread is using
+// the pool, so the lock-free lists can be walked directly.
+template <typename PlatformAllocator, typename GpuEventAllocator>
+void GpuEventPool<PlatformAllocator, GpuEventAllocator>::ReleaseAll(
+    bool destroyCaches)
+{
+    Pal::uint32 numFreeEvents = 0;
+
+    EventBatch* pBatch = m_pSharedBatches;
+    m_pSharedBatches   = nullptr;
+
+    while (pBatch != nullptr)
     {
-        Pal::IGpuEvent* pEvent = nullptr;
-        m_freeEventList.PopFront(&pEvent);
+        EventBatch*const pNext = pBatch->pNext;
+        numFreeEvents += pBatch->count;
+        PAL_FREE(pBatch, m_pPlatformAllocator);
+        pBatch = pNext;
     }
-    while (m_globalEventList.NumElements() > 0)
+
+    ThreadCache* pCache = m_pCaches;
+    while (pCache != nullptr)
     {
-        Pal::IGpuEvent* pEvent = nullptr;
-        m_globalEventList.PopFront(&pEvent);
-        pEvent->Destroy();
-        PAL_SAFE_FREE(pEvent, m_pAllocator);
+        numFreeEvents += static_cast<Pal::uint32>(pCache->freeList.NumElements());
+        while (pCache->freeList.NumElements() > 0)
+        {
+            Pal::IGpuEvent* pEvent = nullptr;
+            pCache->freeList.PopFront(&pEvent);
+        }
+
+        // All work referring to the events has finished by now, so batches still waiting on a fence count as free.
+        while (pCache->pRetiringHead != nullptr)
+        {
+            pBatch                = pCache->pRetiringHead;
+            pCache->pRetiringHead = pBatch->pNext;
+            numFreeEvents        += pBatch->count;
+            PAL_FREE(pBatch, m_pPlatformAllocator);
+        }
+        pCache->pRetiringTail = nullptr;
+
+        while (pCache->pSpareBatches != nullptr)
+        {
+            pBatch                = pCache->pSpareBatches;
+            pCache->pSpareBatches = pBatch->pNext;
+            PAL_FREE(pBatch, m_pPlatformAllocator);
+        }
+
+        while (pCache->pSlabs != nullptr)
+        {
+            EventSlab* pSlab = pCache->pSlabs;
+            pCache->pSlabs   = pSlab->pNext;
+
+            DestroyEventSlab(pSlab);
+        }
+
+        ThreadCache* pNext = pCache->pNext;
+        if (destroyCaches)
+        {
+            PAL_SAFE_DELETE(pCache, m_pPlatformAllocator);
+        }
+        pCache = pNext;
     }
+
+    // At this point we expect all allocated GpuEvents have been returned back to the pool.
+    PAL_ASSERT(numFreeEvents == m_numEvents);
+
+    if (destroyCaches)
+    {
+        m_pCaches = nullptr;
+    }
+    m_numEvents = 0;
 }
 
 // =====================================================================================================================
-// Unmap the backing video memory, free up the system memory of the IGpuEvent objects. And release all the event entries
-// from the lists.
+// Returns the calling thread's cache, creating and registering it on the thread's first use of the pool. Returns null
+// if we ran out of memory.
 template <typename PlatformAllocator, typename GpuEventAllocator>
-Result GpuEventPool<PlatformAllocator, GpuEventAllocator>::Reset()
+typename GpuEventPool<PlatformAllocator, GpuEventAllocator>::ThreadCache*
+    GpuEventPool<PlatformAllocator, GpuEventAllocator>::GetThreadCache()
 {
-    Result result = Result::Success;
+    const Pal::uint64 threadId = Util::GetIdOfCurrentThread();
 
-    // At this point we expect all allocated GpuEvents have been returned back to m_freeEventList.
-    DXC_ASSERT(m_freeEventList.NumElements() == m_globalEventList.NumElements());
-
-    // Some allocators don't require freeing the GpuEvent objects memory here (like VirtualLinearAllocator that will
-    // rewind).
-    while (m_freeEventList.NumElements() > 0)
+    // Only the owning thread registers a cache for itself, so if the cache isn't in the list yet nobody else can add it
+    // concurrently.
+    ThreadCache* pCache = m_pCaches;
+    while ((pCache != nullptr) && (pCache->threadId != threadId))
     {
-        Pal::IGpuEvent* pEvent = nullptr;
-        m_freeEventList.PopFront(&pEvent);
+        pCache = pCache->pNext;
     }
-    while (m_globalEventList.NumElements() > 0)
+
+    if (pCache == nullptr)
     {
-        Pal::IGpuEvent* pEvent = nullptr;
-        m_globalEventList.PopFront(&pEvent);
-        pEvent->Destroy();
-        PAL_SAFE_FREE(pEvent, m_pAllocator);
+        pCache = PAL_NEW(ThreadCache, m_pPlatformAllocator, Util::SystemAllocType::AllocInternal)
+                        (m_pPlatformAllocator, threadId);
+
+        if (pCache != nullptr)
+        {
+            // Caches are only ever added while the pool is live, so a plain compare-and-swap push is enough.
+            void* pHead = m_pCaches;
+            void* pPrev = nullptr;
+            do
+            {
+                pCache->pNext = static_cast<ThreadCache*>(pHead);
+                pPrev         = pHead;
+                pHead         = Util::AtomicCompareAndSwapPointer(
+                                    reinterpret_cast<void*volatile*>(&m_pCaches), pPrev, pCache);
+            } while (pHead != pPrev);
+        }
     }
 
-    return result;
+    return pCache;
 }
 
 // =====================================================================================================================
 template <typename PlatformAllocator, typename GpuEventAllocator>
-Result GpuEventPool<PlatformAllocator, GpuEventAllocator>::GetFreeEvent(
-    Pal::ICmdBuffer*      pCmdBuffer,
-    Pal::IGpuEvent**const ppEvent)
+typename GpuEventPool<PlatformAllocator, GpuEventAllocator>::EventBatch*
+    GpuEventPool<PlatformAllocator, GpuEventAllocator>::AcquireBatch(
+        ThreadCache* pCache)
 {
-    Result result = Result::Success;
+    EventBatch* pBatch = pCache->pSpareBatches;
 
-    if (m_freeEventList.NumElements() > 0)
+    if (pBatch != nullptr)
     {
-        result = m_freeEventList.PopFront(ppEvent);
+        pCache->pSpareBatches = pBatch->pNext;
     }
     else
     {
-        result = CreateNewEvent(pCmdBuffer, ppEvent);
-        m_globalEventList.PushBack(*ppEvent);
+        pBatch = static_cast<EventBatch*>(PAL_MALLOC(sizeof(EventBatch),
+                                                     m_pPlatformAllocator,
+                                                     Util::SystemAllocType::AllocInternal));
     }
 
-    return result;
+    if (pBatch != nullptr)
+    {
+        pBatch->pNext  = nullptr;
+        pBatch->pFence = nullptr;
+        pBatch->count  = 0;
+    }
+
+    return pBatch;
+}
+
+// =====================================================================================================================
+template <typename PlatformAllocator, typename GpuEventAllocator>
+void GpuEventPool<PlatformAllocator, GpuEventAllocator>::ReleaseBatch(
+    ThreadCache* pCache,
+    EventBatch*  pBatch)
+{
+    pBatch->pNext         = pCache->pSpareBatches;
+    pCache->pSpareBatches = pBatch;
+}
+
+// =====================================================================================================================
+// Moves the events of every batch whose fence has been signaled into the thread's free list.
+template <typename PlatformAllocator, typename GpuEventAllocator>
+void GpuEventPool<PlatformAllocator, GpuEventAllocator>::RecycleRetiredEvents(
+    ThreadCache* pCache)
+{
+    EventBatch* pPrev  = nullptr;
+    EventBatch* pBatch = pCache->pRetiringHead;
+
+    while (pBatch != nullptr)
+    {
+        EventBatch*const pNext = pBatch->pNext;
+
+        if (pBatch->pFence->GetStatus() == Pal::Result::Success)
+        {
+            for (Pal::uint32 i = 0; i < pBatch->count; ++i)
+            {
+                pCache->freeList.PushBack(pBatch->pEvents[i]);
+            }
+
+            if (pPrev == nullptr)
+            {
+                pCache->pRetiringHead = pNext;
+            }
+            else
+            {
+                pPrev->pNext = pNext;
+            }
+
+            if (pCache->pRetiringTail == pBatch)
+            {
+                pCache->pRetiringTail = pPrev;
+            }
+
+            ReleaseBatch(pCache, pBatch);
+        }
+        else
+        {
+            pPrev = pBatch;
+        }
+
+        pBatch = pNext;
+    }
 }
 
 // =====================================================================================================================
+// Takes every batch other threads have spilled into the shared list. The whole list is taken at once so that popping
+// never races with another consumer.
 template <typename PlatformAllocator, typename GpuEventAllocator>
-Result GpuEventPool<PlatformAllocator, GpuEventAllocator>::CreateNewEvent(
+void GpuEventPool<PlatformAllocator, GpuEventAllocator>::AcquireSharedEvents(
+    ThreadCache* pCache)
+{
+    if (m_pSharedBatches != nullptr)
+    {
+        EventBatch* pBatch = static_cast<EventBatch*>(Util::AtomicExchangePointer(
+                                 reinterpret_cast<void*volatile*>(&m_pSharedBatches), nullptr));
+
+        while (pBatch != nullptr)
+        {
+            EventBatch*const pNext = pBatch->pNext;
+
+            for (Pal::uint32 i = 0; i < pBatch->count; ++i)
+            {
+                pCache->freeList.PushBack(pBatch->pEvents[i]);
+            }
+
+            ReleaseBatch(pCache, pBatch);
+            pBatch = pNext;
+        }
+    }
+}
+
+// =====================================================================================================================
+// Hands the oldest EventsPerSlab free events of this thread to the other threads once the thread holds more than it is
+// likely to need.
+template <typename PlatformAllocator, typename GpuEventAllocator>
+void GpuEventPool<PlatformAllocator, GpuEventAllocator>::SpillFreeEvents(
+    ThreadCache* pCache)
+{
+    EventBatch*const pBatch = AcquireBatch(pCache);
+
+    if (pBatch != nullptr)
+    {
+        while (pBatch->count < EventsPerSlab)
+        {
+            pCache->freeList.PopFront(&pBatch->pEvents[pBatch->count++]);
+        }
+
+        void* pHead = m_pSharedBatches;
+        void* pPrev = nullptr;
+        do
+        {
+            pBatch->pNext = static_cast<EventBatch*>(pHead);
+            pPrev         = pHead;
+            pHead         = Util::AtomicCompareAndSwapPointer(
+                                reinterpret_cast<void*volatile*>(&m_pSharedBatches), pPrev, pBatch);
+        } while (pHead != pPrev);
+    }
+}
+
+// =====================================================================================================================
+template <typename PlatformAllocator, typename GpuEventAllocator>
+Pal::Result GpuEventPool<PlatformAllocator, GpuEventAllocator>::GetFreeEvent(
     Pal::ICmdBuffer*      pCmdBuffer,
     Pal::IGpuEvent**const ppEvent)
 {
-    Result result = Result::Success;
+    Pal::Result  result = Pal::Result::ErrorOutOfMemory;
+    ThreadCache* pCache = GetThreadCache();
+
+    if (pCache != nullptr)
+    {
+        result = Pal::Result::Success;
+
+        if (pCache->freeList.NumElements() == 0)
+        {
+            RecycleRetiredEvents(pCache);
+        }
+
+        if (pCache->freeList.NumElements() == 0)
+        {
+            AcquireSharedEvents(pCache);
+        }
+
+        if (pCache->freeList.NumElements() == 0)
+        {
+            result = CreateEventSlab(pCache);
+        }
+
+        if (pCache->freeList.NumElements() > 0)
+        {
+            // Hand out the most recently returned event first; it is the most likely to still be in the CPU caches.
+            result = pCache->freeList.PopBack(ppEvent);
+        }
+    }
+
+    return result;
+}
+
+// =====================================================================================================================
+// Creates EventsPerSlab GPU events in one system memory allocation and binds them back-to-back to one GPU memory
+// allocation owned by the slab. On success every event of the slab ends up in the thread's free list.
+template <typename PlatformAllocator, typename GpuEventAllocator>
+Pal::Result GpuEventPool<PlatformAllocator, GpuEventAllocator>::CreateEventSlab(
+    ThreadCache* pCache)
+{
+    Pal::Result result = Pal::Result::Success;
 
     // Create gpuEvent for this pool.
     Pal::GpuEventCreateInfo createInfo  = {};
     createInfo.flags.gpuAccessOnly = 1;
 
-    const size_t eventSize = m_pDevice->GetGpuEventSize(createInfo, &result);
+    const size_t eventSize = Util::Pow2Align(m_pDevice->GetGpuEventSize(createInfo, &result), sizeof(Pal::uint64));
+    const size_t slabSize  = Util::Pow2Align(sizeof(EventSlab), sizeof(Pal::uint64)) + (eventSize * EventsPerSlab);
 
-    if (result == Result::Success)
+    EventSlab* pSlab = nullptr;
+
+    if (result == Pal::Result::Success)
+    {
+        pSlab = static_cast<EventSlab*>(PAL_MALLOC(slabSize, m_pAllocator, Util::SystemAllocType::AllocObject));
+
+        if (pSlab == nullptr)
+        {
+            result = Pal::Result::ErrorOutOfMemory;
+        }
+    }
+
+    if (pSlab != nullptr)
     {
-        result = Result::ErrorOutOfMemory;
-        void* pMemory = PAL_MALLOC(eventSize,
-                                   m_pAllocator,
-                                   Util::SystemAllocType::AllocObject);
+        pSlab->pNext      = nullptr;
+        pSlab->count      = 0;
+        pSlab->pGpuMemory = nullptr;
 
-        if (pMemory != nullptr)
+        void* pMemory = Util::VoidPtrInc(pSlab, Util::Pow2Align(sizeof(EventSlab), sizeof(Pal::uint64)));
+
+        while ((result == Pal::Result::Success) && (pSlab->count < EventsPerSlab))
         {
-            result = m_pDevice->CreateGpuEvent(createInfo, pMemory, ppEvent);
+            result = m_pDevice->CreateGpuEvent(createInfo, pMemory, &pSlab->pEvents[pSlab->count]);
 
-            if (result != Result::Success)
+            if (result == Pal::Result::Success)
             {
-                PAL_SAFE_FREE(pMemory, m_pAllocator);
+                pSlab->count++;
             }
+
+            pMemory = Util::VoidPtrInc(pMemory, eventSize);
+        }
+
+        if (result == Pal::Result::Success)
+        {
+            result = CreateSlabGpuMemory(pSlab);
+        }
+
+        // Only the events are handed out; the slab is linked to the thread's cache for destruction.
+        Pal::uint32 numPushed = 0;
+        while ((result == Pal::Result::Success) && (numPushed < pSlab->count))
+        {
+            result = pCache->freeList.PushBack(pSlab->pEvents[numPushed]);
+            numPushed += (result == Pal::Result::Success) ? 1 : 0;
+        }
+
+        if (result == Pal::Result::Success)
+        {
+            pSlab->pNext   = pCache->pSlabs;
+            pCache->pSlabs = pSlab;
+
+            Util::AtomicAdd(&m_numEvents, pSlab->count);
+        }
+        else
+        {
+            // Take back the events pushed before the failure so that none of them outlives the slab.
+            for (; numPushed > 0; numPushed--)
+            {
+                Pal::IGpuEvent* pEvent = nullptr;
+                pCache->freeList.PopBack(&pEvent);
+            }
+
+            DestroyEventSlab(pSlab);
         }
     }
 
-    // Bind GPU memory to the event.
-    if (result == Result::Success)
+    return result;
+}
+
+// =====================================================================================================================
+// Creates the GPU memory shared by all events of a slab, makes it resident and binds each event to its own part of it.
+template <typename PlatformAllocator, typename GpuEventAllocator>
+Pal::Result GpuEventPool<PlatformAllocator, GpuEventAllocator>::CreateSlabGpuMemory(
+    EventSlab* pSlab)
+{
+    PAL_ASSERT(pSlab->count > 0);
+
+    Pal::GpuMemoryRequirements memReqs = {};
+    pSlab->pEvents[0]->GetGpuMemoryRequirements(&memReqs);
+
+    const Pal::gpusize eventMemSize = Util::Pow2Align(memReqs.size, memReqs.alignment);
+
+    Pal::GpuMemoryCreateInfo createInfo = {};
+    createInfo.size      = eventMemSize * pSlab->count;
+    createInfo.alignment = memReqs.alignment;
+    createInfo.vaRange   = Pal::VaRange::Default;
+    createInfo.priority  = Pal::GpuMemPriority::Normal;
+    createInfo.heapCount = memReqs.heapCount;
+
+    for (Pal::uint32 i = 0; i < createInfo.heapCount; i++)
     {
-        result = pCmdBuffer->AllocateAndBindGpuMemToEvent(*ppEvent);
+        createInfo.heaps[i] = memReqs.heaps[i];
+    }
+
+    Pal::Result  result     = Pal::Result::Success;
+    const size_t objectSize = m_pDevice->GetGpuMemorySize(createInfo, &result);
+
+    if (result == Pal::Result::Success)
+    {
+        void* pMemory = PAL_MALLOC(objectSize, m_pAllocator, Util::SystemAllocType::AllocObject);
+
+        if (pMemory == nullptr)
+        {
+            result = Pal::Result::ErrorOutOfMemory;
+        }
+        else
+        {
+            result = m_pDevice->CreateGpuMemory(createInfo, pMemory, &pSlab->pGpuMemory);
+
+            if (result != Pal::Result::Success)
+            {
+                pSlab->pGpuMemory = nullptr;
+                PAL_FREE(pMemory, m_pAllocator);
+            }
+        }
+    }
+
+    if (result == Pal::Result::Success)
+    {
+        // The events may be referenced by any command buffer, so their memory stays resident for the slab's lifetime.
+        Pal::GpuMemoryRef memRef = {};
+        memRef.pGpuMemory        = pSlab->pGpuMemory;
+
+        result = m_pDevice->AddGpuMemoryReferences(1, &memRef, nullptr, Pal::GpuMemoryRefCantTrim);
+
+        if (result != Pal::Result::Success)
+        {
+            pSlab->pGpuMemory->Destroy();
+            PAL_FREE(pSlab->pGpuMemory, m_pAllocator);
+            pSlab->pGpuMemory = nullptr;
+        }
+    }
+
+    for (Pal::uint32 i = 0; (result == Pal::Result::Success) && (i < pSlab->count); ++i)
+    {
+        result = pSlab->pEvents[i]->BindGpuMemory(pSlab->pGpuMemory, eventMemSize * i);
     }
 
     return result;
 }
 
+// =====================================================================================================================
+// Destroys the events of a slab, then releases the GPU memory they are bound to and the slab's system memory. All work
+// referring to the events must have finished.
+template <typename PlatformAllocator, typename GpuEventAllocator>
+void GpuEventPool<PlatformAllocator, GpuEventAllocator>::DestroyEventSlab(
+    EventSlab* pSlab)
+{
+    for (Pal::uint32 i = 0; i < pSlab->count; ++i)
+    {
+        pSlab->pEvents[i]->Destroy();
+    }
+
+    if (pSlab->pGpuMemory != nullptr)
+    {
+        m_pDevice->RemoveGpuMemoryReferences(1, &pSlab->pGpuMemory, nullptr);
+
+        pSlab->pGpuMemory->Destroy();
+        PAL_FREE(pSlab->pGpuMemory, m_pAllocator);
+    }
+
+    // Some allocators don't require freeing the GpuEvent objects memory here (like VirtualLinearAllocator that will
+    // rewind).
+    PAL_FREE(pSlab, m_pAllocator);
+}
+
 // =====================================================================================================================
 template <typename PlatformAllocator, typename GpuEventAllocator>
-Result GpuEventPool<PlatformAllocator, GpuEventAllocator>::ReturnEvent(
+Pal::Result GpuEventPool<PlatformAllocator, GpuEventAllocator>::ReturnEvent(
     Pal::IGpuEvent* pEvent)
 {
-    return m_freeEventList.PushBack(pEvent);
+    Pal::Result  result = Pal::Result::ErrorOutOfMemory;
+    ThreadCache* pCache = GetThreadCache();
+
+    if (pCache != nullptr)
+    {
+        result = pCache->freeList.PushBack(pEvent);
+
+        if (pCache->freeList.NumElements() > SpillThreshold)
+        {
+            SpillFreeEvents(pCache);
+        }
+    }
+
+    return result;
+}
+
+// =====================================================================================================================
+template <typename PlatformAllocator, typename GpuEventAllocator>
+Pal::Result GpuEventPool<PlatformAllocator, GpuEventAllocator>::ReturnEventsOnFence(
+    const Pal::IFence*    pFence,
+    Pal::uint32           eventCount,
+    Pal::IGpuEvent*const* ppEvents)
+{
+    PAL_ASSERT(pFence != nullptr);
+
+    Pal::Result  result = Pal::Result::ErrorOutOfMemory;
+    ThreadCache* pCache = GetThreadCache();
+
+    if (pCache != nullptr)
+    {
+        result = Pal::Result::Success;
+
+        Pal::uint32 eventIdx = 0;
+        while ((result == Pal::Result::Success) && (eventIdx < eventCount))
+        {
+            EventBatch*const pBatch = AcquireBatch(pCache);
+
+            if (pBatch == nullptr)
+            {
+                result = Pal::Result::ErrorOutOfMemory;
+            }
+            else
+            {
+                pBatch->pFence = pFence;
+                while ((pBatch->count < EventsPerSlab) && (eventIdx < eventCount))
+                {
+                    pBatch->pEvents[pBatch->count++] = ppEvents[eventIdx++];
+                }
+
+                if (pCache->pRetiringTail == nullptr)
+                {
+                    pCache->pRetiringHead = pBatch;
+                }
+                else
+                {
+                    pCache->pRetiringTail->pNext = pBatch;
+                }
+                pCache->pRetiringTail = pBatch;
+            }
+        }
+    }
+
+    return result;
 }
 
 } //GpuUtil
@@ -0,0 +1,206 @@
+/*
+ ***********************************************************************************************************************
+ *
+ *  Copyright (c) 2020 Advanced Micro Devices, Inc. All Rights Reserved.
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy
+ *  of this software and associated documentation files (the "Software"), to deal
+ *  in the Software without restriction, including without limitation the rights
+ *  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *  copies of the Software, and to permit persons to whom the Software is
+ *  furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in all
+ *  copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ *  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *  SOFTWARE.
+ *
+ **********************************************************************************************************************/
+/**
+***********************************************************************************************************************
+* @file  palObjectPool.h
+* @brief PAL GPU utility ObjectPool class.
+***********************************************************************************************************************
+*/
+
+#pragma once
+
+#include "palDevice.h"
+#include "palMutex.h"
+
+// Forward declarations.
+namespace Pal
+{
+
+class ICmdAllocator;
+class ICmdBuffer;
+class IFence;
+class IGpuEvent;
+class IQueryPool;
+}
+
+namespace GpuUtil
+{
+
+/// Counters reported by ObjectPool::GetStats().
+struct ObjectPoolStats
+{
+    Pal::uint64 objectsCreated;     ///< Number of objects created by the pool.
+    Pal::uint64 blocksAllocated;    ///< Number of placement memory blocks allocated from the system allocator.
+    Pal::uint64 blocksRecycled;     ///< Number of objects which were placed in a recycled memory block.
+    Pal::uint64 cmdBuffersReused;   ///< Number of command buffers which were handed out again without re-creation.
+    Pal::uint32 freeBlocks;         ///< Number of placement memory blocks currently waiting for reuse.
+    Pal::uint32 cachedCmdBuffers;   ///< Number of command buffers currently waiting for reuse.
+};
+
+/**
+***********************************************************************************************************************
+* @class ObjectPool
+* @brief Helper class which recycles the placement memory of frequently created PAL objects.
+*
+* Clients which create and destroy many short-lived GPU events, fences, query pools or command buffers pay for a system
+* memory allocation and free each time. An ObjectPool keeps the placement memory of destroyed objects on per-type free
+* lists and hands it back on the next creation of the same type, so steady-state object churn never reaches the system
+* allocator.
+*
+* Command buffers go one step further: a destroyed command buffer is reset without returning its GPU memory and kept
+* alive, up to a configurable limit. A later CreateCmdBuffer() call with identical create info gets that command
+* buffer back, along with the command and embedded data chunks it retained.
+*
+* Objects created by the pool must be destroyed through the matching Destroy() method of the same pool, never through
+* IDestroyable::Destroy(). Query pools and GPU events must have their GPU memory unbound by the client as usual.
+*
+* The pool tracks the command allocator each of its command buffers uses, so a pooled command buffer must be moved to
+* another command allocator with ResetCmdBuffer() rather than ICmdBuffer::Reset().
+*
+* @warning Cached command buffers keep chunks of their command allocator alive. ReleaseCmdBuffers() must be called for
+*          a command allocator before it is reset or destroyed.
+***********************************************************************************************************************
+*/
+template <typename Allocator>
+class ObjectPool
+{
+public:
+    /// Default number of destroyed command buffers kept alive for reuse.
+    static constexpr Pal::uint32 DefaultMaxCachedCmdBuffers = 16;
+
+    /// Constructor.
+    ///
+    /// @param [in] pDevice              The device all pooled objects are created on.
+    /// @param [in] pAllocator           The allocator that allocates placement memory for the pooled objects.
+    /// @param [in] maxCachedCmdBuffers  Maximum number of destroyed command buffers kept alive for reuse. Zero disables
+    ///                                  command buffer reuse; their placement memory is still recycled.
+    ObjectPool(
+        Pal::IDevice* pDevice,
+        Allocator*    pAllocator,
+        Pal::uint32   maxCachedCmdBuffers = DefaultMaxCachedCmdBuffers);
+
+    /// Destructor.
+    ///
+    /// Destroys all cached command buffers and frees all recycled placement memory. Objects which are still alive are
+    /// not tracked by the pool and must have been destroyed before.
+    ~ObjectPool();
+
+    /// Initializes the pool. Must be called once, before any other method.
+    Pal::Result Init();
+
+    /// Creates a GPU event in recycled placement memory. See IDevice::CreateGpuEvent().
+    Pal::Result CreateGpuEvent(const Pal::GpuEventCreateInfo& createInfo, Pal::IGpuEvent** ppGpuEvent);
+
+    /// Creates a fence in recycled placement memory. See IDevice::CreateFence().
+    Pal::Result CreateFence(const Pal::FenceCreateInfo& createInfo, Pal::IFence** ppFence);
+
+    /// Creates a query pool in recycled placement memory. See IDevice::CreateQueryPool().
+    Pal::Result CreateQueryPool(const Pal::QueryPoolCreateInfo& createInfo, Pal::IQueryPool** ppQueryPool);
+
+    /// Provides a command buffer in the reset state. A cached command buffer created with identical create info is
+    /// returned if one exists, otherwise a new one is created in recycled placement memory. See
+    /// IDevice::CreateCmdBuffer().
+    Pal::Result CreateCmdBuffer(const Pal::CmdBufferCreateInfo& createInfo, Pal::ICmdBuffer** ppCmdBuffer);
+
+    /// Resets a command buffer created by this pool, see ICmdBuffer::Reset(). If pCmdAllocator is non-null the pool
+    /// records it as the command buffer's allocator, so that ReleaseCmdBuffers() and CreateCmdBuffer() match the
+    /// command buffer by the allocator it currently uses rather than the one it was created with.
+    Pal::Result ResetCmdBuffer(Pal::ICmdBuffer* pCmdBuffer, Pal::ICmdAllocator* pCmdAllocator, bool returnGpuMemory);
+
+    /// Destroys a GPU event created by this pool and recycles its placement memory.
+    void Destroy(Pal::IGpuEvent* pGpuEvent);
+
+    /// Destroys a fence created by this pool and recycles its placement memory.
+    void Destroy(Pal::IFence* pFence);
+
+    /// Destroys a query pool created by this pool and recycles its placement memory.
+    void Destroy(Pal::IQueryPool* pQueryPool);
+
+    /// Returns a command buffer created by this pool. The command buffer is reset while retaining its GPU memory and
+    /// cached for reuse if there is room, otherwise it is destroyed and its placement memory recycled.
+    ///
+    /// @warning The same rules as for ICmdBuffer::Reset() with returnGpuMemory set to false apply: the command buffer
+    ///          must not be queued or executing, and all command buffers which nested it must have been reset.
+    void Destroy(Pal::ICmdBuffer* pCmdBuffer);
+
+    /// Destroys all cached command buffers which use the given command allocator, or all cached command buffers if
+    /// pCmdAllocator is null. Must be called before resetting or destroying a command allocator used by pooled command
+    /// buffers.
+    void ReleaseCmdBuffers(const Pal::ICmdAllocator* pCmdAllocator);
+
+    /// Destroys all cached command buffers and frees all recycled placement memory back to the allocator.
+    void Trim();
+
+    /// Reports the pool's counters.
+    void GetStats(ObjectPoolStats* pStats) const;
+
+private:
+    // Types of objects whose placement memory is recycled. Command buffers have their own free list.
+    enum ObjectType : Pal::uint32
+    {
+        GpuEvent = 0,
+        Fence,
+        QueryPool,
+        CmdBuffer,
+        Count
+    };
+
+    // Header of one placement memory block. The object itself follows at HeaderSize bytes from the start of the block.
+    struct Block
+    {
+        Block*                   pNext;
+        size_t                   size;           // Placement size the block was allocated for.
+        Pal::ICmdBuffer*         pCmdBuffer;     // Live command buffer if the block sits on the cached list.
+        Pal::CmdBufferCreateInfo cmdBufferInfo;  // Create info of the command buffer. pCmdAllocator is the allocator
+                                                 // the command buffer currently uses.
+    };
+
+    static constexpr size_t HeaderSize = ((sizeof(Block) + PAL_CACHE_LINE_BYTES - 1) & ~(PAL_CACHE_LINE_BYTES - 1));
+
+    static Block* BlockFromObject(void* pObject)
+        { return reinterpret_cast<Block*>(Util::VoidPtrDec(pObject, HeaderSize)); }
+    static void* ObjectFromBlock(Block* pBlock)
+        { return Util::VoidPtrInc(pBlock, HeaderSize); }
+
+    void* AcquirePlacement(ObjectType type, size_t size);
+    void  RecyclePlacement(ObjectType type, void* pObject);
+
+    Pal::Result FinishCreate(ObjectType type, void* pPlacement, Pal::Result result);
+    void  DestroyCachedCmdBuffer(Block* pBlock);
+
+    Pal::IDevice*const m_pDevice;
+    Allocator*const    m_pAllocator;
+    const Pal::uint32  m_maxCachedCmdBuffers;
+
+    mutable Util::Mutex m_lock;                     // Guards the lists and counters below.
+    Block*              m_pFreeBlocks[ObjectType::Count];
+    Block*              m_pCachedCmdBuffers;        // Most recently destroyed command buffer first.
+    ObjectPoolStats     m_stats;
+
+    PAL_DISALLOW_DEFAULT_CTOR(ObjectPool);
+    PAL_DISALLOW_COPY_AND_ASSIGN(ObjectPool);
+};
+
+} // GpuUtil
@@ -0,0 +1,461 @@
+/*
+ ***********************************************************************************************************************
+ *
+ *  Copyright (c) 2020 Advanced Micro Devices, Inc. All Rights Reserved.
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy
+ *  of this software and associated documentation files (the "Software"), to deal
+ *  in the Software without restriction, including without limitation the rights
+ *  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *  copies of the Software, and to permit persons to whom the Software is
+ *  furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in all
+ *  copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ *  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *  SOFTWARE.
+ *
+ **********************************************************************************************************************/
+
+#pragma once
+
+#include "palCmdBuffer.h"
+#include "palFence.h"
+#include "palGpuEvent.h"
+#include "palObjectPool.h"
+#include "palQueryPool.h"
+#include "palSysMemory.h"
+
+namespace GpuUtil
+{
+
+// =====================================================================================================================
+template <typename Allocator>
+ObjectPool<Allocator>::ObjectPool(
+    Pal::IDevice* pDevice,
+    Allocator*    pAllocator,
+    Pal::uint32   maxCachedCmdBuffers)
+    :
+    m_pDevice(pDevice),
+    m_pAllocator(pAllocator),
+    m_maxCachedCmdBuffers(maxCachedCmdBuffers),
+    m_pCachedCmdBuffers(nullptr)
+{
+    memset(&m_pFreeBlocks[0], 0, sizeof(m_pFreeBlocks));
+    memset(&m_stats, 0, sizeof(m_stats));
+}
+
+// =====================================================================================================================
+template <typename Allocator>
+ObjectPool<Allocator>::~ObjectPool()
+{
+    Trim();
+}
+
+// =====================================================================================================================
+template <typename Allocator>
+Pal::Result ObjectPool<Allocator>::Init()
+{
+    return m_lock.Init();
+}
+
+// =====================================================================================================================
+// Pops the first free block of the given type which is large enough for the object, or allocates a new one. Objects of
+// one type created with similar create info have the same size, so the first block nearly always fits.
+template <typename Allocator>
+void* ObjectPool<Allocator>::AcquirePlacement(
+    ObjectType type,
+    size_t     size)
+{
+    Block* pBlock = nullptr;
+
+    {
+        Util::MutexAuto lock(&m_lock);
+
+        for (Block** ppPrev = &m_pFreeBlocks[type]; *ppPrev != nullptr; ppPrev = &(*ppPrev)->pNext)
+        {
+            if ((*ppPrev)->size >= size)
+            {
+                pBlock  = *ppPrev;
+                *ppPrev = pBlock->pNext;
+
+                m_stats.freeBlocks--;
+                m_stats.blocksRecycled++;
+                break;
+            }
+        }
+    }
+
+    if (pBlock == nullptr)
+    {
+        pBlock = static_cast<Block*>(PAL_MALLOC(HeaderSize + size, m_pAllocator, Util::SystemAllocType::AllocObject));
+
+        if (pBlock != nullptr)
+        {
+            pBlock->size = size;
+
+            Util::MutexAuto lock(&m_lock);
+            m_stats.blocksAllocated++;
+        }
+    }
+
+    void* pPlacement = nullptr;
+
+    if (pBlock != nullptr)
+    {
+        pBlock->pNext      = nullptr;
+        pBlock->pCmdBuffer = nullptr;
+        pPlacement         = ObjectFromBlock(pBlock);
+    }
+
+    return pPlacement;
+}
+
+// =====================================================================================================================
+// Puts the placement memory of an already destroyed object (or of an object whose creation failed) on its free list.
+template <typename Allocator>
+void ObjectPool<Allocator>::RecyclePlacement(
+    ObjectType type,
+    void*      pObject)
+{
+    Block*const pBlock = BlockFromObject(pObject);
+
+    Util::MutexAuto lock(&m_lock);
+
+    pBlock->pCmdBuffer  = nullptr;
+    pBlock->pNext       = m_pFreeBlocks[type];
+    m_pFreeBlocks[type] = pBlock;
+
+    m_stats.freeBlocks++;
+}
+
+// =====================================================================================================================
+// Common tail of the Create* methods: counts a successfully created object or takes back its placement memory.
+template <typename Allocator>
+Pal::Result ObjectPool<Allocator>::FinishCreate(
+    ObjectType  type,
+    void*       pPlacement,
+    Pal::Result result)
+{
+    if (result == Pal::Result::Success)
+    {
+        Util::MutexAuto lock(&m_lock);
+        m_stats.objectsCreated++;
+    }
+    else
+    {
+        RecyclePlacement(type, pPlacement);
+    }
+
+    return result;
+}
+
+// =====================================================================================================================
+template <typename Allocator>
+Pal::Result ObjectPool<Allocator>::CreateGpuEvent(
+    const Pal::GpuEventCreateInfo& createInfo,
+    Pal::IGpuEvent**               ppGpuEvent)
+{
+    Pal::Result  result = Pal::Result::Success;
+    const size_t size   = m_pDevice->GetGpuEventSize(createInfo, &result);
+
+    if (result == Pal::Result::Success)
+    {
+        void*const pPlacement = AcquirePlacement(ObjectType::GpuEvent, size);
+
+        if (pPlacement == nullptr)
+        {
+            result = Pal::Result::ErrorOutOfMemory;
+        }
+        else
+        {
+            result = FinishCreate(ObjectType::GpuEvent,
+                                  pPlacement,
+                                  m_pDevice->CreateGpuEvent(createInfo, pPlacement, ppGpuEvent));
+        }
+    }
+
+    return result;
+}
+
+// =====================================================================================================================
+template <typename Allocator>
+Pal::Result ObjectPool<Allocator>::CreateFence(
+    const Pal::FenceCreateInfo& createInfo,
+    Pal::IFence**               ppFence)
+{
+    Pal::Result  result = Pal::Result::Success;
+    const size_t size   = m_pDevice->GetFenceSize(&result);
+
+    if (result == Pal::Result::Success)
+    {
+        void*const pPlacement = AcquirePlacement(ObjectType::Fence, size);
+
+        if (pPlacement == nullptr)
+        {
+            result = Pal::Result::ErrorOutOfMemory;
+        }
+        else
+        {
+            result = FinishCreate(ObjectType::Fence,
+                                  pPlacement,
+                                  m_pDevice->CreateFence(createInfo, pPlacement, ppFence));
+        }
+    }
+
+    return result;
+}
+
+// =====================================================================================================================
+template <typename Allocator>
+Pal::Result ObjectPool<Allocator>::CreateQueryPool(
+    const Pal::QueryPoolCreateInfo& createInfo,
+    Pal::IQueryPool**               ppQueryPool)
+{
+    Pal::Result  result = Pal::Result::Success;
+    const size_t size   = m_pDevice->GetQueryPoolSize(createInfo, &result);
+
+    if (result == Pal::Result::Success)
+    {
+        void*const pPlacement = AcquirePlacement(ObjectType::QueryPool, size);
+
+        if (pPlacement == nullptr)
+        {
+            result = Pal::Result::ErrorOutOfMemory;
+        }
+        else
+        {
+            result = FinishCreate(ObjectType::QueryPool,
+                                  pPlacement,
+                                  m_pDevice->CreateQueryPool(createInfo, pPlacement, ppQueryPool));
+        }
+    }
+
+    return result;
+}
+
+// =====================================================================================================================
+template <typename Allocator>
+Pal::Result ObjectPool<Allocator>::CreateCmdBuffer(
+    const Pal::CmdBufferCreateInfo& createInfo,
+    Pal::ICmdBuffer**               ppCmdBuffer)
+{
+    Pal::Result result = Pal::Result::Success;
+    Block*      pFound = nullptr;
+
+    if (createInfo.pCmdAllocator != nullptr)
+    {
+        Util::MutexAuto lock(&m_lock);
+
+        for (Block** ppPrev = &m_pCachedCmdBuffers; *ppPrev != nullptr; ppPrev = &(*ppPrev)->pNext)
+        {
+            const Pal::CmdBufferCreateInfo& cachedInfo = (*ppPrev)->cmdBufferInfo;
+
+            if ((cachedInfo.pCmdAllocator == createInfo.pCmdAllocator) &&
+                (cachedInfo.queueType     == createInfo.queueType)     &&
+                (cachedInfo.queuePriority == createInfo.queuePriority) &&
+                (cachedInfo.engineType    == createInfo.engineType)    &&
+                (cachedInfo.flags.u32All  == createInfo.flags.u32All))
+            {
+                pFound  = *ppPrev;
+                *ppPrev = pFound->pNext;
+
+                m_stats.cachedCmdBuffers--;
+                m_stats.cmdBuffersReused++;
+                break;
+            }
+        }
+    }
+
+    if (pFound != nullptr)
+    {
+        // The command buffer was reset when it was handed back, so it can be used as is.
+        pFound->pNext = nullptr;
+        *ppCmdBuffer  = pFound->pCmdBuffer;
+    }
+    else
+    {
+        const size_t size = m_pDevice->GetCmdBufferSize(createInfo, &result);
+
+        if (result == Pal::Result::Success)
+        {
+            void*const pPlacement = AcquirePlacement(ObjectType::CmdBuffer, size);
+
+            if (pPlacement == nullptr)
+            {
+                result = Pal::Result::ErrorOutOfMemory;
+            }
+            else
+            {
+                BlockFromObject(pPlacement)->cmdBufferInfo = createInfo;
+
+                result = FinishCreate(ObjectType::CmdBuffer,
+                                      pPlacement,
+                                      m_pDevice->CreateCmdBuffer(createInfo, pPlacement, ppCmdBuffer));
+            }
+        }
+    }
+
+    return result;
+}
+
+// =====================================================================================================================
+// Only the client holding the command buffer touches its block while it is alive, so no lock is needed.
+template <typename Allocator>
+Pal::Result ObjectPool<Allocator>::ResetCmdBuffer(
+    Pal::ICmdBuffer*    pCmdBuffer,
+    Pal::ICmdAllocator* pCmdAllocator,
+    bool                returnGpuMemory)
+{
+    const Pal::Result result = pCmdBuffer->Reset(pCmdAllocator, returnGpuMemory);
+
+    if ((result == Pal::Result::Success) && (pCmdAllocator != nullptr))
+    {
+        BlockFromObject(pCmdBuffer)->cmdBufferInfo.pCmdAllocator = pCmdAllocator;
+    }
+
+    return result;
+}
+
+// =====================================================================================================================
+template <typename Allocator>
+void ObjectPool<Allocator>::Destroy(
+    Pal::IGpuEvent* pGpuEvent)
+{
+    pGpuEvent->Destroy();
+    RecyclePlacement(ObjectType::GpuEvent, pGpuEvent);
+}
+
+// =====================================================================================================================
+template <typename Allocator>
+void ObjectPool<Allocator>::Destroy(
+    Pal::IFence* pFence)
+{
+    pFence->Destroy();
+    RecyclePlacement(ObjectType::Fence, pFence);
+}
+
+// =====================================================================================================================
+template <typename Allocator>
+void ObjectPool<Allocator>::Destroy(
+    Pal::IQueryPool* pQueryPool)
+{
+    pQueryPool->Destroy();
+    RecyclePlacement(ObjectType::QueryPool, pQueryPool);
+}
+
+// =====================================================================================================================
+// Command buffers without a known command allocator are never cached, since ReleaseCmdBuffers() could not find them.
+// A command buffer created without one becomes cacheable once it is given one through ResetCmdBuffer().
+template <typename Allocator>
+void ObjectPool<Allocator>::Destroy(
+    Pal::ICmdBuffer* pCmdBuffer)
+{
+    Block*const pBlock = BlockFromObject(pCmdBuffer);
+    bool        cached = false;
+
+    if ((m_maxCachedCmdBuffers > 0)                      &&
+        (pBlock->cmdBufferInfo.pCmdAllocator != nullptr) &&
+        (pCmdBuffer->Reset(nullptr, false) == Pal::Result::Success))
+    {
+        Util::MutexAuto lock(&m_lock);
+
+        if (m_stats.cachedCmdBuffers < m_maxCachedCmdBuffers)
+        {
+            pBlock->pCmdBuffer  = pCmdBuffer;
+            pBlock->pNext       = m_pCachedCmdBuffers;
+            m_pCachedCmdBuffers = pBlock;
+
+            m_stats.cachedCmdBuffers++;
+            cached = true;
+        }
+    }
+
+    if (cached == false)
+    {
+        pCmdBuffer->Destroy();
+        RecyclePlacement(ObjectType::CmdBuffer, pCmdBuffer);
+    }
+}
+
+// =====================================================================================================================
+// Destroys a cached command buffer which was already unlinked from the cached list. The caller must hold m_lock.
+template <typename Allocator>
+void ObjectPool<Allocator>::DestroyCachedCmdBuffer(
+    Block* pBlock)
+{
+    pBlock->pCmdBuffer->Destroy();
+
+    pBlock->pCmdBuffer                   = nullptr;
+    pBlock->pNext                        = m_pFreeBlocks[ObjectType::CmdBuffer];
+    m_pFreeBlocks[ObjectType::CmdBuffer] = pBlock;
+
+    m_stats.cachedCmdBuffers--;
+    m_stats.freeBlocks++;
+}
+
+// =====================================================================================================================
+template <typename Allocator>
+void ObjectPool<Allocator>::ReleaseCmdBuffers(
+    const Pal::ICmdAllocator* pCmdAllocator)
+{
+    Util::MutexAuto lock(&m_lock);
+
+    Block** ppPrev = &m_pCachedCmdBuffers;
+
+    while (*ppPrev != nullptr)
+    {
+        Block*const pBlock = *ppPrev;
+
+        if ((pCmdAllocator == nullptr) || (pBlock->cmdBufferInfo.pCmdAllocator == pCmdAllocator))
+        {
+            *ppPrev = pBlock->pNext;
+            DestroyCachedCmdBuffer(pBlock);
+        }
+        else
+        {
+            ppPrev = &pBlock->pNext;
+        }
+    }
+}
+
+// =====================================================================================================================
+template <typename Allocator>
+void ObjectPool<Allocator>::Trim()
+{
+    ReleaseCmdBuffers(nullptr);
+
+    Util::MutexAuto lock(&m_lock);
+
+    for (Pal::uint32 type = 0; type < ObjectType::Count; ++type)
+    {
+        while (m_pFreeBlocks[type] != nullptr)
+        {
+            Block*const pBlock = m_pFreeBlocks[type];
+            m_pFreeBlocks[type] = pBlock->pNext;
+
+            PAL_FREE(pBlock, m_pAllocator);
+        }
+    }
+
+    m_stats.freeBlocks = 0;
+}
+
+// =====================================================================================================================
+template <typename Allocator>
+void ObjectPool<Allocator>::GetStats(
+    ObjectPoolStats* pStats
+    ) const
+{
+    Util::MutexAuto lock(&m_lock);
+
+    *pStats = m_stats;
+}
+
+} // GpuUtil
@@ -0,0 +1,130 @@
+/*
+ ***********************************************************************************************************************
+ *
+ *  Copyright (c) 2020 Advanced Micro Devices, Inc. All Rights Reserved.
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy
+ *  of this software and associated documentation files (the "Software"), to deal
+ *  in the Software without restriction, including without limitation the rights
+ *  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *  copies of the Software, and to permit persons to whom the Software is
+ *  furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in all
+ *  copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ *  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *  SOFTWARE.
+ *
+ **********************************************************************************************************************/
+/**
+ ***********************************************************************************************************************
+ * @file  palPerfCounterPassPlanner.h
+ * @brief PAL GPU utility PerfCounterPassPlanner class.
+ ***********************************************************************************************************************
+ */
+
+#pragma once
+
+#include "palGpaSession.h"
+
+namespace GpuUtil
+{
+
+/**
+***********************************************************************************************************************
+* @class PerfCounterPassPlanner
+* @brief Splits an arbitrary set of performance counters into the fewest GpaSession samples the hardware can collect.
+*
+* Each instance of a GPU block only has a handful of counter select registers, so a cumulative GpaSession sample fails
+* to begin if it asks for more counters from one block instance than @ref Pal::GpuBlockPerfProperties allows. The
+* planner checks a client's counter list against those limits and partitions it into passes: each pass is a counter
+* list which fits the hardware and can be given to GpaSession::BeginSample() as is. The number of passes is always the
+* minimum, which is set by the most oversubscribed block instance.
+*
+* The client records one sample per pass over the same workload and then calls GetResults(), which gathers the
+* per-pass results back into one array in the order of the original counter list.
+*
+* The planner is pure CPU logic; it never touches the device except through the properties given to Plan().
+***********************************************************************************************************************
+*/
+class PerfCounterPassPlanner
+{
+public:
+    /// Constructor.
+    ///
+    /// @param [in] pPlatform  The platform whose allocator is used for the plan.
+    explicit PerfCounterPassPlanner(Pal::IPlatform* pPlatform);
+    ~PerfCounterPassPlanner();
+
+    /// Partitions a counter list into passes, replacing any previous plan.
+    ///
+    /// @param [in] properties   Limits of the device the counters will be sampled on, from
+    ///                          IDevice::GetPerfExperimentProperties().
+    /// @param [in] counterType  Global for cumulative samples, Spm for streaming counters in trace samples.
+    /// @param [in] numCounters  Number of entries in pCounters.
+    /// @param [in] pCounters    Counters to sample.
+    ///
+    /// @returns Success if a plan was made. Otherwise, one of the following errors may be returned:
+    ///          + ErrorInvalidValue if a counter names an unavailable block, an out of range instance or event ID, or
+    ///            a block which has no counters of the requested type.
+    ///          + ErrorOutOfMemory if the plan could not be allocated.
+    Pal::Result Plan(
+        const Pal::PerfExperimentProperties& properties,
+        Pal::PerfCounterType                 counterType,
+        Pal::uint32                          numCounters,
+        const PerfCounterId*                 pCounters);
+
+    /// Returns the number of passes of the current plan.
+    Pal::uint32 NumPasses() const { return m_numPasses; }
+
+    /// Returns the counters to sample in one pass, suitable for GpaSampleConfig::perfCounters.
+    ///
+    /// @param [in]  pass          Pass index, less than NumPasses().
+    /// @param [out] pNumCounters  Number of counters in the returned list.
+    const PerfCounterId* GetPassCounters(Pal::uint32 pass, Pal::uint32* pNumCounters) const;
+
+    /// Returns the pass which samples the given counter of the list passed to Plan().
+    Pal::uint32 GetCounterPass(Pal::uint32 counterIndex) const { return m_pCounterPass[counterIndex]; }
+
+    /// Scatters the results of one cumulative pass into the merged result array.
+    ///
+    /// @param [in]  pass          Pass index, less than NumPasses().
+    /// @param [in]  pPassResults  Results of the pass's sample, in the order of GetPassCounters().
+    /// @param [out] pResults      Merged results, in the order of the list passed to Plan().
+    void MergePassResults(Pal::uint32 pass, const Pal::uint64* pPassResults, Pal::uint64* pResults) const;
+
+    /// Queries the cumulative results of every pass from a session and merges them.
+    ///
+    /// @param [in]  session     A session in the _ready_ state.
+    /// @param [in]  pSampleIds  The sample ID of each pass, NumPasses() entries.
+    /// @param [out] pResults    Merged results, one uint64 per counter passed to Plan(), in the same order.
+    ///
+    /// @returns Success if all passes were merged, otherwise the first error returned by GpaSession::GetResults().
+    Pal::Result GetResults(
+        const GpaSession&  session,
+        const Pal::uint32* pSampleIds,
+        Pal::uint64*       pResults) const;
+
+private:
+    void FreePlan();
+
+    Pal::IPlatform*const m_pPlatform;
+
+    Pal::uint32    m_numCounters;
+    Pal::uint32    m_numPasses;
+    PerfCounterId* m_pPassCounters;   // Counters of all passes, grouped by pass.
+    Pal::uint32*   m_pPassOffsets;    // Index of each pass's first counter in m_pPassCounters, plus the total count.
+    Pal::uint32*   m_pOriginalIndex;  // Position in the client's list of each entry of m_pPassCounters.
+    Pal::uint32*   m_pCounterPass;    // Pass of each counter in the client's list.
+
+    PAL_DISALLOW_DEFAULT_CTOR(PerfCounterPassPlanner);
+    PAL_DISALLOW_COPY_AND_ASSIGN(PerfCounterPassPlanner);
+};
+
+} // GpuUtil
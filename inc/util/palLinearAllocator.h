@@ -57,13 +57,19 @@ class VirtualLinearAllocator
 public:
     /// Constructor.
     ///
-    /// @param [in] size Maximum size, in bytes, of virtual memory that this allocator should reserve.
-    ///                  Does not need to be aligned to page size.
-    VirtualLinearAllocator(size_t size) :
+    /// @param [in] size         Maximum size, in bytes, of virtual memory that this allocator should reserve.
+    ///                          Does not need to be aligned to page size.
+    /// @param [in] useHugePages If true, memory is committed in huge-page sized steps which are backed by huge pages
+    ///                          if the OS supports them, and faulted in as soon as they are committed.  This trades
+    ///                          some memory for fewer TLB misses and page faults in allocators which grow large.
+    VirtualLinearAllocator(size_t size, bool useHugePages = false) :
         m_pStart(nullptr),
         m_pCurrent(nullptr),
         m_size(size),
-        m_pageSize(0) {}
+        m_pageSize(0),
+        m_commitSize(0),
+        m_useHugePages(useHugePages),
+        m_prefaultedBytes(0) {}
 
     /// Destructor.
     virtual ~VirtualLinearAllocator()
@@ -82,19 +88,24 @@ public:
     Result Init()
     {
         m_pageSize = VirtualPageSize();
-        m_size     = Pow2Align(m_size, m_pageSize);
 
-        Result result = VirtualReserve(m_size, &m_pStart);
+        // Fall back to regular pages if the OS can't give us huge pages.
+        const size_t hugePageSize = m_useHugePages ? VirtualHugePageSize() : 0;
+        m_useHugePages = (hugePageSize > m_pageSize);
+        m_commitSize   = m_useHugePages ? hugePageSize : m_pageSize;
+        m_size         = Pow2Align(m_size, m_commitSize);
+
+        Result result = VirtualReserve(m_size, &m_pStart, nullptr, m_commitSize);
 
         if (result == Result::_Success)
         {
-            result = VirtualCommit(m_pStart, m_pageSize);
+            result = Commit(m_pStart, m_commitSize);
         }
 
         if (result == Result::_Success)
         {
             m_pCurrent         = m_pStart;
-            m_pCommittedToPage = VoidPtrInc(m_pCurrent, m_pageSize);
+            m_pCommittedToPage = VoidPtrInc(m_pCurrent, m_commitSize);
         }
 
         return result;
@@ -109,13 +120,13 @@ public:
     {
         void* pAlignedCurrent = VoidPtrAlign(m_pCurrent, allocInfo.alignment);
         void* pNextCurrent    = VoidPtrInc(pAlignedCurrent, allocInfo.bytes);
-        void* pAlignedEnd     = VoidPtrAlign(pNextCurrent, m_pageSize);
+        void* pAlignedEnd     = VoidPtrAlign(pNextCurrent, m_commitSize);
 
         if (pAlignedEnd > m_pCommittedToPage)
         {
             const size_t commitBytes = VoidPtrDiff(pAlignedEnd, m_pCommittedToPage);
 
-            const Result result = VirtualCommit(m_pCommittedToPage, commitBytes);
+            const Result result = Commit(m_pCommittedToPage, commitBytes);
 
             if (result == Result::_Success)
             {
@@ -153,13 +164,14 @@ public:
         {
             if (decommit)
             {
-                void*        pStartPage   = VoidPtrAlign(VoidPtrInc(pStart, 1), m_pageSize);
-                void*        pCurrentPage = VoidPtrAlign(m_pCurrent, m_pageSize);
-                const size_t numPages     = VoidPtrDiff(pCurrentPage, pStartPage) / m_pageSize;
+                // Memory is decommitted in the same steps it was committed in.
+                void*        pStartPage   = VoidPtrAlign(VoidPtrInc(pStart, 1), m_commitSize);
+                void*        pCurrentPage = VoidPtrAlign(m_pCurrent, m_commitSize);
+                const size_t numPages     = VoidPtrDiff(pCurrentPage, pStartPage) / m_commitSize;
 
                 if (numPages > 0)
                 {
-                    Result result = VirtualDecommit(pStartPage, m_pageSize * numPages);
+                    Result result = VirtualDecommit(pStartPage, m_commitSize * numPages);
                     PAL_ASSERT(result == Result::_Success);
 
                     m_pCommittedToPage = pStartPage;
@@ -204,13 +216,38 @@ public:
     /// @returns The size of the remaining unallocated space in bytes.
     size_t Remaining() const { return m_size - VoidPtrDiff(m_pCurrent, m_pStart); }
 
+    /// Returns the number of pages which were faulted in when they were committed rather than on their first use.  This
+    /// is how many page faults huge page backing moved out of the allocator's users, or avoided entirely if the OS did
+    /// back the memory with huge pages.
+    ///
+    /// @returns Number of OS pages faulted in at commit time.
+    size_t PrefaultedPages() const { return (m_pageSize > 0) ? (m_prefaultedBytes / m_pageSize) : 0; }
+
 private:
+    // Commits a range of reserved memory and, if this allocator uses huge pages, faults it in.
+    Result Commit(void* pMem, size_t sizeInBytes)
+    {
+        Result result = VirtualCommit(pMem, sizeInBytes);
+
+        if ((result == Result::_Success) && m_useHugePages)
+        {
+            // Failing to get huge pages isn't fatal, the memory is still faulted in with regular pages.
+            VirtualPrefault(pMem, sizeInBytes, true);
+            m_prefaultedBytes += sizeInBytes;
+        }
+
+        return result;
+    }
+
     void*  m_pStart;            ///< Pointer to where the backing allocation starts.
     void*  m_pCurrent;          ///< Pointer to the current position of backing memory.
     void*  m_pCommittedToPage;  ///< Pointer to the end of the last committed page.
 
     size_t m_size;              ///< Size of the allocation.
     size_t m_pageSize;          ///< OS' defined page size.
+    size_t m_commitSize;        ///< Granularity in which memory is committed: a huge page or an OS page.
+    bool   m_useHugePages;      ///< True if committed memory is backed by huge pages and faulted in right away.
+    size_t m_prefaultedBytes;   ///< Number of bytes faulted in at commit time.
 
     PAL_DISALLOW_DEFAULT_CTOR(VirtualLinearAllocator);
     PAL_DISALLOW_COPY_AND_ASSIGN(VirtualLinearAllocator);
@@ -322,7 +359,8 @@ class VirtualLinearAllocatorWithNode : public VirtualLinearAllocator
 {
 public:
     /// Constructor.
-    VirtualLinearAllocatorWithNode(size_t size) : VirtualLinearAllocator(size), m_node(this) {}
+    VirtualLinearAllocatorWithNode(size_t size, bool useHugePages = false)
+        : VirtualLinearAllocator(size, useHugePages), m_node(this) {}
 
     /// Destructor.
     virtual ~VirtualLinearAllocatorWithNode() {}
@@ -324,6 +324,16 @@ extern uint64 AtomicExchange64(volatile uint64* pTarget, uint64 value);
 /// @returns Previous value at *ppTarget.
 extern void* AtomicExchangePointer(void*volatile* ppTarget, void* pValue);
 
+/// Performs an atomic compare and swap operation on a pair of pointers. This operation compares *ppTarget with pOld and
+/// replaces it with pNew if they match. If the values don't match, no action is taken.
+///
+/// @param [in,out] ppTarget Pointer to the destination pointer of the operation.
+/// @param [in]     pOld     Pointer to compare *ppTarget to.
+/// @param [in]     pNew     Pointer to replace *ppTarget with if *ppTarget matches pOld.
+///
+/// @returns Previous value at *ppTarget.
+extern void* AtomicCompareAndSwapPointer(void*volatile* ppTarget, void* pOld, void* pNew);
+
 /// Atomically add a value to the specific 32-bit unsigned integer.
 ///
 /// @param [in,out] pAddend Pointer to the value to be modified.
@@ -32,8 +32,10 @@
 #pragma once
 
 #include "palFile.h"
+#include "palHashMap.h"
 #include "palInlineFuncs.h"
 #include "palList.h"
+#include "palMutex.h"
 
 namespace Util
 {
@@ -50,7 +52,11 @@ namespace Util
  *        ; The following settings are pre-hashed.
  *        #0x9370a0c8, AnotherStringValue
  *
- *        After loading the file, a value can be retrieved by either specifying a setting string or hash value.
+ *        After loading the file, a value can be retrieved by either specifying a setting string or hash value.  The
+ *        values are indexed by setting hash when the file is loaded so each lookup is a single hash table probe.  If
+ *        a setting appears more than once, the first occurrence wins.
+ *
+ *        The file can be reloaded with Reload() while other threads are retrieving values.
  ***********************************************************************************************************************
  */
 template <typename Allocator>
@@ -64,8 +70,12 @@ public:
     SettingsFileMgr(const char* pSettingsFileName, Allocator*const pAllocator)
         :
         m_pSettingsFileName(pSettingsFileName),
-        m_settingsList(pAllocator)
+        m_settingsList(pAllocator),
+        m_settingsIndex(NumIndexBuckets, pAllocator),
+        m_contentHash(0),
+        m_loaded(false)
     {
+        m_filePath[0] = '\0';
     }
 
     /// Destroys the object and closes the associated file if it is still open.
@@ -107,6 +117,18 @@ public:
     ///          type; false otherwise.
     bool GetValueByHash(uint32 hashedName, ValueType type, void* pValue, size_t bufferSz = 0) const;
 
+    /// Re-reads the settings file which was found by Init() if its contents changed since it was last read.  Values
+    /// retrieved after this call returns reflect the new file contents.
+    ///
+    /// @param [out] pChanged Set to true if the file contents changed and the settings were reloaded.
+    ///
+    /// @returns Success if the file was checked (whether or not it changed).  ErrorUnavailable if Init() didn't load a
+    ///          settings file.  Other appropriate error codes are returned otherwise.
+    Result Reload(bool* pChanged);
+
+    /// Returns the path of the settings file which was loaded by Init(), or an empty string if none was found.
+    const char* GetFilePath() const { return &m_filePath[0]; }
+
 private:
     // Describes a single { setting, value } pair as loaded from a settings file.
     struct SettingValuePair
@@ -115,12 +137,27 @@ private:
         char   strValue[512];  // Value for this setting encoded as a C-stlye string.
     };
 
+    Result ParseFile();
+    Result HashFile(uint32* pContentHash);
+    void   ClearSettings();
+
+    // The setting index is sized for a few dozen overrides; buckets grow their entry groups on demand.
+    static constexpr uint32 NumIndexBuckets = 64;
+
     const char*const m_pSettingsFileName;
     File             m_settingsFile;
+    char             m_filePath[512];  // Absolute path of the loaded settings file.
 
     // List of setting, value pairs parsed from the config file.
     List<SettingValuePair, Allocator> m_settingsList;
 
+    // Maps each setting hash to its value string in m_settingsList.
+    HashMap<uint32, const char*, Allocator> m_settingsIndex;
+
+    uint32         m_contentHash;  // Hash of the settings file contents when they were last parsed.
+    bool           m_loaded;       // True once Init() has loaded a settings file.
+    mutable RWLock m_settingsLock; // Serializes Reload() against value lookups.
+
     PAL_DISALLOW_COPY_AND_ASSIGN(SettingsFileMgr);
 };
 
@@ -27,6 +27,7 @@
 
 #include "palSettingsFileMgr.h"
 #include "palDbgPrint.h"
+#include "palHashMapImpl.h"
 #include "palListImpl.h"
 #include <string.h>
 #include <ctype.h>
@@ -38,6 +39,16 @@ namespace Util
 template <typename Allocator>
 SettingsFileMgr<Allocator>::~SettingsFileMgr()
 {
+    ClearSettings();
+}
+
+// =====================================================================================================================
+// Removes all parsed settings and their index entries.
+template <typename Allocator>
+void SettingsFileMgr<Allocator>::ClearSettings()
+{
+    m_settingsIndex.Reset();
+
     // Clean up the settings list
     auto i = m_settingsList.Begin();
     while (i.Get() != nullptr)
@@ -77,7 +88,7 @@ Result SettingsFileMgr<Allocator>::Init(
         }
         else
         {
-            ret = m_settingsFile.Open(&fallbackFileAbsPath[0], FileAccessRead);
+            Strncpy(&m_filePath[0], &fallbackFileAbsPath[0], sizeof(m_filePath));
         }
 #else
         ret = Result::ErrorUnavailable;
@@ -85,10 +96,45 @@ Result SettingsFileMgr<Allocator>::Init(
     }
     else
     {
-        // Open the config file for read-only access
-        ret = m_settingsFile.Open(&fileAbsPath[0], FileAccessRead);
+        Strncpy(&m_filePath[0], &fileAbsPath[0], sizeof(m_filePath));
+    }
+
+    if ((ret == Result::Success) && (m_loaded == false))
+    {
+        ret = m_settingsLock.Init();
+
+        if (ret == Result::Success)
+        {
+            ret = m_settingsIndex.Init();
+        }
     }
 
+    if (ret == Result::Success)
+    {
+        ret = ParseFile();
+    }
+
+    if (ret == Result::Success)
+    {
+        ret      = HashFile(&m_contentHash);
+        m_loaded = (ret == Result::Success);
+    }
+    else
+    {
+        m_filePath[0] = '\0';
+    }
+
+    return ret;
+}
+
+// =====================================================================================================================
+// Reads all settings from the file at m_filePath into the settings list and index.
+template <typename Allocator>
+Result SettingsFileMgr<Allocator>::ParseFile()
+{
+    // Open the config file for read-only access
+    Result ret = m_settingsFile.Open(&m_filePath[0], FileAccessRead);
+
     if (ret == Result::Success)
     {
         // Read the settings file one line at a time
@@ -154,7 +200,16 @@ Result SettingsFileMgr<Allocator>::Init(
                             SettingValuePair pair = { hashedName, {0} };
                             PAL_ASSERT(strlen(pToken) < sizeof(pair.strValue));
                             strncpy(&pair.strValue[0], pToken, sizeof(pair.strValue));
-                            m_settingsList.PushBack(pair);
+
+                            // Only index the first occurrence of each setting so lookups match the file order.
+                            if ((m_settingsIndex.FindKey(hashedName) == nullptr) &&
+                                (m_settingsList.PushBack(pair) == Result::Success))
+                            {
+                                auto lastIter = m_settingsList.End();
+                                lastIter.Prev();
+
+                                ret = m_settingsIndex.Insert(hashedName, &lastIter.Get()->strValue[0]);
+                            }
                         }
                     }
                 }
@@ -204,28 +259,87 @@ bool SettingsFileMgr<Allocator>::GetValueByHash(
 {
     bool foundValue = false;
 
-    // Get the value from the list
-    auto iterator = m_settingsList.Begin();
-    const char* pSettingValue = nullptr;
-    while(iterator.Get() != nullptr)
+    if (m_loaded)
     {
-        if (iterator.Get()->hashName == hashedName)
+        RWLockAuto<RWLock::ReadOnly> lock(&m_settingsLock);
+
+        // Get the value from the index
+        const char*const* ppSettingValue = m_settingsIndex.FindKey(hashedName);
+
+        if (ppSettingValue != nullptr)
         {
-            pSettingValue = &iterator.Get()->strValue[0];
-            break;
+            // Indicate we found the value being requested
+            foundValue = true;
+            // Then convert it to the correct type and return
+            StringToValueType(*ppSettingValue, type, bufferSz, pValue);
         }
-        iterator.Next();
     }
 
-    if(pSettingValue != nullptr)
+    return foundValue;
+}
+
+// =====================================================================================================================
+// Computes an FNV1a hash of the whole settings file so Reload() can cheaply tell whether it changed.
+template <typename Allocator>
+Result SettingsFileMgr<Allocator>::HashFile(
+    uint32* pContentHash)
+{
+    static constexpr uint32 FnvPrime  = 16777619u;
+    static constexpr uint32 FnvOffset = 2166136261u;
+
+    Result ret = m_settingsFile.Open(&m_filePath[0], FileAccessRead);
+
+    if (ret == Result::Success)
     {
-        // Indicate we found the value being requested
-        foundValue = true;
-        // Then convert it to the correct type and return
-        StringToValueType(pSettingValue, type, bufferSz, pValue);
+        uint32 hash      = FnvOffset;
+        uint8  buffer[256];
+        size_t bytesRead = 0;
+
+        while ((m_settingsFile.Read(&buffer[0], sizeof(buffer), &bytesRead) == Result::Success) && (bytesRead > 0))
+        {
+            for (size_t i = 0; i < bytesRead; i++)
+            {
+                hash ^= buffer[i];
+                hash *= FnvPrime;
+            }
+        }
+
+        m_settingsFile.Close();
+
+        *pContentHash = hash;
     }
 
-    return foundValue;
+    return ret;
+}
+
+// =====================================================================================================================
+// Re-parses the settings file if its contents changed since it was last parsed.
+template <typename Allocator>
+Result SettingsFileMgr<Allocator>::Reload(
+    bool* pChanged)
+{
+    Result ret = Result::ErrorUnavailable;
+
+    *pChanged = false;
+
+    if (m_loaded)
+    {
+        uint32 contentHash = 0;
+        ret = HashFile(&contentHash);
+
+        if ((ret == Result::Success) && (contentHash != m_contentHash))
+        {
+            RWLockAuto<RWLock::ReadWrite> lock(&m_settingsLock);
+
+            ClearSettings();
+            ret = ParseFile();
+
+            m_contentHash = contentHash;
+            *pChanged     = true;
+        }
+    }
+
+    return ret;
 }
 
 } // Util
@@ -537,6 +537,28 @@ private:
 /// @return  The OS-specific size, in bytes, of a page.
 extern size_t VirtualPageSize();
 
+/// Returns the size of the huge pages which the OS can transparently back virtual memory with.
+///
+/// @return  The size, in bytes, of a huge page or zero if the OS can't back virtual memory with huge pages.
+extern size_t VirtualHugePageSize();
+
+/// Faults in the specified range of committed memory right away, so that the first access to each page doesn't have to
+/// page fault later on.  The contents of the memory are preserved.
+///
+/// @param [in]  pMem         Pointer to the start of committed memory. Must be aligned to the page size returned from
+///                           @ref Util::VirtualPageSize();
+/// @param [in]  sizeInBytes  Size in bytes of the memory to fault in. Must be aligned to the page size returned from
+///                           @ref Util::VirtualPageSize();
+/// @param [in]  useHugePages If true, asks the OS to back the memory with huge pages before faulting it in.  Only the
+///                           parts of the range which are aligned to @ref Util::VirtualHugePageSize() can use them.
+///
+/// @returns Success if the memory was faulted in (using huge pages if requested and supported).
+///          Otherwise:
+///             - Unsupported if huge pages were requested but the OS refused them; the memory is still faulted in.
+///             - ErrorInvalidValue if sizeInBytes is zero.
+///             - ErrorInvalidPointer if pMem is null.
+extern Result VirtualPrefault(void* pMem, size_t sizeInBytes, bool useHugePages);
+
 /// Reserves the specified amount of virtual address space.
 ///
 /// @param [in]  sizeInBytes Size in bytes of the requested reservation. Must be aligned to the page size returned from
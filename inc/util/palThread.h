@@ -116,6 +116,12 @@ private:
 typedef pthread_key_t ThreadLocalKey;
 #endif
 
+/// Returns an identifier for the calling thread which is unique among the threads currently alive in this process.
+/// Identifiers may be reused once a thread exits.
+///
+/// @returns The calling thread's identifier.
+extern uint64 GetIdOfCurrentThread();
+
 /// Defines the destructor called when the thread exits.
 typedef void (*ThreadLocalDestructor)(void*);
 
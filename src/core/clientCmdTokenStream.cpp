@@ -0,0 +1,574 @@
+/*
+ ***********************************************************************************************************************
+ *
+ *  Copyright (c) 2020 Advanced Micro Devices, Inc. All Rights Reserved.
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy
+ *  of this software and associated documentation files (the "Software"), to deal
+ *  in the Software without restriction, including without limitation the rights
+ *  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *  copies of the Software, and to permit persons to whom the Software is
+ *  furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in all
+ *  copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ *  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *  SOFTWARE.
+ *
+ **********************************************************************************************************************/
+
+#include "core/clientCmdTokenStream.h"
+#include "palInlineFuncs.h"
+
+#if PAL_CLIENT_INTERFACE_MAJOR_VERSION >= 642
+using namespace Util;
+
+namespace Pal
+{
+
+// Size of the token storage when the client doesn't specify one.  It holds a few hundred typical draws.
+constexpr size_t DefaultTokenStreamSize = 16 * 1024;
+
+// Number of patched user data entries which are gathered on the stack and set with one CmdSetUserData() call.
+constexpr uint32 PatchedUserDataBatchSize = 16;
+
+// =====================================================================================================================
+ClientCmdTokenStream::ClientCmdTokenStream(
+    IPlatform*                      pPlatform,
+    const CmdTokenStreamCreateInfo& createInfo)
+    :
+    m_tokens(pPlatform, (createInfo.initialSize != 0) ? createInfo.initialSize : DefaultTokenStreamSize),
+    m_patchSlotCount(0),
+    m_recordResult(Result::Success),
+    m_isRecording(false),
+    m_isReplayable(false)
+{
+}
+
+// =====================================================================================================================
+// Discards the previous recording and starts a new one.
+// NOTE: Part of the public ICmdTokenStream interface.
+Result ClientCmdTokenStream::Begin()
+{
+    m_tokens.Reset();
+
+    m_patchSlotCount = 0;
+    m_recordResult   = Result::Success;
+    m_isRecording    = true;
+    m_isReplayable   = false;
+
+    return m_tokens.GetResult();
+}
+
+// =====================================================================================================================
+// Finishes the current recording.  The stream can only be replayed if every call was stored.
+// NOTE: Part of the public ICmdTokenStream interface.
+Result ClientCmdTokenStream::End()
+{
+    PAL_ASSERT(m_isRecording);
+
+    const Result result = (m_recordResult != Result::Success) ? m_recordResult : m_tokens.GetResult();
+
+    m_isRecording  = false;
+    m_isReplayable = (result == Result::Success);
+
+    return result;
+}
+
+// =====================================================================================================================
+// A call made outside of a recording still lands in the token storage, so the stream can't be replayed again until the
+// next Begin() discards it.
+void ClientCmdTokenStream::InsertToken(
+    TokenId token)
+{
+    if (m_isRecording == false)
+    {
+        RejectRecording(Result::ErrorUnavailable);
+        m_isReplayable = false;
+    }
+
+    m_tokens.Insert(token);
+}
+
+// =====================================================================================================================
+// Flags a call which the stream couldn't record faithfully.  Only the first error is kept, and End() reports it.
+void ClientCmdTokenStream::RejectRecording(
+    Result result)
+{
+    PAL_ALERT_ALWAYS();
+
+    if (m_recordResult == Result::Success)
+    {
+        m_recordResult = result;
+    }
+}
+
+// =====================================================================================================================
+// Grows the number of patch values each replay must supply to cover the given patch slots.
+void ClientCmdTokenStream::UsePatchSlots(
+    uint32 firstPatchSlot,
+    uint32 count)
+{
+    m_patchSlotCount = Max(m_patchSlotCount, firstPatchSlot + count);
+}
+
+// =====================================================================================================================
+void ClientCmdTokenStream::CmdBindPipeline(
+    const PipelineBindParams& params)
+{
+    InsertToken(TokenId::BindPipeline);
+    m_tokens.Insert(params);
+}
+
+// =====================================================================================================================
+void ClientCmdTokenStream::CmdBindMsaaState(
+    const IMsaaState* pMsaaState)
+{
+    InsertToken(TokenId::BindMsaaState);
+    m_tokens.Insert(pMsaaState);
+}
+
+// =====================================================================================================================
+void ClientCmdTokenStream::CmdBindColorBlendState(
+    const IColorBlendState* pColorBlendState)
+{
+    InsertToken(TokenId::BindColorBlendState);
+    m_tokens.Insert(pColorBlendState);
+}
+
+// =====================================================================================================================
+void ClientCmdTokenStream::CmdBindDepthStencilState(
+    const IDepthStencilState* pDepthStencilState)
+{
+    InsertToken(TokenId::BindDepthStencilState);
+    m_tokens.Insert(pDepthStencilState);
+}
+
+// =====================================================================================================================
+void ClientCmdTokenStream::CmdSetViewports(
+    const ViewportParams& params)
+{
+    InsertToken(TokenId::SetViewports);
+    m_tokens.Insert(params);
+}
+
+// =====================================================================================================================
+void ClientCmdTokenStream::CmdSetScissorRects(
+    const ScissorRectParams& params)
+{
+    InsertToken(TokenId::SetScissorRects);
+    m_tokens.Insert(params);
+}
+
+// =====================================================================================================================
+void ClientCmdTokenStream::CmdBindTargets(
+    const BindTargetParams& params)
+{
+    InsertToken(TokenId::BindTargets);
+    m_tokens.Insert(params);
+}
+
+// =====================================================================================================================
+void ClientCmdTokenStream::CmdSetVertexBuffers(
+    uint32                firstBuffer,
+    uint32                bufferCount,
+    const BufferViewInfo* pBuffers)
+{
+    InsertToken(TokenId::SetVertexBuffers);
+    m_tokens.Insert(firstBuffer);
+    m_tokens.InsertArray(pBuffers, bufferCount);
+}
+
+// =====================================================================================================================
+// The arrays referenced by the barrier are copied into the stream.  Custom sample patterns are client memory which the
+// stream has no way to copy alongside their transition, so barriers using them are rejected.
+void ClientCmdTokenStream::CmdBarrier(
+    const BarrierInfo& barrierInfo)
+{
+    for (uint32 idx = 0; idx < barrierInfo.transitionCount; idx++)
+    {
+        if (barrierInfo.pTransitions[idx].imageInfo.pQuadSamplePattern != nullptr)
+        {
+            RejectRecording(Result::ErrorInvalidValue);
+            break;
+        }
+    }
+
+    InsertToken(TokenId::Barrier);
+    m_tokens.Insert(barrierInfo);
+    m_tokens.InsertArray(barrierInfo.pPipePoints,  barrierInfo.pipePointWaitCount);
+    m_tokens.InsertArray(barrierInfo.ppGpuEvents,  barrierInfo.gpuEventWaitCount);
+    m_tokens.InsertArray(barrierInfo.ppTargets,    barrierInfo.rangeCheckedTargetWaitCount);
+    m_tokens.InsertArray(barrierInfo.pTransitions, barrierInfo.transitionCount);
+}
+
+// =====================================================================================================================
+void ClientCmdTokenStream::CmdSetUserData(
+    PipelineBindPoint bindPoint,
+    uint32            firstEntry,
+    uint32            entryCount,
+    const uint32*     pEntryValues)
+{
+    InsertToken(TokenId::SetUserData);
+    m_tokens.Insert(bindPoint);
+    m_tokens.Insert(firstEntry);
+    m_tokens.InsertArray(pEntryValues, entryCount);
+}
+
+// =====================================================================================================================
+void ClientCmdTokenStream::CmdSetPatchedUserData(
+    PipelineBindPoint bindPoint,
+    uint32            firstEntry,
+    uint32            entryCount,
+    uint32            firstPatchSlot)
+{
+    InsertToken(TokenId::SetPatchedUserData);
+    m_tokens.Insert(bindPoint);
+    m_tokens.Insert(firstEntry);
+    m_tokens.Insert(entryCount);
+    m_tokens.Insert(firstPatchSlot);
+
+    UsePatchSlots(firstPatchSlot, entryCount);
+}
+
+// =====================================================================================================================
+void ClientCmdTokenStream::CmdSetPatchedGpuAddress(
+    PipelineBindPoint bindPoint,
+    uint32            firstEntry,
+    uint32            patchSlot)
+{
+    InsertToken(TokenId::SetPatchedGpuAddress);
+    m_tokens.Insert(bindPoint);
+    m_tokens.Insert(firstEntry);
+    m_tokens.Insert(patchSlot);
+
+    UsePatchSlots(patchSlot, 1);
+}
+
+// =====================================================================================================================
+void ClientCmdTokenStream::CmdBindIndexData(
+    gpusize   gpuAddr,
+    uint32    indexCount,
+    IndexType indexType)
+{
+    InsertToken(TokenId::BindIndexData);
+    m_tokens.Insert(gpuAddr);
+    m_tokens.Insert(indexCount);
+    m_tokens.Insert(indexType);
+}
+
+// =====================================================================================================================
+void ClientCmdTokenStream::CmdBindPatchedIndexData(
+    uint32    patchSlot,
+    uint32    indexCount,
+    IndexType indexType)
+{
+    InsertToken(TokenId::BindPatchedIndexData);
+    m_tokens.Insert(patchSlot);
+    m_tokens.Insert(indexCount);
+    m_tokens.Insert(indexType);
+
+    UsePatchSlots(patchSlot, 1);
+}
+
+// =====================================================================================================================
+void ClientCmdTokenStream::CmdDraw(
+    uint32 firstVertex,
+    uint32 vertexCount,
+    uint32 firstInstance,
+    uint32 instanceCount,
+    uint32 drawId)
+{
+    InsertToken(TokenId::Draw);
+    m_tokens.Insert(firstVertex);
+    m_tokens.Insert(vertexCount);
+    m_tokens.Insert(firstInstance);
+    m_tokens.Insert(instanceCount);
+    m_tokens.Insert(drawId);
+}
+
+// =====================================================================================================================
+void ClientCmdTokenStream::CmdDrawIndexed(
+    uint32 firstIndex,
+    uint32 indexCount,
+    int32  vertexOffset,
+    uint32 firstInstance,
+    uint32 instanceCount,
+    uint32 drawId)
+{
+    InsertToken(TokenId::DrawIndexed);
+    m_tokens.Insert(firstIndex);
+    m_tokens.Insert(indexCount);
+    m_tokens.Insert(vertexOffset);
+    m_tokens.Insert(firstInstance);
+    m_tokens.Insert(instanceCount);
+    m_tokens.Insert(drawId);
+}
+
+// =====================================================================================================================
+void ClientCmdTokenStream::CmdDrawIndirectMulti(
+    const IGpuMemory& gpuMemory,
+    gpusize           offset,
+    uint32            stride,
+    uint32            maximumCount,
+    gpusize           countGpuAddr)
+{
+    InsertToken(TokenId::DrawIndirectMulti);
+    m_tokens.Insert(&gpuMemory);
+    m_tokens.Insert(offset);
+    m_tokens.Insert(stride);
+    m_tokens.Insert(maximumCount);
+    m_tokens.Insert(countGpuAddr);
+}
+
+// =====================================================================================================================
+void ClientCmdTokenStream::CmdDrawIndexedIndirectMulti(
+    const IGpuMemory& gpuMemory,
+    gpusize           offset,
+    uint32            stride,
+    uint32            maximumCount,
+    gpusize           countGpuAddr)
+{
+    InsertToken(TokenId::DrawIndexedIndirectMulti);
+    m_tokens.Insert(&gpuMemory);
+    m_tokens.Insert(offset);
+    m_tokens.Insert(stride);
+    m_tokens.Insert(maximumCount);
+    m_tokens.Insert(countGpuAddr);
+}
+
+// =====================================================================================================================
+void ClientCmdTokenStream::CmdDispatchIndirect(
+    const IGpuMemory& gpuMemory,
+    gpusize           offset)
+{
+    InsertToken(TokenId::DispatchIndirect);
+    m_tokens.Insert(&gpuMemory);
+    m_tokens.Insert(offset);
+}
+
+// =====================================================================================================================
+void ClientCmdTokenStream::CmdDispatch(
+    uint32 x,
+    uint32 y,
+    uint32 z)
+{
+    InsertToken(TokenId::Dispatch);
+    m_tokens.Insert(x);
+    m_tokens.Insert(y);
+    m_tokens.Insert(z);
+}
+
+// =====================================================================================================================
+// Issues the recorded calls on the given command buffer, substituting this replay's patch values.  Only the local
+// reader advances, so any number of threads may replay the stream at once.
+// NOTE: Part of the public ICmdTokenStream interface.
+Result ClientCmdTokenStream::Replay(
+    ICmdBuffer*   pCmdBuffer,
+    uint32        patchValueCount,
+    const uint64* pPatchValues
+    ) const
+{
+    Result result = Result::Success;
+
+    if (m_isRecording || (m_isReplayable == false))
+    {
+        result = Result::ErrorUnavailable;
+    }
+    else if ((pCmdBuffer == nullptr) || ((m_patchSlotCount > 0) && (pPatchValues == nullptr)))
+    {
+        result = Result::ErrorInvalidPointer;
+    }
+    else if (patchValueCount < m_patchSlotCount)
+    {
+        result = Result::ErrorInvalidValue;
+    }
+
+    if (result == Result::Success)
+    {
+        CmdTokenStream::Reader reader(m_tokens);
+
+        while ((result == Result::Success) && (reader.IsAtEnd() == false))
+        {
+            const TokenId token = reader.Read<TokenId>();
+
+            switch (token)
+            {
+            case TokenId::BindPipeline:
+                pCmdBuffer->CmdBindPipeline(reader.Read<PipelineBindParams>());
+                break;
+            case TokenId::BindMsaaState:
+                pCmdBuffer->CmdBindMsaaState(reader.Read<const IMsaaState*>());
+                break;
+            case TokenId::BindColorBlendState:
+                pCmdBuffer->CmdBindColorBlendState(reader.Read<const IColorBlendState*>());
+                break;
+            case TokenId::BindDepthStencilState:
+                pCmdBuffer->CmdBindDepthStencilState(reader.Read<const IDepthStencilState*>());
+                break;
+            case TokenId::SetViewports:
+                pCmdBuffer->CmdSetViewports(reader.Read<ViewportParams>());
+                break;
+            case TokenId::SetScissorRects:
+                pCmdBuffer->CmdSetScissorRects(reader.Read<ScissorRectParams>());
+                break;
+            case TokenId::BindTargets:
+                pCmdBuffer->CmdBindTargets(reader.Read<BindTargetParams>());
+                break;
+            case TokenId::SetVertexBuffers:
+            {
+                const uint32          firstBuffer = reader.Read<uint32>();
+                const BufferViewInfo* pBuffers    = nullptr;
+                const uint32          bufferCount = reader.ReadArray(&pBuffers);
+
+                pCmdBuffer->CmdSetVertexBuffers(firstBuffer, bufferCount, pBuffers);
+                break;
+            }
+            case TokenId::Barrier:
+            {
+                BarrierInfo barrierInfo                 = reader.Read<BarrierInfo>();
+                barrierInfo.pipePointWaitCount          = reader.ReadArray(&barrierInfo.pPipePoints);
+                barrierInfo.gpuEventWaitCount           = reader.ReadArray(&barrierInfo.ppGpuEvents);
+                barrierInfo.rangeCheckedTargetWaitCount = reader.ReadArray(&barrierInfo.ppTargets);
+                barrierInfo.transitionCount             = reader.ReadArray(&barrierInfo.pTransitions);
+
+                pCmdBuffer->CmdBarrier(barrierInfo);
+                break;
+            }
+            case TokenId::SetUserData:
+            {
+                const PipelineBindPoint bindPoint    = reader.Read<PipelineBindPoint>();
+                const uint32            firstEntry   = reader.Read<uint32>();
+                const uint32*           pEntryValues = nullptr;
+                const uint32            entryCount   = reader.ReadArray(&pEntryValues);
+
+                pCmdBuffer->CmdSetUserData(bindPoint, firstEntry, entryCount, pEntryValues);
+                break;
+            }
+            case TokenId::SetPatchedUserData:
+            {
+                const PipelineBindPoint bindPoint      = reader.Read<PipelineBindPoint>();
+                const uint32            firstEntry     = reader.Read<uint32>();
+                const uint32            entryCount     = reader.Read<uint32>();
+                const uint32            firstPatchSlot = reader.Read<uint32>();
+
+                uint32 entryValues[PatchedUserDataBatchSize];
+                for (uint32 entry = 0; entry < entryCount; entry += PatchedUserDataBatchSize)
+                {
+                    const uint32 batchCount = Min(PatchedUserDataBatchSize, entryCount - entry);
+                    for (uint32 idx = 0; idx < batchCount; idx++)
+                    {
+                        entryValues[idx] = LowPart(pPatchValues[firstPatchSlot + entry + idx]);
+                    }
+
+                    pCmdBuffer->CmdSetUserData(bindPoint, firstEntry + entry, batchCount, entryValues);
+                }
+                break;
+            }
+            case TokenId::SetPatchedGpuAddress:
+            {
+                const PipelineBindPoint bindPoint  = reader.Read<PipelineBindPoint>();
+                const uint32            firstEntry = reader.Read<uint32>();
+                const uint64            gpuAddr    = pPatchValues[reader.Read<uint32>()];
+                const uint32            entryValues[2] = { LowPart(gpuAddr), HighPart(gpuAddr) };
+
+                pCmdBuffer->CmdSetUserData(bindPoint, firstEntry, 2, entryValues);
+                break;
+            }
+            case TokenId::BindIndexData:
+            {
+                const gpusize   gpuAddr    = reader.Read<gpusize>();
+                const uint32    indexCount = reader.Read<uint32>();
+                const IndexType indexType  = reader.Read<IndexType>();
+
+                pCmdBuffer->CmdBindIndexData(gpuAddr, indexCount, indexType);
+                break;
+            }
+            case TokenId::BindPatchedIndexData:
+            {
+                const gpusize   gpuAddr    = pPatchValues[reader.Read<uint32>()];
+                const uint32    indexCount = reader.Read<uint32>();
+                const IndexType indexType  = reader.Read<IndexType>();
+
+                pCmdBuffer->CmdBindIndexData(gpuAddr, indexCount, indexType);
+                break;
+            }
+            case TokenId::Draw:
+            {
+                const uint32 firstVertex   = reader.Read<uint32>();
+                const uint32 vertexCount   = reader.Read<uint32>();
+                const uint32 firstInstance = reader.Read<uint32>();
+                const uint32 instanceCount = reader.Read<uint32>();
+                const uint32 drawId        = reader.Read<uint32>();
+
+                pCmdBuffer->CmdDraw(firstVertex, vertexCount, firstInstance, instanceCount, drawId);
+                break;
+            }
+            case TokenId::DrawIndexed:
+            {
+                const uint32 firstIndex    = reader.Read<uint32>();
+                const uint32 indexCount    = reader.Read<uint32>();
+                const int32  vertexOffset  = reader.Read<int32>();
+                const uint32 firstInstance = reader.Read<uint32>();
+                const uint32 instanceCount = reader.Read<uint32>();
+                const uint32 drawId        = reader.Read<uint32>();
+
+                pCmdBuffer->CmdDrawIndexed(firstIndex, indexCount, vertexOffset, firstInstance, instanceCount, drawId);
+                break;
+            }
+            case TokenId::DrawIndirectMulti:
+            case TokenId::DrawIndexedIndirectMulti:
+            {
+                const IGpuMemory* pGpuMemory   = reader.Read<const IGpuMemory*>();
+                const gpusize     offset       = reader.Read<gpusize>();
+                const uint32      stride       = reader.Read<uint32>();
+                const uint32      maximumCount = reader.Read<uint32>();
+                const gpusize     countGpuAddr = reader.Read<gpusize>();
+
+                if (token == TokenId::DrawIndirectMulti)
+                {
+                    pCmdBuffer->CmdDrawIndirectMulti(*pGpuMemory, offset, stride, maximumCount, countGpuAddr);
+                }
+                else
+                {
+                    pCmdBuffer->CmdDrawIndexedIndirectMulti(*pGpuMemory, offset, stride, maximumCount, countGpuAddr);
+                }
+                break;
+            }
+            case TokenId::DispatchIndirect:
+            {
+                const IGpuMemory* pGpuMemory = reader.Read<const IGpuMemory*>();
+                const gpusize     offset     = reader.Read<gpusize>();
+
+                pCmdBuffer->CmdDispatchIndirect(*pGpuMemory, offset);
+                break;
+            }
+            case TokenId::Dispatch:
+            {
+                const uint32 x = reader.Read<uint32>();
+                const uint32 y = reader.Read<uint32>();
+                const uint32 z = reader.Read<uint32>();
+
+                pCmdBuffer->CmdDispatch(x, y, z);
+                break;
+            }
+            default:
+                // The recording is corrupt; stop rather than interpret the rest of it.
+                PAL_ASSERT_ALWAYS();
+                result = Result::ErrorUnknown;
+                break;
+            }
+        }
+    }
+
+    return result;
+}
+
+} // Pal
+#endif
@@ -0,0 +1,152 @@
+/*
+ ***********************************************************************************************************************
+ *
+ *  Copyright (c) 2020 Advanced Micro Devices, Inc. All Rights Reserved.
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy
+ *  of this software and associated documentation files (the "Software"), to deal
+ *  in the Software without restriction, including without limitation the rights
+ *  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *  copies of the Software, and to permit persons to whom the Software is
+ *  furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in all
+ *  copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ *  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *  SOFTWARE.
+ *
+ **********************************************************************************************************************/
+
+#pragma once
+
+#include "palCmdTokenStream.h"
+#include "core/cmdTokenStream.h"
+
+#if PAL_CLIENT_INTERFACE_MAJOR_VERSION >= 642
+namespace Pal
+{
+
+// =====================================================================================================================
+// Core implementation of ICmdTokenStream.  Recorded calls are stored in a CmdTokenStream and replayed through a
+// CmdTokenStream::Reader owned by each Replay() call, so concurrent replays never share state.  See ICmdTokenStream
+// documentation for more details.
+class ClientCmdTokenStream : public ICmdTokenStream
+{
+public:
+    ClientCmdTokenStream(IPlatform* pPlatform, const CmdTokenStreamCreateInfo& createInfo);
+    virtual ~ClientCmdTokenStream() { }
+
+    virtual void Destroy() override { this->~ClientCmdTokenStream(); }
+
+    virtual Result Begin() override;
+    virtual Result End() override;
+
+    virtual void CmdBindPipeline(const PipelineBindParams& params) override;
+    virtual void CmdBindMsaaState(const IMsaaState* pMsaaState) override;
+    virtual void CmdBindColorBlendState(const IColorBlendState* pColorBlendState) override;
+    virtual void CmdBindDepthStencilState(const IDepthStencilState* pDepthStencilState) override;
+    virtual void CmdSetViewports(const ViewportParams& params) override;
+    virtual void CmdSetScissorRects(const ScissorRectParams& params) override;
+    virtual void CmdBindTargets(const BindTargetParams& params) override;
+    virtual void CmdSetVertexBuffers(uint32 firstBuffer, uint32 bufferCount, const BufferViewInfo* pBuffers) override;
+    virtual void CmdBarrier(const BarrierInfo& barrierInfo) override;
+    virtual void CmdSetUserData(
+        PipelineBindPoint bindPoint,
+        uint32            firstEntry,
+        uint32            entryCount,
+        const uint32*     pEntryValues) override;
+    virtual void CmdSetPatchedUserData(
+        PipelineBindPoint bindPoint,
+        uint32            firstEntry,
+        uint32            entryCount,
+        uint32            firstPatchSlot) override;
+    virtual void CmdSetPatchedGpuAddress(
+        PipelineBindPoint bindPoint,
+        uint32            firstEntry,
+        uint32            patchSlot) override;
+    virtual void CmdBindIndexData(gpusize gpuAddr, uint32 indexCount, IndexType indexType) override;
+    virtual void CmdBindPatchedIndexData(uint32 patchSlot, uint32 indexCount, IndexType indexType) override;
+    virtual void CmdDraw(
+        uint32 firstVertex,
+        uint32 vertexCount,
+        uint32 firstInstance,
+        uint32 instanceCount,
+        uint32 drawId) override;
+    virtual void CmdDrawIndexed(
+        uint32 firstIndex,
+        uint32 indexCount,
+        int32  vertexOffset,
+        uint32 firstInstance,
+        uint32 instanceCount,
+        uint32 drawId) override;
+    virtual void CmdDrawIndirectMulti(
+        const IGpuMemory& gpuMemory,
+        gpusize           offset,
+        uint32            stride,
+        uint32            maximumCount,
+        gpusize           countGpuAddr) override;
+    virtual void CmdDrawIndexedIndirectMulti(
+        const IGpuMemory& gpuMemory,
+        gpusize           offset,
+        uint32            stride,
+        uint32            maximumCount,
+        gpusize           countGpuAddr) override;
+    virtual void CmdDispatch(uint32 x, uint32 y, uint32 z) override;
+    virtual void CmdDispatchIndirect(const IGpuMemory& gpuMemory, gpusize offset) override;
+
+    virtual uint32 GetPatchSlotCount() const override { return m_patchSlotCount; }
+
+    virtual Result Replay(
+        ICmdBuffer*   pCmdBuffer,
+        uint32        patchValueCount,
+        const uint64* pPatchValues) const override;
+
+private:
+    // Identifies each recorded call.  Every token is followed by the arguments of its call.
+    enum class TokenId : uint32
+    {
+        BindPipeline,
+        BindMsaaState,
+        BindColorBlendState,
+        BindDepthStencilState,
+        SetViewports,
+        SetScissorRects,
+        BindTargets,
+        SetVertexBuffers,
+        Barrier,
+        SetUserData,
+        SetPatchedUserData,
+        SetPatchedGpuAddress,
+        BindIndexData,
+        BindPatchedIndexData,
+        Draw,
+        DrawIndexed,
+        DrawIndirectMulti,
+        DrawIndexedIndirectMulti,
+        Dispatch,
+        DispatchIndirect,
+    };
+
+    void InsertToken(TokenId token);
+    void UsePatchSlots(uint32 firstPatchSlot, uint32 count);
+    void RejectRecording(Result result);
+
+    CmdTokenStream m_tokens;
+    uint32         m_patchSlotCount; // One more than the highest patch slot referenced by the current recording.
+    Result         m_recordResult;   // First error hit by a call of the current recording, other than running out of
+                                     // token storage.
+    bool           m_isRecording;    // Set between Begin() and End().
+    bool           m_isReplayable;   // Set by End() if every call of the recording was stored.
+
+    PAL_DISALLOW_DEFAULT_CTOR(ClientCmdTokenStream);
+    PAL_DISALLOW_COPY_AND_ASSIGN(ClientCmdTokenStream);
+};
+
+} // Pal
+#endif
@@ -100,6 +100,7 @@ CmdAllocator::CmdAllocator(
     m_pDevice(pDevice),
     m_pChunkLock(nullptr),
     m_lastPagingFence(0),
+    m_prefaultedPages(0),
     m_pLinearAllocLock(nullptr),
     m_pDummyChunkAllocation(nullptr)
 {
@@ -108,12 +109,17 @@ CmdAllocator::CmdAllocator(
     m_numHistogramBins = 0;
 #endif
 
+    memset(&m_usageHistory[0], 0, sizeof(m_usageHistory));
+
     m_flags.u32All          = 0;
     m_flags.autoMemoryReuse = createInfo.flags.autoMemoryReuse;
     if (createInfo.flags.disableBusyChunkTracking == 0)
     {
         m_flags.trackBusyChunks = m_flags.autoMemoryReuse;
     }
+#if PAL_CLIENT_INTERFACE_MAJOR_VERSION >= 642
+    m_flags.useHugePages = createInfo.flags.useHugePages;
+#endif
 
     const uint32 residencyFlags = m_pDevice->GetPublicSettings()->cmdAllocResidency;
     for (uint32 i = 0; i < CmdAllocatorTypeCount; ++i)
@@ -189,6 +195,7 @@ CmdAllocator::CmdAllocator(
     // memory heaps selected.
     m_sysAllocInfo.allocCreateInfo = m_gpuAllocInfo[CommandDataAlloc].allocCreateInfo;
     m_sysAllocInfo.allocCreateInfo.memObjCreateInfo.heapCount = 0;
+    m_sysAllocInfo.allocCreateInfo.flags.useHugePages         = m_flags.useHugePages;
 
     ResourceDescriptionCmdAllocator desc = {};
     desc.pCreateInfo = &createInfo;
@@ -411,6 +418,39 @@ void CmdAllocator::DestroyInternal()
     PAL_FREE(this, pPlatform);
 }
 
+#if PAL_CLIENT_INTERFACE_MAJOR_VERSION >= 642
+// =====================================================================================================================
+// Reports statistics about the memory owned by this command allocator.
+Result CmdAllocator::GetStats(
+    CmdAllocatorStats* pStats
+    ) const
+{
+    Result result = Result::Success;
+
+    if (pStats == nullptr)
+    {
+        result = Result::ErrorInvalidPointer;
+    }
+    else
+    {
+        // The counters are only updated under the chunk lock.
+        if (m_pChunkLock != nullptr)
+        {
+            m_pChunkLock->Lock();
+        }
+
+        pStats->prefaultedPages = m_prefaultedPages;
+
+        if (m_pChunkLock != nullptr)
+        {
+            m_pChunkLock->Unlock();
+        }
+    }
+
+    return result;
+}
+#endif
+
 // =====================================================================================================================
 // Informs the command allocator that all of its CmdStreamChunks are no longer being referenced by the GPU.
 Result CmdAllocator::Reset()
@@ -552,6 +592,112 @@ Result CmdAllocator::GetNewChunk(
     return result;
 }
 
+// =====================================================================================================================
+// Obtains several chunks at once, taking the chunk lock only once. Used to prefetch the chunks a command buffer is
+// expected to need when it begins.
+uint32 CmdAllocator::GetNewChunks(
+    CmdAllocType     allocType,
+    bool             systemMemory,
+    uint32           numChunks,
+    CmdStreamChunk** ppChunks)
+{
+    // System memory allocations are only allowed for command data!
+    PAL_ASSERT((systemMemory == false) || (allocType == CommandDataAlloc));
+
+    if (m_pChunkLock != nullptr)
+    {
+        m_pChunkLock->Lock();
+    }
+
+    CmdAllocInfo*const pAllocInfo = (systemMemory ? &m_sysAllocInfo : &m_gpuAllocInfo[allocType]);
+
+    uint32 numFound = 0;
+    while ((numFound < numChunks) && (FindFreeChunk(pAllocInfo, &ppChunks[numFound]) == Result::Success))
+    {
+        ppChunks[numFound]->AddCommandStreamReference();
+        numFound++;
+    }
+
+    if (m_pChunkLock != nullptr)
+    {
+        m_pChunkLock->Unlock();
+    }
+
+    return numFound;
+}
+
+// =====================================================================================================================
+// Looks up the chunk usage predicted for the next command buffer with the given tag. Returns false if no command buffer
+// with this tag has ended yet.
+bool CmdAllocator::PredictChunkUsage(
+    uint32               usageTag,
+    CmdBufferChunkUsage* pUsage)
+{
+    PAL_ASSERT(usageTag != 0);
+
+    if (m_pChunkLock != nullptr)
+    {
+        m_pChunkLock->Lock();
+    }
+
+    const UsageHistoryEntry& entry = m_usageHistory[usageTag % UsageHistorySize];
+    const bool               found = (entry.usageTag == usageTag);
+
+    if (found)
+    {
+        *pUsage = entry.usage;
+    }
+
+    if (m_pChunkLock != nullptr)
+    {
+        m_pChunkLock->Unlock();
+    }
+
+    return found;
+}
+
+// =====================================================================================================================
+// Folds the chunk usage of a command buffer which just ended into the prediction for its tag. The prediction follows
+// growth immediately but only decays halfway toward a smaller usage, since prefetching an extra chunk is cheaper than
+// pulling one from the allocator in the middle of recording.
+void CmdAllocator::RecordChunkUsage(
+    uint32                     usageTag,
+    const CmdBufferChunkUsage& usage)
+{
+    PAL_ASSERT(usageTag != 0);
+
+    if (m_pChunkLock != nullptr)
+    {
+        m_pChunkLock->Lock();
+    }
+
+    UsageHistoryEntry*const pEntry = &m_usageHistory[usageTag % UsageHistorySize];
+
+    if (pEntry->usageTag != usageTag)
+    {
+        pEntry->usageTag = usageTag;
+        pEntry->usage    = usage;
+    }
+    else
+    {
+        for (uint32 idx = 0; idx < MaxUsageHistoryCmdStreams; ++idx)
+        {
+            const uint16 predicted = pEntry->usage.cmdChunks[idx];
+            pEntry->usage.cmdChunks[idx] = Max(usage.cmdChunks[idx],
+                                               static_cast<uint16>((predicted + usage.cmdChunks[idx]) / 2));
+        }
+
+        const uint16 predicted = pEntry->usage.embeddedDataChunks;
+        pEntry->usage.embeddedDataChunks = Max(usage.embeddedDataChunks,
+                                               static_cast<uint16>((predicted + usage.embeddedDataChunks) / 2));
+    }
+
+    if (m_pChunkLock != nullptr)
+    {
+        m_pChunkLock->Unlock();
+    }
+}
+
 // =====================================================================================================================
 // Searches the free and busy lists for a free chunk. A new CmdStreamAllocation will be created if needed.
 Result CmdAllocator::FindFreeChunk(
@@ -679,6 +825,11 @@ Result CmdAllocator::CreateAllocation(
 
         // Move the first newly created chunk to the busy list.
         pAllocInfo->busyList.PushBack(pChunk->ListNode());
+
+        if (pAlloc->UsesSystemMemory() && (allocCreateInfo.flags.useHugePages != 0) && (dummyAlloc == false))
+        {
+            m_prefaultedPages += (allocCreateInfo.memObjCreateInfo.size / VirtualPageSize());
+        }
     }
 
     if ((result == Result::Success) &&
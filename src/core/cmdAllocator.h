@@ -39,6 +39,17 @@ namespace Pal
 class Device;
 class Platform;
 
+// Maximum number of command streams per command buffer whose chunk usage the command allocator remembers.
+constexpr uint32 MaxUsageHistoryCmdStreams = 4;
+
+// Number of chunks a command buffer needed by the time it ended, as remembered by the command allocator for each
+// command buffer usage tag.
+struct CmdBufferChunkUsage
+{
+    uint16 cmdChunks[MaxUsageHistoryCmdStreams]; // Command chunks used by each of the command streams.
+    uint16 embeddedDataChunks;                   // Embedded data chunks used by the command buffer.
+};
+
 // =====================================================================================================================
 // The CmdAllocator class is responsible for allocating CmdStreamAllocations and managing their CmdStreamChunks.
 class CmdAllocator : public ICmdAllocator
@@ -61,6 +72,10 @@ public:
 
     virtual Result Reset() override;
 
+#if PAL_CLIENT_INTERFACE_MAJOR_VERSION >= 642
+    virtual Result GetStats(CmdAllocatorStats* pStats) const override;
+#endif
+
     // CmdBuffers and CmdStreams will use these public functions to interact with the CmdAllocator.
     Result GetNewChunk(CmdAllocType allocType, bool systemMemory, CmdStreamChunk** ppChunk);
 
@@ -68,6 +83,15 @@ public:
     // The dummy chunk allocation always has exactly one chunk so we just return the Chunks() pointer here.
     CmdStreamChunk* GetDummyChunk() const { return m_pDummyChunkAllocation->Chunks(); }
 
+    // Obtains up to numChunks chunks under a single lock. Returns the number of chunks written to ppChunks, which is
+    // less than numChunks only if the allocator ran out of memory.
+    uint32 GetNewChunks(CmdAllocType allocType, bool systemMemory, uint32 numChunks, CmdStreamChunk** ppChunks);
+
+    // Command buffers begun with a non-zero usage tag look up how many chunks the previous command buffers with the
+    // same tag needed, and report how many they needed themselves when they end.
+    bool PredictChunkUsage(uint32 usageTag, CmdBufferChunkUsage* pUsage);
+    void RecordChunkUsage(uint32 usageTag, const CmdBufferChunkUsage& usage);
+
     // CmdStreamChunk(s) are returned back to the allocator for use with the reuse-list.
     void ReuseChunks(CmdAllocType allocType, bool systemMemory, VectorIter iter);
 
@@ -131,7 +155,9 @@ private:
             uint32 autoMemoryReuse :  1; // Indicates that the allocator will automatically recycle idle chunks.
             uint32 trackBusyChunks :  1; // Indicates that the allocator will track which chunks are idle (for debugging
                                          // purposes, or for supporting 'autoMemoryReuse').
-            uint32 reserved        : 30;
+            uint32 useHugePages    :  1; // Indicates that system-memory chunks are backed by huge pages and faulted in
+                                         // when they are allocated.
+            uint32 reserved        : 29;
         };
         uint32 u32All;
     }  m_flags;
@@ -143,6 +169,8 @@ private:
     // Most-recent paging fence value returned from the OS when allocating command-chunk allocations
     uint64          m_lastPagingFence;
 
+    uint64          m_prefaultedPages;     // OS pages of system-memory chunks faulted in at allocation time.
+
     Util::Mutex*    m_pLinearAllocLock;    // If non-null, this protects the allocator's linear allocator state.
     LinearAllocList m_linearAllocFreeList; // Unordered list of allocators that are reset and not in use.
     LinearAllocList m_linearAllocBusyList; // Unordered list of allocators that are being used by command buffers.
@@ -164,6 +192,18 @@ private:
     // Dummy chunk used to handle cases where we've run out of GPU memory.
     CmdStreamAllocation* m_pDummyChunkAllocation;
 
+    // Chunk usage history of tagged command buffers. This is a small direct-mapped table indexed by the usage tag, so
+    // a tag can evict another tag's history if both map to the same entry. Protected by m_pChunkLock.
+    static constexpr uint32 UsageHistorySize = 64;
+
+    struct UsageHistoryEntry
+    {
+        uint32              usageTag; // Tag of the command buffers this entry describes, zero if the entry is unused.
+        CmdBufferChunkUsage usage;    // Predicted chunk usage of the next command buffer with this tag.
+    };
+
+    UsageHistoryEntry m_usageHistory[UsageHistorySize];
+
     PAL_DISALLOW_DEFAULT_CTOR(CmdAllocator);
     PAL_DISALLOW_COPY_AND_ASSIGN(CmdAllocator);
 };
@@ -28,6 +28,7 @@
 #include "core/gpuEvent.h"
 #include "core/platform.h"
 #include "core/queue.h"
+#include "core/settingsLoader.h"
 #include "palAutoBuffer.h"
 #include "palLinearAllocator.h"
 #include "palSysUtil.h"
@@ -118,6 +119,7 @@ CmdBuffer::CmdBuffer(
     m_status(Result::Success),
     m_executionMarkerAddr(0),
     m_executionMarkerCount(0),
+    m_usageTag(0),
     m_embeddedData(device.GetPlatform()),
     m_gpuScratchMem(device.GetPlatform()),
     m_gpuScratchMemAllocLimit(0),
@@ -128,12 +130,14 @@ CmdBuffer::CmdBuffer(
     m_recordState(CmdBufferRecordState::Reset)
 #if PAL_ENABLE_PRINTS_ASSERTS
     ,
+    m_dumpFormat(CmdBufDumpFormatText),
     m_uniqueId(0),
     m_numCmdBufsBegun(0)
 #endif
 {
     m_buildFlags.u32All = 0;
     m_flags.u32All      = 0;
+    memset(&m_cpuStats, 0, sizeof(m_cpuStats));
 
     // Initialize all draw/dispatch funcs to invalid stubs.  HWIP command buffer classes that support these interfaces
     // will overwrite the function pointers.
@@ -214,6 +218,10 @@ Result CmdBuffer::Begin(
 
             // Assemble our building flags for this command building session.
             m_buildFlags = info.flags;
+#if PAL_CLIENT_INTERFACE_MAJOR_VERSION >= 642
+            m_usageTag   = info.usageTag;
+#endif
+            memset(&m_cpuStats, 0, sizeof(m_cpuStats));
 
 #if PAL_CLIENT_INTERFACE_MAJOR_VERSION< 593
             m_buildFlags.enableTmz = 0;
@@ -274,6 +282,12 @@ Result CmdBuffer::Begin(
                 result = BeginCommandStreams(cmdStreamflags, m_recordState != CmdBufferRecordState::Reset);
             }
 
+            if ((result == Result::Success) && (m_usageTag != 0))
+            {
+                // This must happen before the preamble is written so that it can use the prefetched chunks too.
+                PrefetchChunks();
+            }
+
             if (result == Result::Success)
             {
                 m_p2pBltWaInfo.Clear();
@@ -381,6 +395,11 @@ Result CmdBuffer::End()
         if (result == Result::Success)
         {
             m_recordState = CmdBufferRecordState::Executable;
+
+            if (m_usageTag != 0)
+            {
+                RecordChunkUsage();
+            }
         }
     }
     else
@@ -407,6 +426,8 @@ Result CmdBuffer::Reset(
     m_executionMarkerCount = 0;
     m_executionMarkerAddr  = 0;
 
+    memset(&m_cpuStats, 0, sizeof(m_cpuStats));
+
     // We must attempt to return our linear allocator in the case that the client reset this command buffer while it was
     // in the building state. In normal operation this call will do nothing and take no locks.
     ReturnLinearAllocator();
@@ -464,6 +485,11 @@ CmdStreamChunk* CmdBuffer::GetNextDataChunk(
 
             // Something bad happen and the CmdBuffer will always be in error status ever after
             PAL_ALERT(m_status != Result::Success);
+
+            if (m_status == Result::Success)
+            {
+                pData->numOnDemandChunks++;
+            }
         }
     }
 
@@ -680,10 +706,12 @@ Result CmdBuffer::AllocateAndBindGpuMemToEvent(
 }
 
 // =====================================================================================================================
-// Root level barrier function.  Currently only used for validation of depth / stencil image transitions.
+// Root level barrier function.  Counts the barrier for GetStats() and validates depth / stencil image transitions.
 void CmdBuffer::CmdBarrier(
     const BarrierInfo& barrierInfo)
 {
+    m_cpuStats.numBarriers++;
+
 #if PAL_ENABLE_PRINTS_ASSERTS
     AutoBuffer<bool, 32, Platform>  processed(barrierInfo.transitionCount, m_device.GetPlatform());
     if (processed.Capacity() >= barrierInfo.transitionCount)
@@ -756,6 +784,8 @@ void CmdBuffer::CmdRelease(
     const AcquireReleaseInfo& releaseInfo,
     const IGpuEvent*          pGpuEvent)
 {
+    m_cpuStats.numBarriers++;
+
 #if PAL_ENABLE_PRINTS_ASSERTS
     VerifyBarrierTransitions(releaseInfo);
 #endif
@@ -767,6 +797,8 @@ void CmdBuffer::CmdAcquire(
     uint32                    gpuEventCount,
     const IGpuEvent*const*    ppGpuEvents)
 {
+    m_cpuStats.numBarriers++;
+
 #if PAL_ENABLE_PRINTS_ASSERTS
     VerifyBarrierTransitions(acquireInfo);
 #endif
@@ -776,6 +808,8 @@ void CmdBuffer::CmdAcquire(
 void CmdBuffer::CmdReleaseThenAcquire(
     const AcquireReleaseInfo& barrierInfo)
 {
+    m_cpuStats.numBarriers++;
+
 #if PAL_ENABLE_PRINTS_ASSERTS
     VerifyBarrierTransitions(barrierInfo);
 #endif
@@ -860,6 +894,81 @@ void CmdBuffer::ReturnDataChunks(
 
     pData->chunkList.Clear();
     pData->chunkDwordsAvailable = 0;
+    pData->numPrefetchedChunks  = 0;
+    pData->numOnDemandChunks    = 0;
+}
+
+// =====================================================================================================================
+// Obtains the command and embedded data chunks that earlier command buffers with the same usage tag needed, so that
+// recording doesn't have to go back to the command allocator for them one at a time.
+void CmdBuffer::PrefetchChunks()
+{
+    CmdBufferChunkUsage usage = {};
+
+    if (m_pCmdAllocator->PredictChunkUsage(m_usageTag, &usage))
+    {
+        const uint32 numCmdStreams = Min(NumCmdStreams(), MaxUsageHistoryCmdStreams);
+
+        for (uint32 idx = 0; idx < numCmdStreams; ++idx)
+        {
+            // GetCmdStream only hands out const streams, but prefetching is part of beginning the stream.
+            CmdStream*const pCmdStream = const_cast<CmdStream*>(GetCmdStream(idx));
+
+            if (pCmdStream != nullptr)
+            {
+                pCmdStream->PrefetchChunks(usage.cmdChunks[idx]);
+            }
+        }
+
+        const uint32 numRetained = m_embeddedData.retainedChunks.NumElements();
+
+        if (usage.embeddedDataChunks > numRetained)
+        {
+            // Embedded data is rarely more than a few chunks, so this is bounded more tightly than command chunks.
+            constexpr uint32 MaxPrefetchChunks = 8;
+
+            CmdStreamChunk* pChunks[MaxPrefetchChunks];
+
+            const uint32 numFound = m_pCmdAllocator->GetNewChunks(EmbeddedDataAlloc,
+                                                                  false,
+                                                                  Min(usage.embeddedDataChunks - numRetained,
+                                                                      MaxPrefetchChunks),
+                                                                  &pChunks[0]);
+            for (uint32 idx = 0; idx < numFound; ++idx)
+            {
+                m_embeddedData.retainedChunks.PushBack(pChunks[idx]);
+            }
+
+            m_embeddedData.numPrefetchedChunks += numFound;
+        }
+    }
+}
+
+// =====================================================================================================================
+// Reports the number of chunks this command buffer needed to the command allocator, which uses it to predict the usage
+// of the next command buffer begun with the same usage tag.
+void CmdBuffer::RecordChunkUsage() const
+{
+    // The history saturates its chunk counts rather than wrapping them.
+    constexpr uint32 MaxChunks = UINT16_MAX;
+
+    CmdBufferChunkUsage usage = {};
+
+    const uint32 numCmdStreams = Min(NumCmdStreams(), MaxUsageHistoryCmdStreams);
+
+    for (uint32 idx = 0; idx < numCmdStreams; ++idx)
+    {
+        const CmdStream*const pCmdStream = GetCmdStream(idx);
+
+        if (pCmdStream != nullptr)
+        {
+            usage.cmdChunks[idx] = static_cast<uint16>(Min(pCmdStream->GetNumChunks(), MaxChunks));
+        }
+    }
+
+    usage.embeddedDataChunks = static_cast<uint16>(Min(m_embeddedData.chunkList.NumElements(), MaxChunks));
+
+    m_pCmdAllocator->RecordChunkUsage(m_usageTag, usage);
 }
 
 // =====================================================================================================================
@@ -992,11 +1101,20 @@ bool CmdBuffer::HasAddressDependentCmdStream() const
 
 #if PAL_ENABLE_PRINTS_ASSERTS
 // =====================================================================================================================
-// Open the dump file, gets the directory from device setting so the file is dumped to the correct folder.
+bool CmdBuffer::IsDumpingEnabled() const
+{
+    return (RuntimeSettingsRef(m_device)->cmdBufDumpMode == CmdBufDumpModeRecordTime);
+}
+
+// =====================================================================================================================
+// Open the dump file, gets the directory from device setting so the file is dumped to the correct folder. The dump
+// format is latched so that End() writes the file the same way even if the runtime settings were reloaded since.
 void CmdBuffer::OpenCmdBufDumpFile(
     const char* pFilename)
 {
-    const auto& settings = m_device.Settings();
+    const RuntimeSettingsRef settingsRef(m_device);
+    const RuntimeSettings&   settings = *settingsRef;
+    m_dumpFormat = settings.cmdBufDumpFormat;
     static const char* const pSuffix[] =
     {
         ".txt",     // CmdBufDumpFormat::CmdBufDumpFormatText
@@ -1248,6 +1366,60 @@ uint32 CmdBuffer::GetUsedSize(
     return (sizeInDwords * sizeof(uint32));
 }
 
+#if PAL_CLIENT_INTERFACE_MAJOR_VERSION >= 642
+// =====================================================================================================================
+// Reports the CPU-side statistics gathered while building this command buffer. Only the draw, dispatch and barrier
+// counts are tracked while recording; the remaining statistics are gathered from the command streams and data chunks
+// here so that command building doesn't pay for them.
+Result CmdBuffer::GetStats(
+    CmdBufferStats* pStats
+    ) const
+{
+    Result result = Result::Success;
+
+    if (pStats == nullptr)
+    {
+        result = Result::ErrorInvalidPointer;
+    }
+    else if (m_buildFlags.enableStats == 0)
+    {
+        result = Result::ErrorUnavailable;
+    }
+    else
+    {
+        memset(pStats, 0, sizeof(*pStats));
+
+        pStats->numDraws      = m_cpuStats.numDraws;
+        pStats->numDispatches = m_cpuStats.numDispatches;
+        pStats->numBarriers   = m_cpuStats.numBarriers;
+
+        for (uint32 idx = 0; idx < NumCmdStreams(); ++idx)
+        {
+            const CmdStream*const pCmdStream = GetCmdStream(idx);
+
+            if (pCmdStream != nullptr)
+            {
+                pStats->numCmdChunks              += pCmdStream->GetNumChunks();
+                pStats->numPrefetchedChunks       += pCmdStream->NumPrefetchedChunks();
+                pStats->numUnusedPrefetchedChunks += pCmdStream->NumUnusedPrefetchedChunks();
+                pStats->numOnDemandChunks         += pCmdStream->NumOnDemandChunks();
+                pCmdStream->AccumulatePm4OptimizerStats(&pStats->pm4OptKeptRegWrites, &pStats->pm4OptSkippedRegWrites);
+            }
+        }
+
+        pStats->cmdDataDwords     = (GetUsedSize(CommandDataAlloc) / sizeof(uint32));
+        pStats->embeddedDataBytes = GetUsedSize(EmbeddedDataAlloc);
+
+        pStats->numPrefetchedChunks       += m_embeddedData.numPrefetchedChunks;
+        pStats->numUnusedPrefetchedChunks += Min(m_embeddedData.numPrefetchedChunks,
+                                                 m_embeddedData.retainedChunks.NumElements());
+        pStats->numOnDemandChunks         += m_embeddedData.numOnDemandChunks;
+    }
+
+    return result;
+}
+#endif
+
 // =====================================================================================================================
 void CmdBuffer::NotifyAllocFailure()
 {
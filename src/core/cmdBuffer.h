@@ -723,6 +723,10 @@ public:
 
     virtual uint32 GetUsedSize(CmdAllocType type) const override;
 
+#if PAL_CLIENT_INTERFACE_MAJOR_VERSION >= 642
+    virtual Result GetStats(CmdBufferStats* pStats) const override;
+#endif
+
     // Maximum length of a filename allowed for command buffer dumps
     static constexpr uint32 MaxFilenameLength = 32;
 
@@ -897,9 +901,10 @@ protected:
 
 #if PAL_ENABLE_PRINTS_ASSERTS
     // Utility function for determing if command buffer dumping has been enabled.
-    bool IsDumpingEnabled() const { return m_device.Settings().cmdBufDumpMode == CmdBufDumpModeRecordTime; }
+    bool IsDumpingEnabled() const;
 
-    Util::File* DumpFile() { return &m_file; }
+    Util::File*      DumpFile() { return &m_file; }
+    CmdBufDumpFormat DumpFormat() const { return m_dumpFormat; }
     uint32      UniqueId() const { return m_uniqueId; }
     uint32      NumBegun() const { return m_numCmdBufsBegun; }
 #endif
@@ -922,15 +927,33 @@ protected:
 
     gpusize                       m_executionMarkerAddr;
     uint32                        m_executionMarkerCount;
+    uint32                        m_usageTag; // Tag used to predict the chunk usage of this command buffer.
+
+    // Per-call counters reported by GetStats(). They're bumped unconditionally because a single increment is cheaper
+    // than checking the enableStats build flag; everything else GetStats() reports is derived at query time.
+    struct
+    {
+        uint32 numDraws;
+        uint32 numDispatches;
+        uint32 numBarriers;
+    }                             m_cpuStats;
 
     struct ChunkData
     {
-        ChunkData(Platform* pAllocator) : chunkList(pAllocator), retainedChunks(pAllocator), chunkDwordsAvailable(0)
+        ChunkData(Platform* pAllocator)
+            :
+            chunkList(pAllocator),
+            retainedChunks(pAllocator),
+            chunkDwordsAvailable(0),
+            numPrefetchedChunks(0),
+            numOnDemandChunks(0)
         { }
 
         ChunkRefList chunkList;            // List of allocated data chunks.
         ChunkRefList retainedChunks;       // List of data chunks that have been retained between resets
         uint32       chunkDwordsAvailable; // Number of unused DWORD's in the tail of the chunk list.
+        uint32       numPrefetchedChunks;  // Chunks added to the retained list by PrefetchChunks since the last reset.
+        uint32       numOnDemandChunks;    // Chunks pulled from the command allocator during recording.
     };
 
     ChunkData          m_embeddedData;
@@ -972,6 +995,9 @@ private:
     void WriteEvent(const IGpuEvent& gpuEvent, HwPipePoint pipePoint, uint32 data);
 
     void ReturnDataChunks(ChunkData* pData, CmdAllocType type, bool returnGpuMemory);
+
+    void PrefetchChunks();
+    void RecordChunkUsage() const;
     void ReturnLinearAllocator();
 
     void VerifyBarrierTransitions(const AcquireReleaseInfo& releaseInfo) const;
@@ -981,10 +1007,11 @@ private:
 
 #if PAL_ENABLE_PRINTS_ASSERTS
     // These member variables are only for command buffer dumping support.
-    static uint32  s_numCreated[QueueTypeCount]; // Number of created CmdBuffers of each type.
-    Util::File     m_file;
-    uint32         m_uniqueId;
-    uint32         m_numCmdBufsBegun;
+    static uint32    s_numCreated[QueueTypeCount]; // Number of created CmdBuffers of each type.
+    Util::File       m_file;
+    CmdBufDumpFormat m_dumpFormat;                 // Format of m_file, latched when it is opened.
+    uint32           m_uniqueId;
+    uint32           m_numCmdBufsBegun;
 #endif
 
     PAL_DISALLOW_COPY_AND_ASSIGN(CmdBuffer);
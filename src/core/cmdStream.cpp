@@ -66,7 +66,9 @@ CmdStream::CmdStream(
     m_pReserveBuffer(nullptr),
     m_nestedChunks(32, pDevice->GetPlatform()),
     m_status(Result::Success),
-    m_totalChunkDwords(0)
+    m_totalChunkDwords(0),
+    m_numPrefetchedChunks(0),
+    m_numOnDemandChunks(0)
 #if PAL_ENABLE_PRINTS_ASSERTS
     , m_streamGeneration(0)
     , m_isReserved(false)
@@ -322,6 +324,8 @@ CmdStreamChunk* CmdStream::GetNextChunk(
             }
             else
             {
+                m_numOnDemandChunks++;
+
                 // Make sure that the start address of this chunk work with the requirements of this command stream if
                 // the stream isn't being assembled in system memory.
                 PAL_ASSERT(pChunk->UsesSystemMemory() || IsPow2Aligned(pChunk->GpuVirtAddr(), m_startAlignBytes));
@@ -405,6 +409,34 @@ CmdStreamChunk* CmdStream::GetChunk(
     return pChunk;
 }
 
+// =====================================================================================================================
+// Tops up the retained chunk list to the given number of chunks. GetNextChunk consumes retained chunks before it asks
+// the command allocator for more, so this moves the allocator round trips of a whole recording session up front.
+void CmdStream::PrefetchChunks(
+    uint32 numChunks)
+{
+    // Keep the prefetch bounded in case the usage history is wildly off.
+    constexpr uint32 MaxPrefetchChunks = 32;
+
+    const uint32 numRetained = m_retainedChunkList.NumElements();
+
+    if ((m_status == Result::Success) && (numChunks > numRetained))
+    {
+        CmdStreamChunk* pChunks[MaxPrefetchChunks];
+
+        const uint32 numFound = m_pCmdAllocator->GetNewChunks(CommandDataAlloc,
+                                                              (m_flags.buildInSysMem != 0),
+                                                              Min(numChunks - numRetained, MaxPrefetchChunks),
+                                                              &pChunks[0]);
+        for (uint32 idx = 0; idx < numFound; ++idx)
+        {
+            m_retainedChunkList.PushBack(pChunks[idx]);
+        }
+
+        m_numPrefetchedChunks += numFound;
+    }
+}
+
 // =====================================================================================================================
 // Resets a command stream to its default state.
 void CmdStream::Reset(
@@ -460,6 +492,8 @@ void CmdStream::Reset(
     m_chunkList.Clear();
     m_chunkDwordsAvailable   = 0;
     m_totalChunkDwords       = 0;
+    m_numPrefetchedChunks    = 0;
+    m_numOnDemandChunks      = 0;
     m_flags.addressDependent = 0;
 
     if ((pNewAllocator != nullptr) && (pNewAllocator != m_pCmdAllocator))
@@ -231,6 +231,17 @@ public:
     ChunkRefList::Iter GetFwdIterator() const { return m_chunkList.Begin(); }
     CmdStreamChunk*    GetFirstChunk()  const { return m_chunkList.Front(); }
 
+    // Makes sure that at least numChunks chunks are retained by this stream, so that recording can use them without
+    // going back to the command allocator.
+    void PrefetchChunks(uint32 numChunks);
+
+    // Prefetch statistics since the last reset: chunks obtained by PrefetchChunks, how many of those are still unused,
+    // and chunks which had to be pulled from the command allocator during recording.
+    uint32 NumPrefetchedChunks() const { return m_numPrefetchedChunks; }
+    uint32 NumUnusedPrefetchedChunks() const
+        { return Util::Min(m_numPrefetchedChunks, m_retainedChunkList.NumElements()); }
+    uint32 NumOnDemandChunks() const { return m_numOnDemandChunks; }
+
     // The caller is responsible for returning the chunks saved in "pDest" to their command allocator
     Result TransferRetainedChunks(ChunkRefList* pDest);
 
@@ -242,6 +253,10 @@ public:
 
     uint32 GetUsedCmdMemorySize() const;
 
+    // Adds the number of register writes kept and skipped by this stream's PM4 optimizer since Begin() to the given
+    // counters. Streams which never optimize their commands have nothing to add.
+    virtual void AccumulatePm4OptimizerStats(uint64* pKeptRegWrites, uint64* pSkippedRegWrites) const { }
+
 protected:
     // Internal chunk memory interface:
     // The command stream uses the alloc functions to get chunk space to store commands and embedded data. These
@@ -310,6 +325,8 @@ private:
     Result   m_status;              // To identify whether any error occurs when command stream setup.
     gpusize  m_totalChunkDwords;    // The sum of all allocated chunk space.  Before End() is called on this chunk,
                                     // this does not include the current chunk.  After End() is called, it does.
+    uint32   m_numPrefetchedChunks; // Chunks added to the retained chunk list by PrefetchChunks since the last reset.
+    uint32   m_numOnDemandChunks;   // Chunks pulled from the command allocator during recording since the last reset.
 
 #if PAL_ENABLE_PRINTS_ASSERTS
     uint32  m_streamGeneration; // Counter used for tracking stream reset before submit.
@@ -104,11 +104,27 @@ Result CmdStreamAllocation::Init(
     {
         PAL_ASSERT(IsPow2Aligned(ChunkSize(), VirtualPageSize()));
 
-        result = VirtualReserve(static_cast<size_t>(m_createInfo.memObjCreateInfo.size),
-                                reinterpret_cast<void**>(&m_pCpuAddr));
+        const size_t allocSize    = static_cast<size_t>(m_createInfo.memObjCreateInfo.size);
+        const size_t hugePageSize = (m_createInfo.flags.useHugePages != 0) ? VirtualHugePageSize() : 0;
+
+        // Huge pages can only back the parts of the allocation which are aligned to them, so align the whole thing
+        // if it's big enough to benefit.
+        const bool useHugePages = (hugePageSize > 0) && (allocSize >= hugePageSize);
+
+        result = VirtualReserve(allocSize,
+                                reinterpret_cast<void**>(&m_pCpuAddr),
+                                nullptr,
+                                useHugePages ? hugePageSize : 1);
         if (result == Result::Success)
         {
-            result = VirtualCommit(m_pCpuAddr, static_cast<size_t>(m_createInfo.memObjCreateInfo.size));
+            result = VirtualCommit(m_pCpuAddr, allocSize);
+        }
+
+        if ((result == Result::Success) && (m_createInfo.flags.useHugePages != 0))
+        {
+            // Fault the memory in now so that recording doesn't page fault on each new page it writes. Failing to get
+            // huge pages isn't fatal, the memory is still faulted in with regular pages.
+            VirtualPrefault(m_pCpuAddr, allocSize, useHugePages);
         }
     }
     else
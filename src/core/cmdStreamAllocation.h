@@ -59,7 +59,9 @@ struct CmdStreamAllocationCreateInfo
                                                             // for "real" GPU memory allocations.
         uint32                  optimizePaging      :  1;   // True if the wait-on-submit residency optimization should
                                                             // be used.
-        uint32                  reserved            : 28;
+        uint32                  useHugePages        :  1;   // True if system memory should be backed by huge pages and
+                                                            // faulted in at creation.
+        uint32                  reserved            : 27;
     } flags;
 };
 
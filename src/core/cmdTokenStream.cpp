@@ -0,0 +1,125 @@
+/*
+ ***********************************************************************************************************************
+ *
+ *  Copyright (c) 2020 Advanced Micro Devices, Inc. All Rights Reserved.
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy
+ *  of this software and associated documentation files (the "Software"), to deal
+ *  in the Software without restriction, including without limitation the rights
+ *  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *  copies of the Software, and to permit persons to whom the Software is
+ *  furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in all
+ *  copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ *  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *  SOFTWARE.
+ *
+ **********************************************************************************************************************/
+
+#include "core/cmdTokenStream.h"
+#include "palPlatform.h"
+#include "palSysMemory.h"
+
+using namespace Util;
+
+namespace Pal
+{
+
+// =====================================================================================================================
+CmdTokenStream::CmdTokenStream(
+    IPlatform* pPlatform,
+    size_t     initialSize)
+    :
+    m_pPlatform(pPlatform),
+    m_pData(nullptr),
+    m_size(initialSize),
+    m_writeOffset(0),
+    m_result(Result::Success)
+{
+}
+
+// =====================================================================================================================
+CmdTokenStream::~CmdTokenStream()
+{
+    PAL_FREE(m_pData, m_pPlatform);
+}
+
+// =====================================================================================================================
+void CmdTokenStream::Reset()
+{
+    // Reset the token stream state so that we can reuse our old token stream buffer.
+    m_writeOffset = 0;
+    m_result      = Result::Success;
+
+    // We lazy allocate the first token stream during the first Reset() call to avoid allocating a lot of extra
+    // memory if the client creates a ton of command buffers but doesn't use them.
+    if (m_pData == nullptr)
+    {
+        m_pData = PAL_MALLOC(m_size, m_pPlatform, AllocInternal);
+
+        if (m_pData == nullptr)
+        {
+            m_result = Result::ErrorOutOfMemory;
+        }
+    }
+}
+
+// =====================================================================================================================
+void* CmdTokenStream::AllocSpace(
+    size_t numBytes,
+    size_t alignment)
+{
+    void*        pTokenSpace        = nullptr;
+    const size_t alignedWriteOffset = Pow2Align(m_writeOffset, alignment);
+    const size_t nextWriteOffset    = alignedWriteOffset + numBytes;
+
+    if ((m_result == Result::Success) && (nextWriteOffset > m_size))
+    {
+        // Double the size of the token stream until we have enough space.
+        size_t newStreamSize = m_size * 2;
+
+        while (nextWriteOffset > newStreamSize)
+        {
+            newStreamSize *= 2;
+        }
+
+        // Allocate the new buffer and copy the current tokens over.
+        void* pNewStream = PAL_MALLOC(newStreamSize, m_pPlatform, AllocInternal);
+
+        if (pNewStream != nullptr)
+        {
+            memcpy(pNewStream, m_pData, m_writeOffset);
+            PAL_FREE(m_pData, m_pPlatform);
+
+            m_pData = pNewStream;
+            m_size  = newStreamSize;
+        }
+        else
+        {
+            // We've run out of memory, this stream is now invalid.
+            m_result = Result::ErrorOutOfMemory;
+        }
+    }
+
+    // Return null if we've previously encountered an error or just failed to reallocate the token stream. Otherwise,
+    // return a properly aligned write pointer and update the write offset to point at the end of the allocated space.
+    if (m_result == Result::Success)
+    {
+        // Malloc is required to give us memory that is aligned high enough for any variable, but let's double check.
+        PAL_ASSERT(IsPow2Aligned(reinterpret_cast<uint64>(m_pData), alignment));
+
+        pTokenSpace   = VoidPtrInc(m_pData, alignedWriteOffset);
+        m_writeOffset = nextWriteOffset;
+    }
+
+    return pTokenSpace;
+}
+
+} // Pal
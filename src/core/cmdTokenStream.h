@@ -0,0 +1,146 @@
+/*
+ ***********************************************************************************************************************
+ *
+ *  Copyright (c) 2020 Advanced Micro Devices, Inc. All Rights Reserved.
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy
+ *  of this software and associated documentation files (the "Software"), to deal
+ *  in the Software without restriction, including without limitation the rights
+ *  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *  copies of the Software, and to permit persons to whom the Software is
+ *  furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in all
+ *  copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ *  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *  SOFTWARE.
+ *
+ **********************************************************************************************************************/
+
+#pragma once
+
+#include "pal.h"
+#include "palInlineFuncs.h"
+
+namespace Pal
+{
+
+class IPlatform;
+
+// =====================================================================================================================
+// A growable stream of tokenized command buffer calls. Layers which defer command recording (e.g., GPU debug and GPU
+// profiler) and client ICmdTokenStream objects insert each call and its arguments into a token stream, then replay it
+// into real command buffers later. The stream is written once per recording but can be read any number of times, and
+// because every Reader keeps its own cursor, several Readers may replay the same stream at once from different threads.
+class CmdTokenStream
+{
+public:
+    CmdTokenStream(IPlatform* pPlatform, size_t initialSize);
+    ~CmdTokenStream();
+
+    // Discards all tokens so that the stream can be recorded again. The backing memory is kept; it is lazily
+    // allocated by the first Reset() to avoid allocating memory for command buffers which are never recorded.
+    void Reset();
+
+    void* AllocSpace(size_t numBytes, size_t alignment);
+
+    // Insert a copy of the specified value into the token stream.
+    template <typename T> void Insert(const T& token)
+    {
+        T*const pDst = static_cast<T*>(AllocSpace(sizeof(T), __alignof(T)));
+        if (pDst != nullptr)
+        {
+            *pDst = token;
+        }
+    }
+
+    // Insert a copy of an array of values into the token stream.
+    template <typename T> void InsertArray(const T* pData, uint32 count)
+    {
+        Insert(count);
+        if (count > 0)
+        {
+            void*const pDst = AllocSpace(sizeof(T) * count, __alignof(T));
+            if (pDst != nullptr)
+            {
+                memcpy(pDst, pData, sizeof(T) * count);
+            }
+        }
+    }
+
+    // This must be Success unless an error occured during AllocSpace.
+    Result GetResult() const { return m_result; }
+
+    // Number of bytes of tokens written since the last Reset().
+    size_t GetSize() const { return m_writeOffset; }
+
+    // A read cursor into a token stream. The stream must not be written while it is being read.
+    class Reader
+    {
+    public:
+        explicit Reader(const CmdTokenStream& stream) : m_stream(stream), m_offset(0) { }
+
+        // Retrieves the value of the next item in the token stream then advances the read pointer.  Complement of
+        // Insert().
+        template <typename T> const T& Read()
+        {
+            PAL_ASSERT(m_stream.m_result == Result::Success);
+            m_offset = Util::Pow2Align(m_offset, __alignof(T));
+            const T& val = *static_cast<const T*>(Util::VoidPtrInc(m_stream.m_pData, m_offset));
+            m_offset += sizeof(T);
+            return val;
+        }
+
+        // Retrieves a pointer to the next array of value(s) in the token stream then advances the read pointer.
+        // Returns the number of items stored in the array.  Complement of InsertArray().
+        template <typename T> uint32 ReadArray(T** ppToken)
+        {
+            uint32 count = Read<uint32>();
+            if (count != 0)
+            {
+                m_offset = Util::Pow2Align(m_offset, __alignof(T));
+                *ppToken = static_cast<T*>(Util::VoidPtrInc(m_stream.m_pData, m_offset));
+                m_offset += sizeof(T) * count;
+            }
+            else
+            {
+                *ppToken = nullptr;
+            }
+            return count;
+        }
+
+        // The read position can be saved and restored to replay part of the stream, e.g. to split it between threads.
+        size_t GetOffset() const { return m_offset; }
+        void   Seek(size_t offset) { PAL_ASSERT(offset <= m_stream.m_writeOffset); m_offset = offset; }
+        void   Rewind() { m_offset = 0; }
+
+        bool IsAtEnd() const { return (m_offset == m_stream.m_writeOffset); }
+
+    private:
+        const CmdTokenStream& m_stream;
+        size_t                m_offset; // Read the next token at this offset within the token stream.
+
+        PAL_DISALLOW_DEFAULT_CTOR(Reader);
+        PAL_DISALLOW_COPY_AND_ASSIGN(Reader);
+    };
+
+private:
+    IPlatform*const m_pPlatform;
+
+    // The token stream is a single block of memory that doubles in size each time it runs out of space.
+    void*  m_pData;       // Storage for tokenized commands. Rewind here on Reset().
+    size_t m_size;        // The size of the token stream buffer in bytes.
+    size_t m_writeOffset; // Write the next token at this offset within the token stream.
+    Result m_result;
+
+    PAL_DISALLOW_DEFAULT_CTOR(CmdTokenStream);
+    PAL_DISALLOW_COPY_AND_ASSIGN(CmdTokenStream);
+};
+
+} // Pal
@@ -25,6 +25,7 @@
 
 #include "core/cmdAllocator.h"
 #include "core/cmdBuffer.h"
+#include "core/clientCmdTokenStream.h"
 #include "core/device.h"
 #include "core/engine.h"
 #include "core/fence.h"
@@ -36,6 +37,7 @@
 #include "core/queue.h"
 #include "core/settingsLoader.h"
 #include "core/hw/gfxip/gfxDevice.h"
+#include "core/hw/gfxip/queryPool.h"
 #include "core/hw/ossip/ossDevice.h"
 #include "core/addrMgr/addrMgr.h"
 #include "core/svmMgr.h"
@@ -235,9 +237,12 @@ Device::Device(
     m_pSettingsLoader(nullptr),
 #if defined(__unix__)
     m_settingsMgr(SettingsFileName, pPlatform),
+    m_settingsWatchInterval(0),
 #endif
     m_dmaUploadRingLock(),
+    m_dmaUploadBatchDrained(),
     m_pDmaUploadRing(nullptr),
+    m_semaphoreWaitService(this),
     m_referencedGpuMem(ReferencedMemoryMapElements, pPlatform),
     m_referencedGpuMemLock(),
     m_pAddrMgr(nullptr),
@@ -307,6 +312,8 @@ Device::~Device()
         m_pAddrMgr = nullptr;
     }
 
+    // The settings watch thread publishes through the settings loader.
+    StopSettingsWatch();
     PAL_SAFE_DELETE(m_pSettingsLoader, m_pPlatform);
 }
 
@@ -318,6 +325,10 @@ Result Device::Cleanup()
 {
     Result result = Result::Success;
 
+    // The wait service's worker threads may still reference device objects, so stop them first.
+    m_semaphoreWaitService.Cleanup();
+    StopSettingsWatch();
+
     if (m_pDmaUploadRing != nullptr)
     {
         // It will call destructor of DmaUploadRing to free internal resources of m_pDmaUploadRing.
@@ -490,6 +501,26 @@ Result Device::EarlyInit(
         result = m_dmaUploadRingLock.Init();
     }
 
+    if (result == Result::Success)
+    {
+        result = m_dmaUploadBatchDrained.Init();
+    }
+
+#if defined(__unix__)
+    if (result == Result::Success)
+    {
+        EventCreateFlags flags = {};
+        flags.manualReset      = true;
+
+        result = m_settingsWatchStop.Init(flags);
+    }
+#endif
+
+    if (result == Result::Success)
+    {
+        result = m_semaphoreWaitService.Init();
+    }
+
     return result;
 }
 
@@ -1257,7 +1288,11 @@ Result Device::FixupUsableGpuVirtualAddressRange(
 Result Device::CommitSettingsAndInit()
 {
     PAL_ASSERT(m_pSettingsLoader != nullptr);
+
+    // The watch thread publishes runtime settings, which are reset when the settings are finalized.
+    StopSettingsWatch();
     m_pSettingsLoader->FinalizeSettings();
+    StartSettingsWatch();
 
     if (m_pPlatform->PlatformSettings().debugOverlayEnabled)
     {
@@ -2358,6 +2393,23 @@ Result Device::GetPerfExperimentProperties(
     return result;
 }
 
+// =====================================================================================================================
+// Sleeps until an uploader finishes recording into the open upload batch. The caller must hold m_dmaUploadRingLock.
+// Uploaders only record on the CPU, so a batch which does not drain within the timeout points to a leaked uploader.
+Result Device::WaitForUploadBatchDrained()
+{
+    constexpr uint32 UploadBatchDrainTimeoutMs = 5000;
+
+    Result result = Result::Success;
+    if (m_dmaUploadBatchDrained.Wait(&m_dmaUploadRingLock, UploadBatchDrainTimeoutMs) == false)
+    {
+        PAL_ALERT_ALWAYS_MSG("Timed out waiting for the DMA upload batch to drain.");
+        result = Result::Timeout;
+    }
+
+    return result;
+}
+
 // =====================================================================================================================
 // Obtains an Entry of the DmaUploadRing.
 Result Device::AcquireRingSlot(
@@ -2366,11 +2418,24 @@ Result Device::AcquireRingSlot(
     Util::MutexAuto lock(&m_dmaUploadRingLock);
 
     PAL_ASSERT(m_pDmaUploadRing != nullptr);
-    return m_pDmaUploadRing->AcquireRingSlot(pSlotId);
+
+    Result result = m_pDmaUploadRing->AcquireRingSlot(pSlotId);
+    while (result == Result::NotReady)
+    {
+        // The open upload batch is full and other threads are still recording into it; wait for them to finish.
+        result = WaitForUploadBatchDrained();
+        if (result == Result::Success)
+        {
+            result = m_pDmaUploadRing->AcquireRingSlot(pSlotId);
+        }
+    }
+
+    return result;
 }
 
 // =====================================================================================================================
-// Record commands which upload part of pipeline ELF from CPU to GPU.
+// Record commands which upload part of pipeline ELF from CPU to GPU. The ring slot is shared by every pipeline in the
+// current upload batch, so recording is serialized as well.
 size_t Device::UploadUsingEmbeddedData(
     UploadRingSlot  slotId,
     Pal::GpuMemory* pDst,
@@ -2378,13 +2443,15 @@ size_t Device::UploadUsingEmbeddedData(
     size_t          bytes,
     void**          ppEmbeddedData)
 {
+    Util::MutexAuto lock(&m_dmaUploadRingLock);
+
     PAL_ASSERT(m_pDmaUploadRing != nullptr);
     return m_pDmaUploadRing->UploadUsingEmbeddedData(slotId,pDst,dstOffset,bytes,ppEmbeddedData);
 }
 
 // =====================================================================================================================
-// Submit command buffer at slotId to the DmaUploadRing's internal dma queue.
-// pCompletionFence is used to track when GPU finishes the work of this command buffer.
+// Finish an upload recorded at slotId of the DmaUploadRing. The upload's batch is submitted to the internal dma queue
+// once it is full or a submission waits on it. pCompletionFence is used to track when GPU finishes the batch.
 Result Device::SubmitDmaUploadRing(
     UploadRingSlot    slotId,
     UploadFenceToken* pCompletionFence,
@@ -2393,11 +2460,18 @@ Result Device::SubmitDmaUploadRing(
     Util::MutexAuto lock(&m_dmaUploadRingLock);
 
     PAL_ASSERT(m_pDmaUploadRing != nullptr);
-    return m_pDmaUploadRing->Submit(slotId, pCompletionFence, pagingFenceVal);
+    const Result result = m_pDmaUploadRing->Submit(slotId, pCompletionFence, pagingFenceVal);
+
+    if (m_pDmaUploadRing->IsBatchDrained())
+    {
+        m_dmaUploadBatchDrained.WakeAll();
+    }
+
+    return result;
 }
 
 // =====================================================================================================================
-// pWaiter will wait until DmaUploadRing's internal dma queue's internal fence value reach fenceValue.
+// pWaiter will wait until DmaUploadRing's internal dma queue has finished the upload batch identified by fenceValue.
 Result Device::WaitForPendingUpload(
     Pal::Queue*      pWaiter,
     UploadFenceToken fenceValue)
@@ -2405,7 +2479,55 @@ Result Device::WaitForPendingUpload(
     Util::MutexAuto lock(&m_dmaUploadRingLock);
 
     PAL_ASSERT(m_pDmaUploadRing != nullptr);
-    return m_pDmaUploadRing->WaitForPendingUpload(pWaiter, fenceValue);
+
+    Result result = m_pDmaUploadRing->WaitForPendingUpload(pWaiter, fenceValue);
+    while (result == Result::NotReady)
+    {
+        // The batch is still being recorded by pipeline creation on other threads; wait for them to finish.
+        result = WaitForUploadBatchDrained();
+        if (result == Result::Success)
+        {
+            result = m_pDmaUploadRing->WaitForPendingUpload(pWaiter, fenceValue);
+        }
+    }
+
+    return result;
+}
+
+// =====================================================================================================================
+// Blocks the calling thread until the GPU has finished the upload batch identified by fenceValue. Used before freeing
+// GPU memory which that batch may still copy into. The ring lock is only held to flush the batch and pin its fence, so
+// other threads keep uploading while this one waits on the GPU.
+Result Device::WaitForPendingUploadCpu(
+    UploadFenceToken fenceValue)
+{
+    PAL_ASSERT(m_pDmaUploadRing != nullptr);
+
+    IFence* pFence = nullptr;
+    Result  result = Result::Success;
+    {
+        Util::MutexAuto lock(&m_dmaUploadRingLock);
+
+        result = m_pDmaUploadRing->BeginCpuWait(fenceValue, &pFence);
+        while (result == Result::NotReady)
+        {
+            result = WaitForUploadBatchDrained();
+            if (result == Result::Success)
+            {
+                result = m_pDmaUploadRing->BeginCpuWait(fenceValue, &pFence);
+            }
+        }
+    }
+
+    if (pFence != nullptr)
+    {
+        result = WaitForFences(1, &pFence, true, UINT64_MAX);
+
+        Util::MutexAuto lock(&m_dmaUploadRingLock);
+        m_pDmaUploadRing->EndCpuWait(fenceValue);
+    }
+
+    return result;
 }
 
 // =====================================================================================================================
@@ -2939,6 +3061,44 @@ Result Device::CreateIndirectCmdGenerator(
     return result;
 }
 
+#if PAL_CLIENT_INTERFACE_MAJOR_VERSION >= 642
+// =====================================================================================================================
+// Determines the size in bytes of a command token stream object.  Token streams don't depend on the GPU so they are
+// supported on every device.
+// NOTE: Part of the public IDevice interface.
+size_t Device::GetCmdTokenStreamSize(
+    const CmdTokenStreamCreateInfo& createInfo,
+    Result*                         pResult
+    ) const
+{
+    if (pResult != nullptr)
+    {
+        (*pResult) = Result::Success;
+    }
+
+    return sizeof(ClientCmdTokenStream);
+}
+
+// =====================================================================================================================
+// Constructs a new command token stream object.  Its token storage is allocated by the first Begin().
+// NOTE: Part of the public IDevice interface.
+Result Device::CreateCmdTokenStream(
+    const CmdTokenStreamCreateInfo& createInfo,
+    void*                           pPlacementAddr,
+    ICmdTokenStream**               ppTokenStream)
+{
+    Result result = Result::ErrorInvalidPointer;
+
+    if ((pPlacementAddr != nullptr) && (ppTokenStream != nullptr))
+    {
+        (*ppTokenStream) = PAL_PLACEMENT_NEW(pPlacementAddr) ClientCmdTokenStream(GetPlatform(), createInfo);
+        result           = Result::Success;
+    }
+
+    return result;
+}
+#endif
+
 // =====================================================================================================================
 // Determines the size in bytes of a QueueSemaphore object.
 size_t Device::GetQueueSemaphoreSize(
@@ -3137,9 +3297,27 @@ Result Device::CreateGpuEvent(
 {
     PAL_ASSERT((pPlacementAddr != nullptr) && (ppGpuEvent != nullptr));
 
-    (*ppGpuEvent) = PAL_PLACEMENT_NEW(pPlacementAddr) GpuEvent(createInfo, this);
+    Result    result    = Result::Success;
+    GpuEvent* pGpuEvent = PAL_PLACEMENT_NEW(pPlacementAddr) GpuEvent(createInfo, this);
 
-    return Result::Success;
+#if PAL_CLIENT_INTERFACE_MAJOR_VERSION >= 642
+    // Events which opt into internal binding are packed together into the internal memory manager's pools.
+    if (createInfo.flags.internalMemBind == 1)
+    {
+        result = m_memMgr.AllocateAndBindGpuMem(pGpuEvent, false);
+    }
+#endif
+
+    if (result == Result::Success)
+    {
+        (*ppGpuEvent) = pGpuEvent;
+    }
+    else
+    {
+        pGpuEvent->Destroy();
+    }
+
+    return result;
 }
 
 // =====================================================================================================================
@@ -3204,6 +3382,23 @@ Result Device::CreateQueryPool(
         break;
     }
 
+#if PAL_CLIENT_INTERFACE_MAJOR_VERSION >= 642
+    // Query pools which opt into internal binding are packed together into the internal memory manager's pools. This
+    // method is const, so reach the (mutable) memory manager through the GFX device's parent.
+    if ((result == Result::Success) && (createInfo.flags.internalMemBind == 1))
+    {
+        QueryPool*const pQueryPool = static_cast<QueryPool*>(*ppQueryPool);
+
+        result = pQueryPool->AllocateAndBindInternalGpuMemory(m_pGfxDevice->Parent()->MemMgr());
+
+        if (result != Result::Success)
+        {
+            pQueryPool->Destroy();
+            (*ppQueryPool) = nullptr;
+        }
+    }
+#endif
+
     return result;
 }
 
@@ -4218,6 +4413,61 @@ bool Device::ReadSetting(
 #endif
 }
 
+// =====================================================================================================================
+// Starts the thread which watches the settings file, if the AMD_CONFIG_WATCH environment variable asked for it.
+void Device::StartSettingsWatch()
+{
+#if defined(__unix__)
+    if ((m_settingsWatchInterval != 0) && (m_settingsWatchThread.IsCreated() == false))
+    {
+        m_settingsWatchStop.Reset();
+
+        const Result result = m_settingsWatchThread.Begin(&Device::SettingsWatchThreadFunc, this);
+        PAL_ALERT(result != Result::Success);
+    }
+#endif
+}
+
+// =====================================================================================================================
+// Stops the settings file watch thread, if it is running. Nothing reloads the runtime settings once this returns.
+void Device::StopSettingsWatch()
+{
+#if defined(__unix__)
+    if (m_settingsWatchThread.IsCreated())
+    {
+        m_settingsWatchStop.Set();
+        m_settingsWatchThread.Join();
+    }
+#endif
+}
+
+// =====================================================================================================================
+void Device::SettingsWatchThreadFunc(
+    void* pParameter)
+{
+    static_cast<Device*>(pParameter)->RunSettingsWatch();
+}
+
+// =====================================================================================================================
+// Body of the settings watch thread: reloads the settings file once per watch interval and publishes new runtime
+// settings if the file changed. This keeps the file I/O off the submit path.
+void Device::RunSettingsWatch()
+{
+#if defined(__unix__)
+    const float interval = static_cast<float>(m_settingsWatchInterval) / 1000.0f;
+
+    while (m_settingsWatchStop.Wait(interval) == Result::Timeout)
+    {
+        bool changed = false;
+        if ((m_settingsMgr.Reload(&changed) == Result::Success) && changed)
+        {
+            PAL_DPINFO("Reloading runtime settings from %s", m_settingsMgr.GetFilePath());
+            m_pSettingsLoader->ReloadRuntimeSettings();
+        }
+    }
+#endif
+}
+
 // =====================================================================================================================
 // Gets currently connected private screens.
 Result Device::GetPrivateScreens(
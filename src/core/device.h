@@ -32,7 +32,9 @@
 #include "core/hw/ossip/ossDevice.h"
 #include "core/addrMgr/addrMgr.h"
 #include "core/dmaUploadRing.h"
+#include "core/queueSemaphoreWaitService.h"
 #include "palCmdAllocator.h"
+#include "palConditionVariable.h"
 #include "palDevice.h"
 #include "palDeque.h"
 #include "palEvent.h"
@@ -45,6 +47,7 @@
 #include "palSettingsFileMgr.h"
 #endif
 #include "palSysMemory.h"
+#include "palThread.h"
 #include "palTextWriter.h"
 #if PAL_CLIENT_INTERFACE_MAJOR_VERSION >= 556
 #include "palShaderLibrary.h"
@@ -68,11 +71,13 @@ class  OssDevice;
 class  Platform;
 class  SettingsLoader;
 class  Queue;
+class  QueueSemaphore;
 struct ApplicationProfile;
 struct DeviceFinalizeInfo;
 struct CmdBufferInternalCreateInfo;
 struct GpuMemoryInternalCreateInfo;
 struct PalSettings;
+struct RuntimeSettings;
 
 // Indicates to the address lib not to use tile index.
 constexpr int32 TileIndexUnused = -1;
@@ -1549,6 +1554,19 @@ public:
         void*                                 pPlacementAddr,
         IIndirectCmdGenerator**               ppGenerator) const override;
 
+#if PAL_CLIENT_INTERFACE_MAJOR_VERSION >= 642
+    // NOTE: Part of the public IDevice interface.
+    virtual size_t GetCmdTokenStreamSize(
+        const CmdTokenStreamCreateInfo& createInfo,
+        Result*                         pResult) const override;
+
+    // NOTE: Part of the public IDevice interface.
+    virtual Result CreateCmdTokenStream(
+        const CmdTokenStreamCreateInfo& createInfo,
+        void*                           pPlacementAddr,
+        ICmdTokenStream**               ppTokenStream) override;
+#endif
+
     // NOTE: Part of the public IDevice interface.
     virtual Result GetPrivateScreens(
         uint32*          pNumScreens,
@@ -1685,6 +1703,16 @@ public:
 
     uint32 MaxQueueSemaphoreCount() const { return m_maxSemaphoreCount; }
 
+    QueueSemaphoreWaitService* GetQueueSemaphoreWaitService() { return &m_semaphoreWaitService; }
+
+    // Blocks until a signal has been submitted for at least one of the given timeline semaphore points, or until the
+    // timeout expires. Used by the QueueSemaphoreWaitService to multiplex many semaphore waits in one OS call.
+    virtual Result WaitForSemaphoresAvailable(
+        uint32                      semaphoreCount,
+        const QueueSemaphore*const* ppSemaphores,
+        const uint64*               pValues,
+        uint64                      timeoutNs) const { return Result::Unsupported; }
+
     // Helper method to index into the format support info table.
     FormatFeatureFlags FeatureSupportFlags(ChNumFormat format, ImageTiling tiling) const
     {
@@ -1903,6 +1931,8 @@ public:
         Pal::Queue* pWaiter,
         UploadFenceToken fenceValue);
 
+    Result WaitForPendingUploadCpu(UploadFenceToken fenceValue);
+
     virtual bool IsHwEmulationEnabled() const { return false; }
 
 protected:
@@ -2085,14 +2115,21 @@ protected:
 
 #if defined(__unix__)
     Util::SettingsFileMgr<Platform>  m_settingsMgr;
+    uint32                           m_settingsWatchInterval; // Milliseconds between settings file polls, or zero.
+    Util::Thread                     m_settingsWatchThread;   // Reloads the runtime settings when the file changes.
+    Util::Event                      m_settingsWatchStop;     // Signaled to make m_settingsWatchThread exit.
 #endif
 
     // Get*FilePath need to return a persistent storage
     char m_cacheFilePath[MaxPathStrLen];
     char m_debugFilePath[MaxPathStrLen];
 
-    Util::Mutex m_dmaUploadRingLock;
-    DmaUploadRing* m_pDmaUploadRing;
+    Util::Mutex             m_dmaUploadRingLock;
+    Util::ConditionVariable m_dmaUploadBatchDrained; // Signaled when the last uploader finishes the open upload batch.
+    DmaUploadRing*          m_pDmaUploadRing;
+
+    // Releases Queues blocked on timeline semaphores that can be signaled from outside of PAL.
+    QueueSemaphoreWaitService m_semaphoreWaitService;
 
 private:
     Result HwlEarlyInit();
@@ -2106,6 +2143,13 @@ private:
 
     Result CreateDummyCommandStreams();
 
+    Result WaitForUploadBatchDrained();
+
+    void StartSettingsWatch();
+    void StopSettingsWatch();
+    void RunSettingsWatch();
+    static void SettingsWatchThreadFunc(void* pParameter);
+
     uint64 GetTimeoutValueInNs(uint64  appTimeoutInNs) const;
 
     typedef Util::HashMap<IGpuMemory*, uint32, Pal::Platform>  MemoryRefMap;
@@ -68,8 +68,15 @@ DmaCmdBuffer::DmaCmdBuffer(
     m_predInternalAddr(0),
     m_predCopyData(0),
     m_pT2tEmbeddedGpuMemory(nullptr),
-    m_t2tEmbeddedMemOffset(0)
+    m_t2tEmbeddedMemOffset(0),
+    m_t2tStagingWindowBytes(0),
+    m_t2tStagingWindow(0)
 {
+    m_pT2tStagingGpuMemory[0] = nullptr;
+    m_pT2tStagingGpuMemory[1] = nullptr;
+    m_t2tStagingMemOffset[0]  = 0;
+    m_t2tStagingMemOffset[1]  = 0;
+
     PAL_ASSERT(createInfo.queueType == QueueTypeDma);
 
     SwitchCmdSetUserDataFunc(PipelineBindPoint::Compute,  &DummyCmdSetUserData);
@@ -137,7 +144,9 @@ Result DmaCmdBuffer::BeginCommandStreams(
 
     if (doReset)
     {
-        m_pT2tEmbeddedGpuMemory = nullptr;
+        m_pT2tEmbeddedGpuMemory   = nullptr;
+        m_pT2tStagingGpuMemory[0] = nullptr;
+        m_pT2tStagingGpuMemory[1] = nullptr;
         m_cmdStream.Reset(nullptr, true);
     }
 
@@ -165,9 +174,10 @@ Result DmaCmdBuffer::End()
     {
 
 #if PAL_ENABLE_PRINTS_ASSERTS
-        if (IsDumpingEnabled() && DumpFile()->IsOpen())
+        // The dump file is only open if dumping was enabled when this command buffer was begun.
+        if (DumpFile()->IsOpen())
         {
-            if (m_pDevice->Settings().cmdBufDumpFormat == CmdBufDumpFormatBinaryHeaders)
+            if (DumpFormat() == CmdBufDumpFormatBinaryHeaders)
             {
                 const CmdBufferDumpFileHeader fileHeader =
                 {
@@ -191,7 +201,7 @@ Result DmaCmdBuffer::End()
                 DumpFile()->Write(&listHeader, sizeof(listHeader));
             }
 
-            DumpCmdStreamsToFile(DumpFile(), m_pDevice->Settings().cmdBufDumpFormat);
+            DumpCmdStreamsToFile(DumpFile(), DumpFormat());
             DumpFile()->Close();
         }
 #endif
@@ -210,7 +220,9 @@ Result DmaCmdBuffer::Reset(
     Result result = CmdBuffer::Reset(pCmdAllocator, returnGpuMemory);
 
     // The next scanline-based tile-to-tile copy will need to allocate a new embedded memory object
-    m_pT2tEmbeddedGpuMemory = nullptr;
+    m_pT2tEmbeddedGpuMemory   = nullptr;
+    m_pT2tStagingGpuMemory[0] = nullptr;
+    m_pT2tStagingGpuMemory[1] = nullptr;
 
     m_cmdStream.Reset(static_cast<CmdAllocator*>(pCmdAllocator), returnGpuMemory);
 
@@ -393,6 +405,9 @@ void DmaCmdBuffer::CmdAcquire(
 void DmaCmdBuffer::CmdReleaseThenAcquire(
     const AcquireReleaseInfo& barrierInfo)
 {
+    // CmdRelease() and CmdAcquire() are both implemented on top of this function, so counting here covers them too.
+    m_cpuStats.numBarriers++;
+
     bool imageTypeRequiresCopyOverlapHazardSyncs = false;
     if (m_copyOverlapHazardSyncs == ((1 << static_cast<uint32>(ImageType::Count)) - 1))
     {
@@ -469,6 +484,30 @@ void DmaCmdBuffer::CopyMemoryRegion(
     }
 }
 
+// =====================================================================================================================
+// Returns true if "next" directly continues "prev" in both the source and the destination, so that both regions can be
+// copied as one larger region without changing the result. If both regions live in the same memory object, the merged
+// source and destination ranges must also not overlap: the regions were copied one after the other, but a single copy
+// of overlapping ranges is undefined.
+static bool CanMergeCopyRegions(
+    const MemoryCopyRegion& prev,
+    const MemoryCopyRegion& next,
+    bool                    sameMemory)
+{
+    bool canMerge = (next.srcOffset == (prev.srcOffset + prev.copySize)) &&
+                    (next.dstOffset == (prev.dstOffset + prev.copySize));
+
+    if (canMerge && sameMemory)
+    {
+        const gpusize mergedSize = prev.copySize + next.copySize;
+
+        canMerge = ((prev.srcOffset + mergedSize) <= prev.dstOffset) ||
+                   ((prev.dstOffset + mergedSize) <= prev.srcOffset);
+    }
+
+    return canMerge;
+}
+
 // =====================================================================================================================
 void DmaCmdBuffer::CmdCopyMemory(
     const IGpuMemory&       srcGpuMemory,
@@ -528,15 +567,32 @@ void DmaCmdBuffer::CmdCopyMemory(
         }
     }
 
-    // Splits up each region's copy size into chunks that the specific hardware can handle.
+    // Splits up each region's copy size into chunks that the specific hardware can handle. Clients often pass long runs
+    // of small regions which are contiguous in both memory objects (e.g., batched sub-allocations); each such run is
+    // copied as one region so it shares maximal-size copy packets instead of emitting at least one packet per region.
+    // The P2P workaround needs to see every chunk individually, so it disables merging.
+    const bool sameMemory = (&srcGpuMemory == &dstGpuMemory);
+
     for (uint32 rgnIdx = 0; rgnIdx < regionCount; rgnIdx++)
     {
         if (p2pBltInfoRequired)
         {
             P2pBltWaCopyNextRegion(chunkAddrs[rgnIdx]);
+            CopyMemoryRegion(srcGpuMemory, dstGpuMemory, pRegions[rgnIdx]);
         }
+        else
+        {
+            MemoryCopyRegion mergedRegion = pRegions[rgnIdx];
 
-        CopyMemoryRegion(srcGpuMemory, dstGpuMemory, pRegions[rgnIdx]);
+            while (((rgnIdx + 1) < regionCount) &&
+                   CanMergeCopyRegions(mergedRegion, pRegions[rgnIdx + 1], sameMemory))
+            {
+                rgnIdx++;
+                mergedRegion.copySize += pRegions[rgnIdx].copySize;
+            }
+
+            CopyMemoryRegion(srcGpuMemory, dstGpuMemory, mergedRegion);
+        }
     }
 
     if (p2pBltInfoRequired)
@@ -651,6 +707,46 @@ void DmaCmdBuffer::AllocateEmbeddedT2tMemory()
     PAL_ASSERT(m_pT2tEmbeddedGpuMemory != nullptr);
 }
 
+// =====================================================================================================================
+// Allocates the two linear staging windows used by chunked tile-to-tile copies. The windows come from whichever of the
+// command allocator's GPU scratch or embedded data chunks is larger; SDMA doesn't need CPU access to this memory so the
+// (typically larger and GPU-local) scratch memory is preferred.
+void DmaCmdBuffer::AllocateT2tStagingMemory()
+{
+    PAL_ASSERT(m_pT2tStagingGpuMemory[0] == nullptr);
+
+    const uint32 embeddedDataLimit = GetEmbeddedDataLimit();
+    const uint32 scratchMemLimit   = m_gpuScratchMemAllocLimit;
+
+    // Each window gets its own allocation so that it is as large as the biggest single allocation either source can
+    // provide. This keeps every window at least as large as the single embedded-data window used before.
+    const bool   useScratchMem = (scratchMemLimit > embeddedDataLimit);
+    const uint32 windowDwords  = useScratchMem ? scratchMemLimit : embeddedDataLimit;
+
+    for (uint32 window = 0; window < 2; window++)
+    {
+        if (useScratchMem)
+        {
+            AllocateGpuScratchMem(windowDwords,
+                                  1, // SDMA can access dword aligned linear data.
+                                  &m_pT2tStagingGpuMemory[window],
+                                  &m_t2tStagingMemOffset[window]);
+        }
+        else
+        {
+            CmdAllocateEmbeddedData(windowDwords,
+                                    1, // SDMA can access dword aligned linear data.
+                                    &m_pT2tStagingGpuMemory[window],
+                                    &m_t2tStagingMemOffset[window]);
+        }
+
+        PAL_ASSERT(m_pT2tStagingGpuMemory[window] != nullptr);
+    }
+
+    m_t2tStagingWindowBytes = windowDwords * sizeof(uint32);
+    m_t2tStagingWindow      = 0;
+}
+
 // =====================================================================================================================
 // Tiled image to tiled image copy, chunk by chunk.
 void DmaCmdBuffer::WriteCopyImageTiledToTiledCmdChunkCopy(
@@ -668,61 +764,61 @@ void DmaCmdBuffer::WriteCopyImageTiledToTiledCmdChunkCopy(
     const ImageType srcImageType = GetImageType(*src.pImage);
     const ImageType dstImageType = GetImageType(*dst.pImage);
 
+    // We only need one instance of this memory for the entire life of this command buffer.  Allocate it on an
+    // as-needed basis.
+    if (m_pT2tStagingGpuMemory[0] == nullptr)
+    {
+        AllocateT2tStagingMemory();
+    }
+
     // Calculate the maximum number of pixels we can copy per pass in the below loop
-    const uint32 embeddedDataLimitBytes = GetEmbeddedDataLimit() * sizeof(uint32);
+    const uint32 stagingLimitBytes = m_t2tStagingWindowBytes;
 
     // How big a window can we copy given our linear data limit?
     uint32 widthToCopy   = 1;
     uint32 heightToCopy  = 1;
     uint32 depthToCopy   = 1;
     uint32 copySizeBytes = src.bytesPerPixel;
-    PAL_ASSERT(copySizeBytes <= embeddedDataLimitBytes); //If we can't fit one pixel... then what?
-    if (embeddedDataLimitBytes > copySizeBytes)
+    PAL_ASSERT(copySizeBytes <= stagingLimitBytes); //If we can't fit one pixel... then what?
+    if (stagingLimitBytes > copySizeBytes)
     {
         //Widen the copy area to possibly fit more texels.
-        widthToCopy   = Min((embeddedDataLimitBytes / copySizeBytes), imageCopyInfo.copyExtent.width);
+        widthToCopy   = Min((stagingLimitBytes / copySizeBytes), imageCopyInfo.copyExtent.width);
         copySizeBytes = widthToCopy * src.bytesPerPixel;
-        if (embeddedDataLimitBytes > copySizeBytes)
+        if (stagingLimitBytes > copySizeBytes)
         {
             //Heighten the copy area to possibly fit more rows.
-            heightToCopy  = Min((embeddedDataLimitBytes / copySizeBytes), imageCopyInfo.copyExtent.height);
+            heightToCopy  = Min((stagingLimitBytes / copySizeBytes), imageCopyInfo.copyExtent.height);
             copySizeBytes = widthToCopy * heightToCopy * src.bytesPerPixel;
-            if (embeddedDataLimitBytes > copySizeBytes)
+            if (stagingLimitBytes > copySizeBytes)
             {
                 //Deepen the copy area to possibly fit more slices- but only if we're copying 3D textures.
                 //If either the input or output is a texture array, we have to do it one slice at a time.
                 if ((ImageType::Tex3d == srcImageType) && (ImageType::Tex3d == dstImageType))
                 {
-                    depthToCopy = Min((embeddedDataLimitBytes / copySizeBytes), imageCopyInfo.copyExtent.depth);
+                    depthToCopy = Min((stagingLimitBytes / copySizeBytes), imageCopyInfo.copyExtent.depth);
                     copySizeBytes = widthToCopy * heightToCopy * depthToCopy * src.bytesPerPixel;
                 }
             }
         }
     }
-    PAL_ASSERT(copySizeBytes <= embeddedDataLimitBytes);
-
-    // We only need one instance of this memory for the entire life of this command buffer.  Allocate it on an
-    // as-needed basis.
-    if (m_pT2tEmbeddedGpuMemory == nullptr)
-    {
-        AllocateEmbeddedT2tMemory();
-
-        PAL_ASSERT(m_pT2tEmbeddedGpuMemory != nullptr);
-    }
+    PAL_ASSERT(copySizeBytes <= stagingLimitBytes);
 
     // A lot of the parameters are a constant for each copy region, so set those up here.
     MemoryImageCopyRegion  linearDstCopyRgn = {};
     linearDstCopyRgn.imageSubres        = src.pSubresInfo->subresId;
     linearDstCopyRgn.gpuMemoryRowPitch   = widthToCopy * src.bytesPerPixel;
     linearDstCopyRgn.gpuMemoryDepthPitch = widthToCopy * heightToCopy * src.bytesPerPixel;
-    linearDstCopyRgn.gpuMemoryOffset     = m_t2tEmbeddedMemOffset;
 
     MemoryImageCopyRegion  tiledDstCopyRgn = linearDstCopyRgn;
     tiledDstCopyRgn.imageSubres            = dst.pSubresInfo->subresId;
 
     // Tiled to tiled copies have been determined to not work for this case, so a dual-stage copy is required.
-    // Because we have a limit on the amount of embedded data, we're going to do the copy chunk by chunk.
+    // Because we have a limit on the amount of staging memory, we're going to do the copy chunk by chunk.
     // First by trying to go scanline by scanline, then groups of scanlines, then groups of [slices|depth].
+    // Consecutive chunks alternate between the two staging windows. The barrier between the two halves of a chunk
+    // also waits for the previous chunk, which read from the other window, so no barrier is needed before a window is
+    // overwritten again.
     Pal::HwPipePoint  pipePoints   = HwPipePoint::HwPipeBottom;
     Pal::BarrierInfo  barrierInfo  = {};
     barrierInfo.pipePointWaitCount = 1;
@@ -805,19 +901,29 @@ void DmaCmdBuffer::WriteCopyImageTiledToTiledCmdChunkCopy(
                 linearDstCopyRgn.imageOffset.x = src.offset.x + xIdx;
                 tiledDstCopyRgn.imageOffset.x  = dst.offset.x + xIdx;
 
+                linearDstCopyRgn.gpuMemoryOffset = m_t2tStagingMemOffset[m_t2tStagingWindow];
+                tiledDstCopyRgn.gpuMemoryOffset  = m_t2tStagingMemOffset[m_t2tStagingWindow];
+
                 pCmdSpace  = m_cmdStream.ReserveCommands();
-                pCmdSpace = WriteCopyTiledImageToMemCmd(src, *m_pT2tEmbeddedGpuMemory, linearDstCopyRgn, pCmdSpace);
+                pCmdSpace = WriteCopyTiledImageToMemCmd(src,
+                                                        *m_pT2tStagingGpuMemory[m_t2tStagingWindow],
+                                                        linearDstCopyRgn,
+                                                        pCmdSpace);
                 m_cmdStream.CommitCommands(pCmdSpace);
 
                 // Potentially have to wait for the copy to finish before we transfer out of that memory
                 CmdBarrier(barrierInfo);
 
                 pCmdSpace  = m_cmdStream.ReserveCommands();
-                pCmdSpace = WriteCopyMemToTiledImageCmd(*m_pT2tEmbeddedGpuMemory, dst, tiledDstCopyRgn, pCmdSpace);
+                pCmdSpace = WriteCopyMemToTiledImageCmd(*m_pT2tStagingGpuMemory[m_t2tStagingWindow],
+                                                        dst,
+                                                        tiledDstCopyRgn,
+                                                        pCmdSpace);
                 m_cmdStream.CommitCommands(pCmdSpace);
 
-                // Wait for this copy to finish before we re-use the temp-linear buffer above.
-                CmdBarrier(barrierInfo);
+                // The next chunk fills the other window while this one drains. The window index persists across
+                // calls so back-to-back copies keep alternating too.
+                m_t2tStagingWindow ^= 1;
             }
         }
     }
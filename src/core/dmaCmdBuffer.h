@@ -245,6 +245,7 @@ protected:
     virtual void WriteCopyImageTiledToTiledCmdChunkCopy(const DmaImageCopyInfo& imageCopyInfo);
 
     void AllocateEmbeddedT2tMemory();
+    void AllocateT2tStagingMemory();
 
     bool HandleImageTransition(
         const IImage* pImage,
@@ -363,6 +364,13 @@ private:
     GpuMemory*   m_pT2tEmbeddedGpuMemory;    // Temp memory used for scanline tile-to-tile copies.
     gpusize      m_t2tEmbeddedMemOffset;
 
+    // Double-buffered linear staging memory used by chunked tile-to-tile copies. Chunks alternate between the two
+    // windows so that filling one window can overlap with draining the other.
+    GpuMemory*   m_pT2tStagingGpuMemory[2];
+    gpusize      m_t2tStagingMemOffset[2];
+    uint32       m_t2tStagingWindowBytes;   // Size of each staging window.
+    uint32       m_t2tStagingWindow;        // Index of the window the next chunk will use.
+
     PAL_DISALLOW_COPY_AND_ASSIGN(DmaCmdBuffer);
     PAL_DISALLOW_DEFAULT_CTOR(DmaCmdBuffer);
 };
@@ -50,9 +50,17 @@ DmaUploadRing::DmaUploadRing(
     m_ringCapacity(RingInitEntries),
     m_firstEntryInUse(0),
     m_firstEntryFree(0),
-    m_numEntriesInUse(0)
+    m_numEntriesInUse(0),
+    m_nextBatchId(1),
+    m_batchOpen(false),
+    m_batchClosed(false),
+    m_batchSlot(0),
+    m_batchUploaders(0),
+    m_batchUploads(0),
+    m_batchBytes(0),
+    m_batchPagingFence(0)
 {
-
+    memset(&m_pendingCopy, 0, sizeof(m_pendingCopy));
 }
 
 // =====================================================================================================================
@@ -122,9 +130,18 @@ Result DmaUploadRing::ResizeRing()
 
     if (result == Result::Success)
     {
-        // clear the second half of the new ring to 0.
+        // The ring is full, so the entries in use start at m_firstEntryInUse and wrap around to it. Unroll them into
+        // the first half of the new ring to keep them in submission order, and clear the second half to 0.
+        const uint32 numHeadEntries = (m_ringCapacity - m_firstEntryInUse);
         memset(Util::VoidPtrInc(pNewRing, sizeof(Entry)*m_ringCapacity), 0, sizeof(Entry)*m_ringCapacity);
-        memcpy(pNewRing, m_pRing, sizeof(Entry)*m_ringCapacity);
+        memcpy(pNewRing, &m_pRing[m_firstEntryInUse], sizeof(Entry)*numHeadEntries);
+        memcpy(&pNewRing[numHeadEntries], m_pRing, sizeof(Entry)*m_firstEntryInUse);
+
+        if (m_batchOpen)
+        {
+            m_batchSlot = (m_batchSlot + numHeadEntries) % m_ringCapacity;
+        }
+
         m_firstEntryInUse = 0;
         m_firstEntryFree  = m_ringCapacity;
         // m_numEntriesInUse does not change when resizing the ring.
@@ -145,7 +162,7 @@ Result DmaUploadRing::FreeFinishedSlots()
     {
         PAL_ASSERT((m_pRing[m_firstEntryInUse].pCmdBuf != nullptr) && (m_pRing[m_firstEntryInUse].pFence != nullptr));
         Entry* pEntry = &m_pRing[m_firstEntryInUse];
-        if (pEntry->pFence->GetStatus() == Result::Success)
+        if ((pEntry->cpuWaiters == 0) && (pEntry->pFence->GetStatus() == Result::Success))
         {
             result = m_pDevice->ResetFences(1, &pEntry->pFence);
         }
@@ -166,6 +183,34 @@ Result DmaUploadRing::FreeFinishedSlots()
 // =====================================================================================================================
 Result DmaUploadRing::AcquireRingSlot(
     UploadRingSlot* pSlotId)
+{
+    Result result = Result::Success;
+
+    if (m_batchOpen == false)
+    {
+        result = OpenBatch(pSlotId);
+    }
+    else if (m_batchClosed == false)
+    {
+        // Join the open batch.
+        m_batchUploaders++;
+        (*pSlotId) = m_batchSlot;
+    }
+    else
+    {
+        // The open batch is full but other uploaders are still recording into it. It must be submitted before a new
+        // batch is opened so that batches reach the DMA queue in the order of their identifiers.
+        PAL_ASSERT(m_batchUploaders > 0);
+        result = Result::NotReady;
+    }
+
+    return result;
+}
+
+// =====================================================================================================================
+// Begins a new upload batch in the next free ring entry, growing the ring if needed.
+Result DmaUploadRing::OpenBatch(
+    UploadRingSlot* pSlotId)
 {
     Result result = FreeFinishedSlots();
     PAL_ASSERT(result == Result::Success);
@@ -211,6 +256,17 @@ Result DmaUploadRing::AcquireRingSlot(
 
     if (result == Result::Success)
     {
+        m_pRing[m_firstEntryFree].batchId   = m_nextBatchId++;
+        m_pRing[m_firstEntryFree].timestamp = 0;
+
+        m_batchOpen        = true;
+        m_batchClosed      = false;
+        m_batchSlot        = m_firstEntryFree;
+        m_batchUploaders   = 1;
+        m_batchUploads     = 0;
+        m_batchBytes       = 0;
+        m_batchPagingFence = 0;
+
         (*pSlotId) = m_firstEntryFree;
         m_firstEntryFree = (m_firstEntryFree + 1) % m_ringCapacity;
         m_numEntriesInUse++;
@@ -241,51 +297,221 @@ size_t DmaUploadRing::UploadUsingEmbeddedData(
                                                        &gpuMemOffset);
 
     PAL_ASSERT(pEmbeddedData != nullptr);
-    *ppEmbeddedData             = pEmbeddedData;
-    MemoryCopyRegion copyRegion = { };
-    copyRegion.copySize         = allocSize;
-    copyRegion.dstOffset        = dstOffset;
-    copyRegion.srcOffset        = gpuMemOffset;
+    PAL_ASSERT(m_batchOpen && (slotId == m_batchSlot));
+    *ppEmbeddedData = pEmbeddedData;
+    m_batchBytes   += allocSize;
+
+    MemoryCopyRegion*const pPending = &m_pendingCopy.region;
+    if ((pPending->copySize > 0)                                    &&
+        (m_pendingCopy.pSrc == pGpuMem)                             &&
+        (m_pendingCopy.pDst == pDst)                                &&
+        ((pPending->srcOffset + pPending->copySize) == gpuMemOffset) &&
+        ((pPending->dstOffset + pPending->copySize) == dstOffset))
+    {
+        // This copy continues the pending one in both source and destination, so grow it instead of recording a
+        // separate copy. Uploads of consecutive sections and pipelines often collapse into a few large copies.
+        pPending->copySize += allocSize;
+    }
+    else
+    {
+        FlushPendingCopy();
 
-    m_pRing[slotId].pCmdBuf->CmdCopyMemory(*pGpuMem, *pDst, 1, &copyRegion);
+        m_pendingCopy.pSrc  = pGpuMem;
+        m_pendingCopy.pDst  = pDst;
+        pPending->copySize  = allocSize;
+        pPending->dstOffset = dstOffset;
+        pPending->srcOffset = gpuMemOffset;
+    }
 
     return allocSize;
 }
 
+// =====================================================================================================================
+// Records the pending copy of the open batch into its command buffer.
+void DmaUploadRing::FlushPendingCopy()
+{
+    if (m_pendingCopy.region.copySize > 0)
+    {
+        m_pRing[m_batchSlot].pCmdBuf->CmdCopyMemory(*m_pendingCopy.pSrc,
+                                                    *m_pendingCopy.pDst,
+                                                    1,
+                                                    &m_pendingCopy.region);
+        memset(&m_pendingCopy, 0, sizeof(m_pendingCopy));
+    }
+}
+
 // =====================================================================================================================
 Result DmaUploadRing::Submit(
     UploadRingSlot    slotId,
     UploadFenceToken* pCompletionFence,
     uint64            pagingFenceVal)
 {
-    Result result = m_pRing[slotId].pCmdBuf->End();
+    PAL_ASSERT(m_batchOpen && (slotId == m_batchSlot) && (m_batchUploaders > 0));
+
+    Result result = Result::Success;
+
+    m_batchUploaders--;
+    m_batchUploads++;
+    m_batchPagingFence = Util::Max(m_batchPagingFence, pagingFenceVal);
+    *pCompletionFence  = m_pRing[slotId].batchId;
+
+    if ((m_batchUploads >= MaxUploadsPerBatch) || (m_batchBytes >= MaxUploadBytesPerBatch))
+    {
+        m_batchClosed = true;
+    }
+
+    if (m_batchClosed && (m_batchUploaders == 0))
+    {
+        result = SubmitBatch();
+    }
+
+    return result;
+}
+
+// =====================================================================================================================
+// Submits the open batch to the internal DMA queue. All of its uploaders must have finished recording.
+Result DmaUploadRing::SubmitBatch()
+{
+    PAL_ASSERT(m_batchOpen && (m_batchUploaders == 0));
+
+    Entry*const pEntry = &m_pRing[m_batchSlot];
+
+    FlushPendingCopy();
+
+    Result result = pEntry->pCmdBuf->End();
     if(result == Result::Success)
     {
-        static_cast<CmdBuffer*>(m_pRing[slotId].pCmdBuf)->UpdateLastPagingFence(pagingFenceVal);
+        static_cast<CmdBuffer*>(pEntry->pCmdBuf)->UpdateLastPagingFence(m_batchPagingFence);
 
         PerSubQueueSubmitInfo perSubQueueInfo = {};
         perSubQueueInfo.cmdBufferCount        = 1;
-        perSubQueueInfo.ppCmdBuffers          = &m_pRing[slotId].pCmdBuf;
+        perSubQueueInfo.ppCmdBuffers          = &pEntry->pCmdBuf;
 
         MultiSubmitInfo submitInfo      = {};
         submitInfo.perSubQueueInfoCount = 1;
         submitInfo.pPerSubQueueInfo     = &perSubQueueInfo;
 #if PAL_CLIENT_INTERFACE_MAJOR_VERSION >= 568
         submitInfo.fenceCount = 1;
-        submitInfo.ppFences   = &m_pRing[slotId].pFence;
+        submitInfo.ppFences   = &pEntry->pFence;
 #else
-        submitInfo.pFence = m_pRing[slotId].pFence;
+        submitInfo.pFence = pEntry->pFence;
 #endif
 
         result = m_pDmaQueue->SubmitInternal(submitInfo, false);
-        *pCompletionFence = m_pDmaQueue->GetSubmissionContext()->LastTimestamp();
-        PAL_ASSERT(*pCompletionFence > 0);
+        pEntry->timestamp = m_pDmaQueue->GetSubmissionContext()->LastTimestamp();
+        PAL_ASSERT(pEntry->timestamp > 0);
         PAL_ASSERT(result == Result::Success);
     }
 
+    m_batchOpen   = false;
+    m_batchClosed = false;
+
+    return result;
+}
+
+// =====================================================================================================================
+// Submits the batch identified by fenceValue if it is still open and returns the ring entry which tracks it, or nullptr
+// if that batch has already retired. Returns NotReady if other uploaders are still recording into the batch.
+Result DmaUploadRing::FlushBatch(
+    UploadFenceToken fenceValue,
+    Entry**          ppEntry)
+{
+    Result result = Result::Success;
+    (*ppEntry)    = nullptr;
+
+    if (m_batchOpen && (fenceValue == m_pRing[m_batchSlot].batchId))
+    {
+        if (m_batchUploaders == 0)
+        {
+            result = SubmitBatch();
+        }
+        else
+        {
+            // Other uploaders are still recording into the batch. Keep newcomers out so it drains quickly.
+            m_batchClosed = true;
+            result        = Result::NotReady;
+        }
+    }
+
+    if (result == Result::Success)
+    {
+        (*ppEntry) = FindBatchEntry(fenceValue);
+    }
+
     return result;
 }
 
+// =====================================================================================================================
+// Returns the ring entry which tracks the batch identified by fenceValue, or nullptr if that batch has been retired.
+DmaUploadRing::Entry* DmaUploadRing::FindBatchEntry(
+    UploadFenceToken fenceValue)
+{
+    Entry* pEntry = nullptr;
+
+    if (m_numEntriesInUse > 0)
+    {
+        // Ring entries in use hold consecutive batches in submission order. Batches older than the oldest entry have
+        // been retired, so there is nothing to wait for.
+        const UploadFenceToken oldestBatchId = m_pRing[m_firstEntryInUse].batchId;
+        if (fenceValue >= oldestBatchId)
+        {
+            const uint32 entryIdx =
+                (m_firstEntryInUse + static_cast<uint32>(fenceValue - oldestBatchId)) % m_ringCapacity;
+            PAL_ASSERT(m_pRing[entryIdx].batchId == fenceValue);
+
+            pEntry = &m_pRing[entryIdx];
+        }
+    }
+
+    return pEntry;
+}
+
+// =====================================================================================================================
+Result DmaUploadRing::WaitForPendingUpload(
+    Pal::Queue*      pWaiter,
+    UploadFenceToken fenceValue)
+{
+    Entry* pEntry = nullptr;
+    Result result = FlushBatch(fenceValue, &pEntry);
+
+    if ((result == Result::Success) && (pEntry != nullptr))
+    {
+        result = WaitForTimestamp(pWaiter, pEntry->timestamp);
+    }
+
+    return result;
+}
+
+// =====================================================================================================================
+Result DmaUploadRing::BeginCpuWait(
+    UploadFenceToken fenceValue,
+    IFence**         ppFence)
+{
+    Entry* pEntry = nullptr;
+    Result result = FlushBatch(fenceValue, &pEntry);
+
+    (*ppFence) = nullptr;
+    if ((result == Result::Success) && (pEntry != nullptr))
+    {
+        pEntry->cpuWaiters++;
+        (*ppFence) = pEntry->pFence;
+    }
+
+    return result;
+}
+
+// =====================================================================================================================
+// Lets the ring recycle the entry of a batch once the last CPU waiter started by BeginCpuWait() is done with it.
+void DmaUploadRing::EndCpuWait(
+    UploadFenceToken fenceValue)
+{
+    // Entries with CPU waiters are never freed, so the batch must still be tracked.
+    Entry*const pEntry = FindBatchEntry(fenceValue);
+    PAL_ASSERT((pEntry != nullptr) && (pEntry->cpuWaiters > 0));
+
+    pEntry->cpuWaiters--;
+}
+
 // =====================================================================================================================
 // Creates internal fence for tracking previous submission on the internal dma upload queue.
 Result DmaUploadRing::CreateInternalFence(
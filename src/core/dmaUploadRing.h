@@ -26,6 +26,7 @@
 #pragma once
 
 #include "pal.h"
+#include "palCmdBuffer.h"
 #include "palMutex.h"
 #include "palInlineFuncs.h"
 
@@ -47,6 +48,11 @@ typedef uint32 UploadRingSlot;
 
 constexpr uint32 RingInitEntries = 512;  ///< Max number of entries in DmaUploadRing.
 
+// Uploads are batched: many uploaders record into one open ring slot which is submitted as a single DMA command
+// buffer. A batch is closed to new uploaders once it holds this many uploads or this many bytes of upload data.
+constexpr uint32 MaxUploadsPerBatch     = 128;
+constexpr size_t MaxUploadBytesPerBatch = (4 * 1024 * 1024);
+
 // =====================================================================================================================
 class DmaUploadRing
 {
@@ -54,15 +60,33 @@ public:
     explicit DmaUploadRing(Device* pDevice);
     virtual ~DmaUploadRing();
     Result Init();
+
+    // Joins the currently open upload batch, opening a new one if needed. Returns NotReady if the open batch is full
+    // but still being recorded by other uploaders; the caller should retry once they are done.
     Result AcquireRingSlot(UploadRingSlot* pSlotId);
+
+    // Finishes one upload recorded into the open batch. The returned completion fence identifies the batch; the batch
+    // itself is only submitted once it is full or a submission needs to wait for it.
     Result Submit(
         UploadRingSlot    slotId,
         UploadFenceToken* pCompletionFence,
         uint64            pagingFenceVal);
 
-    virtual Result WaitForPendingUpload(
+    // Makes pWaiter wait for the batch identified by fenceValue, submitting that batch first if it is still open.
+    // Returns NotReady if the batch is still being recorded by other uploaders; the caller should retry.
+    Result WaitForPendingUpload(
         Pal::Queue*      pWaiter,
-        UploadFenceToken fenceValue) = 0;
+        UploadFenceToken fenceValue);
+
+    // Prepares a CPU wait for the batch identified by fenceValue, submitting that batch first if it is still open.
+    // Returns the fence to wait on, or nullptr if the batch has already retired. The batch's ring entry is not recycled
+    // until EndCpuWait() so the fence stays valid while the caller waits on it without holding the ring lock. Returns
+    // NotReady if the batch is still being recorded by other uploaders.
+    Result BeginCpuWait(UploadFenceToken fenceValue, IFence** ppFence);
+    void   EndCpuWait(UploadFenceToken fenceValue);
+
+    // If no uploader is recording into the open batch, so callers which got NotReady above can make progress.
+    bool IsBatchDrained() const { return ((m_batchOpen == false) || (m_batchUploaders == 0)); }
 
     // Records DMA upload commands from embedded data to the destination.  Will only copy
     // up to the embedded data limit. Actual bytes copied are returned.  Caller must
@@ -76,15 +100,33 @@ public:
         void**          ppEmbeddedData);
 
 protected:
+    // Waits until the internal DMA queue has reached the given submission timestamp.
+    virtual Result WaitForTimestamp(
+        Pal::Queue* pWaiter,
+        uint64      timestamp) = 0;
+
     Pal::Device* m_pDevice;
     Pal::Queue*  m_pDmaQueue;
 
 private:
     struct Entry
     {
-        ICmdBuffer* pCmdBuf;
-        IFence*     pFence;
+        ICmdBuffer*      pCmdBuf;
+        IFence*          pFence;
+        UploadFenceToken batchId;   // Upload batch recorded in this entry.
+        uint64           timestamp; // Timestamp of the DMA queue submission, zero while the batch is still open.
+        uint32           cpuWaiters; // Threads waiting on pFence outside of the ring lock.
     };
+
+    // A copy recorded into the open batch but not yet written to its command buffer, so that following copies which
+    // continue it in both source and destination memory can be merged into it.
+    struct PendingCopy
+    {
+        GpuMemory*       pSrc;
+        GpuMemory*       pDst;
+        MemoryCopyRegion region;
+    };
+
     // Initialize each item of the ring from m_firstEntryFree to the end of the ring.
     Result InitRingItem(uint32 slotIdx);
     Result CreateInternalCopyQueue();
@@ -92,12 +134,27 @@ private:
     Result CreateInternalFence(IFence** ppFence);
     Result ResizeRing();
     Result FreeFinishedSlots();
+    Result OpenBatch(UploadRingSlot* pSlotId);
+    Result FlushBatch(UploadFenceToken fenceValue, Entry** ppEntry);
+    Entry* FindBatchEntry(UploadFenceToken fenceValue);
+    void   FlushPendingCopy();
+    Result SubmitBatch();
 
     Entry* m_pRing;
     uint32 m_ringCapacity;
     uint32 m_firstEntryInUse;
     uint32 m_firstEntryFree;
     uint32 m_numEntriesInUse;
+
+    UploadFenceToken m_nextBatchId;        // Identifier given to the next opened batch. Zero means "no upload".
+    bool             m_batchOpen;          // If the newest ring entry is an open batch which is not yet submitted.
+    bool             m_batchClosed;        // If the open batch accepts no more uploaders.
+    UploadRingSlot   m_batchSlot;          // Ring entry of the open batch.
+    uint32           m_batchUploaders;     // Number of uploaders which have joined but not finished the open batch.
+    uint32           m_batchUploads;       // Number of finished uploads in the open batch.
+    size_t           m_batchBytes;         // Upload data recorded into the open batch.
+    uint64           m_batchPagingFence;   // Largest paging fence of the memory uploaded to by the open batch.
+    PendingCopy      m_pendingCopy;
 };
 
 }
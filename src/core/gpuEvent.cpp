@@ -70,6 +70,14 @@ GpuEvent::~GpuEvent()
             const Result unmapResult = m_gpuMemory.Unmap();
             PAL_ASSERT(unmapResult == Result::Success);
         }
+
+#if PAL_CLIENT_INTERFACE_MAJOR_VERSION >= 642
+        // Internally bound events own their sub-allocation of the device's internal memory pools.
+        if (m_createInfo.flags.internalMemBind == 1)
+        {
+            m_pDevice->MemMgr()->FreeGpuMem(m_gpuMemory.Memory(), m_gpuMemory.Offset());
+        }
+#endif
     }
 }
 
@@ -203,6 +211,11 @@ Result GpuEvent::BindGpuMemory(
     IGpuMemory* pGpuMemory,
     gpusize     offset)
 {
+#if PAL_CLIENT_INTERFACE_MAJOR_VERSION >= 642
+    // Internally bound events are bound exactly once, by PAL, during creation.
+    PAL_ASSERT((m_createInfo.flags.internalMemBind == 0) || (m_gpuMemory.IsBound() == false));
+#endif
+
     const gpusize gpuRequiredMemSizeInBytes = GpuRequiredMemSizePerSlotInBytes * m_numSlotsPerEvent;
 
     Result result = Device::ValidateBindObjectMemoryInput(pGpuMemory,
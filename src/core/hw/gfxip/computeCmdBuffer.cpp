@@ -146,9 +146,10 @@ Result ComputeCmdBuffer::End()
     if (result == Result::Success)
     {
 #if PAL_ENABLE_PRINTS_ASSERTS
-        if (IsDumpingEnabled() && DumpFile()->IsOpen())
+        // The dump file is only open if dumping was enabled when this command buffer was begun.
+        if (DumpFile()->IsOpen())
         {
-            if (m_device.Parent()->Settings().cmdBufDumpFormat == CmdBufDumpFormatBinaryHeaders)
+            if (DumpFormat() == CmdBufDumpFormatBinaryHeaders)
             {
                 const CmdBufferDumpFileHeader fileHeader =
                 {
@@ -172,7 +173,7 @@ Result ComputeCmdBuffer::End()
                 DumpFile()->Write(&listHeader, sizeof(listHeader));
             }
 
-            DumpCmdStreamsToFile(DumpFile(), m_device.Parent()->Settings().cmdBufDumpFormat);
+            DumpCmdStreamsToFile(DumpFile(), DumpFormat());
             DumpFile()->Close();
         }
 #endif
@@ -150,6 +150,8 @@ public:
 
     void NotifyNestedCmdBufferExecute();
 
+    virtual void AccumulatePm4OptimizerStats(uint64* pKeptRegWrites, uint64* pSkippedRegWrites) const override;
+
 protected:
     virtual size_t BuildCondIndirectBuffer(
         CompareFunc compareFunc,
@@ -181,6 +183,8 @@ private:
     const CmdUtil& m_cmdUtil;
 
     Pm4Optimizer*  m_pPm4Optimizer;     // This will only be created if optimization is enabled for this stream.
+    uint64         m_pm4OptTotalRegWrites; // Register writes seen by PM4 optimizers destroyed since Begin().
+    uint64         m_pm4OptKeptRegWrites;  // Register writes kept by PM4 optimizers destroyed since Begin().
 
     PAL_DISALLOW_COPY_AND_ASSIGN(CmdStream);
     PAL_DISALLOW_DEFAULT_CTOR(CmdStream);
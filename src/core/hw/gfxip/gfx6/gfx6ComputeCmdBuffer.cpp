@@ -630,6 +630,8 @@ uint32* ComputeCmdBuffer::ValidateDispatch(
     uint32  zDim,
     uint32* pCmdSpace)
 {
+    m_cpuStats.numDispatches++;
+
 #if PAL_BUILD_PM4_INSTRUMENTOR
     const bool enablePm4Instrumentation = m_device.GetPlatform()->PlatformSettings().pm4InstrumentorEnabled;
 
@@ -68,10 +68,12 @@ Pm4Optimizer::Pm4Optimizer(
     m_cmdUtil(device.CmdUtil()),
     m_chipFamily(device.Parent()->ChipProperties().gfxLevel),
     m_waShaderSpiWriteShaderPgmRsrc2Ls(device.WaShaderSpiWriteShaderPgmRsrc2Ls()),
-    m_waTcCompatZRange(device.WaTcCompatZRange())
+    m_waTcCompatZRange(device.WaTcCompatZRange()),
 #if PAL_ENABLE_PRINTS_ASSERTS
-    , m_dstContainsSrc(false)
+    m_dstContainsSrc(false),
 #endif
+    m_totalRegWrites(0),
+    m_keptRegWrites(0)
 {
     Reset();
 }
@@ -144,7 +146,12 @@ bool Pm4Optimizer::MustKeepSetContextReg(
     uint32 regAddr,
     uint32 regData)
 {
-    return UpdateRegState(regData, m_cntxRegs + (regAddr - CONTEXT_SPACE_START));
+    const bool mustKeep = UpdateRegState(regData, m_cntxRegs + (regAddr - CONTEXT_SPACE_START));
+
+    m_totalRegWrites++;
+    m_keptRegWrites += mustKeep;
+
+    return mustKeep;
 }
 
 // =====================================================================================================================
@@ -154,7 +161,12 @@ bool Pm4Optimizer::MustKeepSetShReg(
     uint32 regAddr,
     uint32 regData)
 {
-    return UpdateRegState(regData, m_shRegs + (regAddr - PERSISTENT_SPACE_START));
+    const bool mustKeep = UpdateRegState(regData, m_shRegs + (regAddr - PERSISTENT_SPACE_START));
+
+    m_totalRegWrites++;
+    m_keptRegWrites += mustKeep;
+
+    return mustKeep;
 }
 
 // =====================================================================================================================
@@ -181,6 +193,9 @@ bool Pm4Optimizer::MustKeepContextRegRmw(
         mustKeep = UpdateRegState(newRegVal, pRegState);
     }
 
+    m_totalRegWrites++;
+    m_keptRegWrites += mustKeep;
+
     return mustKeep;
 }
 
@@ -277,8 +292,12 @@ uint32* Pm4Optimizer::OptimizePm4SetReg(
     // have to worry about this later.  Handling 0 here avoids checking for 0 at the beginning of 2 loops below.
     // Compiler turns this into a single comparison.
     PAL_ASSERT(numRegs != 0);
+    m_totalRegWrites += numRegs;
+
     if ((numRegs > 32) || (numRegs == 0))
     {
+        m_keptRegWrites += numRegs;
+
         // No register writes can be skipped: emit all registers.
         memcpy(pDstCmd, &setData, sizeof(setData));
         pDstCmd += PM4_CMD_SET_DATA_DWORDS;
@@ -305,6 +324,8 @@ uint32* Pm4Optimizer::OptimizePm4SetReg(
             i++;
         } while (i < numRegs);
 
+        m_keptRegWrites += keepRegCount;
+
         if (keepRegCount == numRegs)
         {
             // No register writes can be skipped: emit all registers.
@@ -70,6 +70,11 @@ public:
     bool MustKeepContextRegRmw(uint32 regAddr, uint32 regMask, uint32 regData);
     bool MustKeepSetBase(gpusize address, uint32 index, PM4ShaderType shaderType);
 
+    // Number of register writes seen by this optimizer and how many of them had to be kept. Unlike the register state,
+    // these are not cleared by Reset() because they describe the whole command stream.
+    uint64 TotalRegWrites() const { return m_totalRegWrites; }
+    uint64 KeptRegWrites()  const { return m_keptRegWrites; }
+
     // These functions take a fully built SET_DATA header and the corresponding register data and will write the an
     // optimized version into pCmdSpace.
     uint32* WriteOptimizedSetSeqShRegs(const PM4CMDSETDATA& setData, const uint32* pData, uint32* pCmdSpace);
@@ -112,6 +117,9 @@ private:
     // Base addresses set for SET_BASE
     SetBaseState  m_setBaseStateGfx[MaxSetBaseIndex + 1];
     SetBaseState  m_setBaseStateCompute;
+
+    uint64  m_totalRegWrites;
+    uint64  m_keptRegWrites;
 };
 
 } // Gfx6
@@ -3263,6 +3263,8 @@ template <bool indexed, bool indirect>
 void UniversalCmdBuffer::ValidateDraw(
     const ValidateDrawInfo& drawInfo)
 {
+    m_cpuStats.numDraws++;
+
     if (m_deCmdStream.Pm4OptimizerEnabled())
     {
         ValidateDraw<indexed, indirect, true>(drawInfo);
@@ -3984,6 +3986,8 @@ uint32* UniversalCmdBuffer::ValidateDispatch(
     uint32  zDim,
     uint32* pDeCmdSpace)
 {
+    m_cpuStats.numDispatches++;
+
 #if PAL_BUILD_PM4_INSTRUMENTOR
     uint32 startingCmdLen = 0;
     uint32 pipelineCmdLen = 0;
@@ -81,7 +81,9 @@ CmdStream::CmdStream(
     m_cmdUtil(device.CmdUtil()),
     m_pPm4Optimizer(nullptr),
     m_pChunkPreamble(nullptr),
-    m_contextRollDetected(false)
+    m_contextRollDetected(false),
+    m_pm4OptTotalRegWrites(0),
+    m_pm4OptKeptRegWrites(0)
 {
 }
 
@@ -126,6 +128,9 @@ Result CmdStream::Begin(
         }
     }
 
+    m_pm4OptTotalRegWrites = 0;
+    m_pm4OptKeptRegWrites  = 0;
+
     Result result = GfxCmdStream::Begin(flags, pMemAllocator);
 
     if ((result == Result::Success) && (m_flags.optimizeCommands == 1))
@@ -160,10 +165,37 @@ void CmdStream::CleanupTempObjects()
     // Clean up the temporary PM4 optimizer object.
     if (m_pMemAllocator != nullptr)
     {
+        if (m_pPm4Optimizer != nullptr)
+        {
+            m_pm4OptTotalRegWrites += m_pPm4Optimizer->TotalRegWrites();
+            m_pm4OptKeptRegWrites  += m_pPm4Optimizer->KeptRegWrites();
+        }
+
         PAL_SAFE_DELETE(m_pPm4Optimizer, m_pMemAllocator);
     }
 }
 
+// =====================================================================================================================
+// Adds the register writes kept and skipped by the PM4 optimizer since Begin() to the given counters. The optimizer is
+// destroyed when command building ends, so its final counts are remembered in CleanupTempObjects().
+void CmdStream::AccumulatePm4OptimizerStats(
+    uint64* pKeptRegWrites,
+    uint64* pSkippedRegWrites
+    ) const
+{
+    uint64 totalRegWrites = m_pm4OptTotalRegWrites;
+    uint64 keptRegWrites  = m_pm4OptKeptRegWrites;
+
+    if (m_pPm4Optimizer != nullptr)
+    {
+        totalRegWrites += m_pPm4Optimizer->TotalRegWrites();
+        keptRegWrites  += m_pPm4Optimizer->KeptRegWrites();
+    }
+
+    (*pKeptRegWrites)    += keptRegWrites;
+    (*pSkippedRegWrites) += (totalRegWrites - keptRegWrites);
+}
+
 // =====================================================================================================================
 // Builds a PM4 packet to modify the given register unless the PM4 optimizer indicates that it is redundant.
 // Returns a pointer to the next unused DWORD in pCmdSpace.
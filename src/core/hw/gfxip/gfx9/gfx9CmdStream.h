@@ -157,6 +157,8 @@ public:
     void SetContextRollDetected();
     bool ContextRollDetected() const { return m_contextRollDetected; }
 
+    virtual void AccumulatePm4OptimizerStats(uint64* pKeptRegWrites, uint64* pSkippedRegWrites) const override;
+
 #if PAL_BUILD_PM4_INSTRUMENTOR
     void IssueHotRegisterReport(GfxCmdBuffer* pCmdBuf) const;
 #endif
@@ -195,6 +197,8 @@ private:
     uint32*        m_pChunkPreamble;      // If non-null, the current chunk preamble was allocated here.
     bool           m_contextRollDetected; // This will only be set if a context roll has been detected since the
                                           // last draw.
+    uint64         m_pm4OptTotalRegWrites; // Register writes seen by PM4 optimizers destroyed since Begin().
+    uint64         m_pm4OptKeptRegWrites;  // Register writes kept by PM4 optimizers destroyed since Begin().
 
     PAL_DISALLOW_COPY_AND_ASSIGN(CmdStream);
     PAL_DISALLOW_DEFAULT_CTOR(CmdStream);
@@ -184,6 +184,7 @@ Device::Device(
               GetFrameCountRegister(pDevice)),
     m_cmdUtil(*this),
     m_queueContextUpdateCounter(0),
+    m_metaEqCache(pDevice->GetPlatform()),
     // The default value of MSAA rate is 1xMSAA.
     m_msaaRate(1),
     m_presentResolution({ 0,0 }),
@@ -256,6 +257,9 @@ Result Device::Cleanup()
         m_pVrsDepthView = nullptr;
     }
 
+    // Cached meta equations depend on the settings, which may change before the device is finalized again.
+    m_metaEqCache.Reset();
+
     if (result == Result::Success)
     {
         result = GfxDevice::Cleanup();
@@ -290,6 +294,11 @@ Result Device::EarlyInit()
 
     Result result = m_ringSizesLock.Init();
 
+    if (result == Result::Success)
+    {
+        result = m_metaEqCache.Init();
+    }
+
     if (result == Result::Success)
     {
         result = m_pRsrcProcMgr->EarlyInit();
@@ -370,6 +370,9 @@ public:
     void   GetLargestRingSizes(ShaderRingItemSizes* pRingSizesNeeded);
     uint32 QueueContextUpdateCounter() const { return m_queueContextUpdateCounter; }
 
+    // The cache is internally synchronized, so mask-rams may use it through a const device.
+    MetaEqCache* GetMetaEqCache() const { return &m_metaEqCache; }
+
     virtual Result SetSamplePatternPalette(const SamplePatternPalette& palette) override;
     void GetSamplePatternPalette(SamplePatternPalette* pSamplePatternPalette);
 
@@ -770,6 +773,9 @@ private:
     // will check its watermark against the one owned by the device and update accordingly.
     volatile uint32               m_queueContextUpdateCounter;
 
+    // Meta equations shared by all mask-rams created on this device.
+    mutable MetaEqCache           m_metaEqCache;
+
     // Tracks the sample pattern palette for sample pos shader ring. Access to this object must be
     // serialized using m_samplePatternLock.
     volatile SamplePatternPalette m_samplePatternPalette;
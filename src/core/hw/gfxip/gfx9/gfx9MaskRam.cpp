@@ -1240,6 +1240,70 @@ void Gfx9MetaEqGenerator::CpuUploadEq(
     }
 }
 
+// =====================================================================================================================
+// Gathers everything about the parent mask-ram which feeds its meta equation.
+void Gfx9MetaEqGenerator::BuildCacheKey(
+    MetaEqCacheKey* pKey
+    ) const
+{
+    const Pal::Image*      pParent    = m_pParent->GetImage().Parent();
+    const ImageCreateInfo& createInfo = pParent->GetImageCreateInfo();
+
+    Gfx9MaskRamBlockSize compBlkSizeLog2 = {};
+    Gfx9MaskRamBlockSize metaBlkSizeLog2 = {};
+
+    m_pParent->CalcCompBlkSizeLog2(&compBlkSizeLog2);
+    m_pParent->CalcMetaBlkSizeLog2(&metaBlkSizeLog2);
+
+    memset(pKey, 0, sizeof(*pKey));
+
+    pKey->maskRamType          = m_pParent->IsColor() ? 2 : (m_pParent->IsDepth() ? 1 : 0);
+    pKey->swizzleMode          = m_pParent->GetSwizzleMode();
+    pKey->bytesPerPixelLog2    = m_pParent->GetBytesPerPixelLog2();
+    pKey->numSamplesLog2       = m_pParent->GetNumSamplesLog2();
+    pKey->metaDataWordSizeLog2 = m_metaDataWordSizeLog2;
+    pKey->firstUploadBit       = m_firstUploadBit;
+    pKey->metaFlags            = m_pParent->GetMetaFlags().value;
+    pKey->pipeAligned          = m_pParent->PipeAligned();
+    pKey->compBlkSizeLog2[0]   = compBlkSizeLog2.width;
+    pKey->compBlkSizeLog2[1]   = compBlkSizeLog2.height;
+    pKey->compBlkSizeLog2[2]   = compBlkSizeLog2.depth;
+    pKey->metaBlkSizeLog2[0]   = metaBlkSizeLog2.width;
+    pKey->metaBlkSizeLog2[1]   = metaBlkSizeLog2.height;
+    pKey->metaBlkSizeLog2[2]   = metaBlkSizeLog2.depth;
+
+    if (createInfo.imageType == ImageType::Tex3d)
+    {
+        pKey->imageFlags |= MetaEqCacheImage3d;
+    }
+    if (createInfo.mipLevels > 1)
+    {
+        pKey->imageFlags |= MetaEqCacheImageMipmapped;
+    }
+    if (createInfo.usageFlags.depthStencil || pParent->IsDepthStencil())
+    {
+        pKey->imageFlags |= MetaEqCacheImageDepthStencil;
+    }
+    if (pParent->IsRenderTarget())
+    {
+        pKey->imageFlags |= MetaEqCacheImageRenderTarget;
+    }
+
+    // GFX9 equations address the whole mask-ram, so they are trimmed to its size.  GFX10 equations address one
+    // meta-block instead, whose layout depends on the meta cacheline size.
+    if (IsGfx9(*pParent->GetDevice()))
+    {
+        pKey->totalSize = m_pParent->TotalSize();
+    }
+    else
+    {
+        Gfx9MaskRamBlockSize metaBlockExtentLog2 = {};
+
+        pKey->metaBlockSizeLog2 = m_pParent->GetMetaBlockSize(&metaBlockExtentLog2);
+        pKey->metaCachelineSize = m_pParent->GetMetaCachelineSize();
+    }
+}
+
 // =====================================================================================================================
 // Calculates the meta equation for this mask-ram.  The meta-equation is ultimately used by a compute shader for
 // determining the real location of any coordinates within the meta-data.
@@ -1257,18 +1321,46 @@ void Gfx9MetaEqGenerator::CpuUploadEq(
 //
 //          metaOffset |= (b << n)
 //      }
+//
+// The equation is taken from the device's cache if a mask-ram with the same inputs was created before.
 void Gfx9MetaEqGenerator::CalcMetaEquation()
 {
-    const Pal::Image*  pParent   = m_pParent->GetImage().Parent();
     const Pal::Device& palDevice = *(m_pParent->GetGfxDevice()->Parent());
 
-    if (IsGfx9(palDevice))
-    {
-        CalcMetaEquationGfx9();
-    }
-    else if (IsGfx10(palDevice))
+    if (IsGfx9(palDevice) || IsGfx10(palDevice))
     {
-        CalcMetaEquationGfx10();
+        MetaEqCache*const pCache = m_pParent->GetGfxDevice()->GetMetaEqCache();
+
+        MetaEqCacheKey key;
+        BuildCacheKey(&key);
+
+        const MetaEqCacheEntry* pEntry = pCache->Find(key);
+
+        if (pEntry != nullptr)
+        {
+            m_meta                   = pEntry->meta;
+            m_metaEqParam            = pEntry->param;
+            m_effectiveSamples       = pEntry->numEffectiveSamples;
+            m_rbAppendedWithPipeBits = pEntry->rbAppendedBits;
+            m_metaEquationValid      = true;
+        }
+        else
+        {
+            if (IsGfx9(palDevice))
+            {
+                CalcMetaEquationGfx9();
+            }
+            else
+            {
+                CalcMetaEquationGfx10();
+            }
+
+            if (m_metaEquationValid)
+            {
+                const MetaEqCacheEntry entry(m_meta, m_metaEqParam, m_effectiveSamples, m_rbAppendedWithPipeBits);
+                pCache->Insert(key, entry);
+            }
+        }
     }
 }
 
@@ -263,6 +263,7 @@ protected:
     const int32           m_metaDataWordSizeLog2;
 
 private:
+    void   BuildCacheKey(MetaEqCacheKey* pKey) const;
     void   CalcMetaEquationGfx9();
     void   CalcMetaEquationGfx10();
     void   CalcDataOffsetEquation(MetaDataAddrEquation* pDataOffset);
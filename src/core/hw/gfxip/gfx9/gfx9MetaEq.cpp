@@ -30,6 +30,7 @@
 #include "core/hw/gfxip/gfx9/gfx9Image.h"
 #include "core/hw/gfxip/gfx9/gfx9MetaEq.h"
 #include "core/hw/gfxip/gfx9/g_gfx9PalSettings.h"
+#include "palHashMapImpl.h"
 
 using namespace Util;
 
@@ -1120,5 +1121,96 @@ void MetaDataAddrEquation::Rotate(
     }
 }
 
+//=============== Implementation for MetaEqCache: ======================================================================
+// =====================================================================================================================
+MetaEqCache::MetaEqCache(
+    Platform* pPlatform)
+    :
+    m_pPlatform(pPlatform),
+    m_entries(64, pPlatform),
+    m_numHits(0),
+    m_numMisses(0)
+{
+}
+
+// =====================================================================================================================
+Result MetaEqCache::Init()
+{
+    Result result = m_lock.Init();
+
+    if (result == Result::Success)
+    {
+        result = m_entries.Init();
+    }
+
+    return result;
+}
+
+// =====================================================================================================================
+// Frees all cached entries.  Must only be called while no mask-ram refers to the cache.
+void MetaEqCache::Reset()
+{
+    MutexAuto lock(&m_lock);
+
+    for (auto iter = m_entries.Begin(); iter.Get() != nullptr; iter.Next())
+    {
+        PAL_DELETE(iter.Get()->value, m_pPlatform);
+    }
+
+    m_entries.Reset();
+}
+
+// =====================================================================================================================
+const MetaEqCacheEntry* MetaEqCache::Find(
+    const MetaEqCacheKey& key)
+{
+    MutexAuto lock(&m_lock);
+
+    MetaEqCacheEntry*const*const ppEntry = m_entries.FindKey(key);
+
+    if (ppEntry != nullptr)
+    {
+        m_numHits++;
+    }
+    else
+    {
+        m_numMisses++;
+    }
+
+    return (ppEntry != nullptr) ? *ppEntry : nullptr;
+}
+
+// =====================================================================================================================
+const MetaEqCacheEntry* MetaEqCache::Insert(
+    const MetaEqCacheKey&   key,
+    const MetaEqCacheEntry& entry)
+{
+    MutexAuto lock(&m_lock);
+
+    const MetaEqCacheEntry* pCached = nullptr;
+    MetaEqCacheEntry**      ppEntry = m_entries.FindKey(key);
+
+    if (ppEntry != nullptr)
+    {
+        // Another thread computed the same equation while we did.
+        pCached = *ppEntry;
+    }
+    else if (m_entries.GetNumEntries() < MaxEntries)
+    {
+        MetaEqCacheEntry* pNew = PAL_NEW(MetaEqCacheEntry, m_pPlatform, AllocInternal)(entry);
+
+        if ((pNew != nullptr) && (m_entries.Insert(key, pNew) == Result::Success))
+        {
+            pCached = pNew;
+        }
+        else
+        {
+            PAL_SAFE_DELETE(pNew, m_pPlatform);
+        }
+    }
+
+    return pCached;
+}
+
 } // Gfx9
 } // Pal
@@ -26,6 +26,9 @@
 #pragma once
 
 #include "pal.h"
+#include "palHashMap.h"
+#include "palMutex.h"
+#include "core/platform.h"
 
 namespace Pal
 {
@@ -256,5 +259,97 @@ private:
     uint32  m_equation[MaxNumMetaDataAddrBits][MetaDataAddrCompNumTypes];
 };
 
+// =====================================================================================================================
+// Everything about one mask-ram which feeds its meta equation, apart from the device-wide constants (pipe, RB and SE
+// counts, pipe interleave, settings).  Two mask-rams on the same device with equal keys always get identical equations.
+// Keys are hashed and compared bytewise, so they must be zeroed before being filled in.
+struct MetaEqCacheKey
+{
+    uint32   maskRamType;          // 0 for cMask, 1 for hTile, 2 for DCC.
+    uint32   swizzleMode;
+    uint32   bytesPerPixelLog2;
+    uint32   numSamplesLog2;
+    int32    metaDataWordSizeLog2;
+    uint32   firstUploadBit;
+    uint32   metaFlags;            // ADDR2_META_FLAGS::value
+    uint32   pipeAligned;
+    uint32   metaBlockSizeLog2;
+    uint32   metaCachelineSize;
+    uint32   compBlkSizeLog2[3];   // Width, height and depth.
+    uint32   metaBlkSizeLog2[3];
+    uint32   imageFlags;           // See MetaEqCacheImageFlags.
+    gpusize  totalSize;            // Mask-ram size; only GFX9 equations depend on it, zero elsewhere.
+};
+
+// Properties of the parent image which are folded into MetaEqCacheKey::imageFlags.
+enum MetaEqCacheImageFlags : uint32
+{
+    MetaEqCacheImage3d           = 0x1,
+    MetaEqCacheImageMipmapped    = 0x2,
+    MetaEqCacheImageDepthStencil = 0x4,
+    MetaEqCacheImageRenderTarget = 0x8,
+};
+
+// =====================================================================================================================
+// The outputs of one meta equation calculation, shared by all mask-rams whose inputs produce the same key.
+struct MetaEqCacheEntry
+{
+    MetaEqCacheEntry(
+        const MetaDataAddrEquation& metaEq,
+        const MetaEquationParam&    metaEqParam,
+        uint32                      effectiveSamples,
+        uint32                      rbAppendedWithPipeBits)
+        :
+        meta(metaEq),
+        param(metaEqParam),
+        numEffectiveSamples(effectiveSamples),
+        rbAppendedBits(rbAppendedWithPipeBits)
+    {}
+
+    const MetaDataAddrEquation meta;
+    const MetaEquationParam    param;
+    const uint32               numEffectiveSamples;
+    const uint32               rbAppendedBits;
+};
+
+// =====================================================================================================================
+// Device-wide, thread-safe cache of computed meta equations.  Workloads which create many images with the same format,
+// swizzle mode, sample count and metadata flags would otherwise re-derive the same equation for every one of them.
+// Entries are immutable and live until the cache is reset, which only happens while no images exist.
+class MetaEqCache
+{
+public:
+    explicit MetaEqCache(Platform* pPlatform);
+    ~MetaEqCache() { Reset(); }
+
+    Result Init();
+    void   Reset();
+
+    // Returns the cached outputs for the given key, or null on a miss.
+    const MetaEqCacheEntry* Find(const MetaEqCacheKey& key);
+
+    // Adds the outputs computed for the given key.  Returns the cached entry, which may have been added by another
+    // thread in the meantime, or null if the entry couldn't be added.
+    const MetaEqCacheEntry* Insert(const MetaEqCacheKey& key, const MetaEqCacheEntry& entry);
+
+    uint64 NumHits()   const { return m_numHits; }
+    uint64 NumMisses() const { return m_numMisses; }
+
+    // Beyond this many entries, new equations are still computed but no longer cached.
+    static constexpr uint32 MaxEntries = 4096;
+
+private:
+    typedef Util::HashMap<MetaEqCacheKey, MetaEqCacheEntry*, Platform, Util::JenkinsHashFunc> EntryMap;
+
+    Platform*const  m_pPlatform;
+    Util::Mutex     m_lock;         // Serializes access to m_entries.
+    EntryMap        m_entries;
+    volatile uint64 m_numHits;
+    volatile uint64 m_numMisses;
+
+    PAL_DISALLOW_DEFAULT_CTOR(MetaEqCache);
+    PAL_DISALLOW_COPY_AND_ASSIGN(MetaEqCache);
+};
+
 } // Gfx9
 } // Pal
@@ -78,11 +78,18 @@ Pm4Optimizer::Pm4Optimizer(
     :
     m_device(device),
     m_cmdUtil(device.CmdUtil()),
-    m_waTcCompatZRange(device.WaTcCompatZRange())
+    m_waTcCompatZRange(device.WaTcCompatZRange()),
 #if PAL_ENABLE_PRINTS_ASSERTS
-    , m_dstContainsSrc(false)
+    m_dstContainsSrc(false),
 #endif
+    m_totalRegWrites(0),
+    m_keptRegWrites(0)
 {
+#if PAL_BUILD_PM4_INSTRUMENTOR
+    memset(&m_cntxRollCauses[0], 0, sizeof(m_cntxRollCauses));
+    m_rollCauseRecorded = false;
+#endif
+
     Reset();
 }
 
@@ -149,7 +156,16 @@ bool Pm4Optimizer::MustKeepSetContextReg(
 
     const bool mustKeep = UpdateRegState(regData, (regAddr - CONTEXT_SPACE_START), &m_cntxRegs);
 
+#if PAL_BUILD_PM4_INSTRUMENTOR
+    if (mustKeep)
+    {
+        RecordContextRollCause(regAddr - CONTEXT_SPACE_START);
+    }
+#endif
+
     m_contextRollDetected |= mustKeep;
+    m_totalRegWrites++;
+    m_keptRegWrites += mustKeep;
 
     return mustKeep;
 }
@@ -162,7 +178,13 @@ bool Pm4Optimizer::MustKeepSetShReg(
     uint32 regData)
 {
     PAL_ASSERT(m_cmdUtil.IsShReg(regAddr));
-    return UpdateRegState(regData, (regAddr - PERSISTENT_SPACE_START), &m_shRegs);
+
+    const bool mustKeep = UpdateRegState(regData, (regAddr - PERSISTENT_SPACE_START), &m_shRegs);
+
+    m_totalRegWrites++;
+    m_keptRegWrites += mustKeep;
+
+    return mustKeep;
 }
 
 // =====================================================================================================================
@@ -190,7 +212,16 @@ bool Pm4Optimizer::MustKeepContextRegRmw(
         mustKeep = UpdateRegState(newRegVal, regOffset, &m_cntxRegs);
     }
 
+#if PAL_BUILD_PM4_INSTRUMENTOR
+    if (mustKeep)
+    {
+        RecordContextRollCause(regOffset);
+    }
+#endif
+
     m_contextRollDetected |= mustKeep;
+    m_totalRegWrites++;
+    m_keptRegWrites += mustKeep;
 
     return mustKeep;
 }
@@ -270,6 +301,15 @@ uint32* Pm4Optimizer::WriteOptimizedSetSeqContextRegs(
                                              pData,
                                              pCmdSpace,
                                              &m_cntxRegs);
+
+#if PAL_BUILD_PM4_INSTRUMENTOR
+    if (pNewCmdSpace > pCmdSpace)
+    {
+        // The first register in the optimized packet is the first one which wasn't redundant.
+        const auto*const pFirstPacket = reinterpret_cast<const PM4_PFP_SET_CONTEXT_REG*>(pCmdSpace);
+        RecordContextRollCause(pFirstPacket->ordinal2.bitfields.reg_offset);
+    }
+#endif
     (*pContextRollDetected) |= ((pNewCmdSpace > pCmdSpace) != 0);
     return pNewCmdSpace;
 }
@@ -309,6 +349,9 @@ uint32* Pm4Optimizer::OptimizePm4SetReg(
 
     PAL_ASSERT((keepRegCount == numRegs) || (numRegs <= 32));
 
+    m_totalRegWrites += numRegs;
+    m_keptRegWrites  += (numRegs > 32) ? numRegs : keepRegCount;
+
     if ((keepRegCount == numRegs) || (numRegs > 32))
     {
         // No register writes can be skipped: emit all registers.
@@ -513,9 +556,23 @@ void Pm4Optimizer::IssueHotRegisterReport(
                                   PERSISTENT_SPACE_START,
                                   &m_cntxRegs.totalSets[0],
                                   &m_cntxRegs.keptSets[0],
+                                  &m_cntxRollCauses[0],
                                   CntxRegUsedRangeSize,
                                   CONTEXT_SPACE_START);
 }
+
+// =====================================================================================================================
+// Blames the current context roll on the given context register if no other kept write has been blamed for it since
+// the last draw.
+void Pm4Optimizer::RecordContextRollCause(
+    uint32 regOffset)
+{
+    if (m_rollCauseRecorded == false)
+    {
+        m_cntxRollCauses[regOffset]++;
+        m_rollCauseRecorded = true;
+    }
+}
 #endif
 
 } // Gfx9
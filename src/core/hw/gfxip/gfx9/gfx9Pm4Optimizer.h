@@ -95,7 +95,18 @@ public:
     bool MustKeepSetBase(gpusize address, uint32 index, Pm4ShaderType shaderType);
 
     bool GetContextRollState() const { return m_contextRollDetected; }
-    void ResetContextRollState() { m_contextRollDetected = false; }
+    void ResetContextRollState()
+    {
+        m_contextRollDetected = false;
+#if PAL_BUILD_PM4_INSTRUMENTOR
+        m_rollCauseRecorded   = false;
+#endif
+    }
+
+    // Number of register writes seen by this optimizer and how many of them had to be kept. Unlike the register state,
+    // these are not cleared by Reset() because they describe the whole command stream.
+    uint64 TotalRegWrites() const { return m_totalRegWrites; }
+    uint64 KeptRegWrites()  const { return m_keptRegWrites; }
 
     // These functions take a fully built packet header and the corresponding register data and will write the
     // optimized version into pCmdSpace.
@@ -143,6 +154,10 @@ private:
 
     uint32 GetPm4PacketSize(PM4_PFP_TYPE_3_HEADER pm4Header) const;
 
+#if PAL_BUILD_PM4_INSTRUMENTOR
+    void RecordContextRollCause(uint32 regOffset);
+#endif
+
     const Device&   m_device;
     const CmdUtil&  m_cmdUtil;
 
@@ -161,6 +176,16 @@ private:
     SetBaseState  m_setBaseStateCompute;
 
     bool  m_contextRollDetected;
+
+#if PAL_BUILD_PM4_INSTRUMENTOR
+    // Number of times each context register was the first kept write since the last draw, making it the register which
+    // caused that draw's context roll. Unlike m_cntxRegs, this is not cleared by Reset().
+    uint32  m_cntxRollCauses[CntxRegUsedRangeSize];
+    bool    m_rollCauseRecorded; // Set once the current context roll's cause has been recorded.
+#endif
+
+    uint64  m_totalRegWrites;
+    uint64  m_keptRegWrites;
 };
 
 } // Gfx9
@@ -4150,6 +4150,8 @@ template <bool Indexed, bool Indirect>
 void UniversalCmdBuffer::ValidateDraw(
     const ValidateDrawInfo& drawInfo)      // Draw info
 {
+    m_cpuStats.numDraws++;
+
     if (m_deCmdStream.Pm4OptimizerEnabled())
     {
         ValidateDraw<Indexed, Indirect, true>(drawInfo);
@@ -4660,18 +4662,86 @@ void UniversalCmdBuffer::ValidateVrsState()
     }
 }
 
+// =====================================================================================================================
+// Performs draw-time dirty state validation. Returns the next unused DWORD in pDeCmdSpace.  Wrapper to select the
+// GFXIP-specialized instantiation of the real ValidateDraw() function when PAL is built with
+// PAL_BUILD_GFXIP_SPECIALIZED_DRAWS.  Specialized instantiations resolve every GFXIP check at compile time; otherwise a
+// single generic instantiation checks the command buffer's GFXIP level at runtime.
+template <bool Indexed, bool Indirect, bool Pm4OptImmediate, bool PipelineDirty, bool StateDirty, bool IsNgg>
+uint32* UniversalCmdBuffer::ValidateDraw(
+    const ValidateDrawInfo& drawInfo,
+    uint32*                 pDeCmdSpace)
+{
+#if PAL_BUILD_GFXIP_SPECIALIZED_DRAWS
+    switch (m_gfxIpLevel)
+    {
+    case GfxIpLevel::GfxIp9:
+        // NGG is a GFX10+ feature, so there is no point in specializing the NGG path for GFX9.
+        PAL_ASSERT(IsNgg == false);
+        pDeCmdSpace = ValidateDraw<Indexed,
+                                   Indirect,
+                                   Pm4OptImmediate,
+                                   PipelineDirty,
+                                   StateDirty,
+                                   IsNgg,
+                                   IsNgg ? GfxIpLevel::_None : GfxIpLevel::GfxIp9>(drawInfo, pDeCmdSpace);
+        break;
+    case GfxIpLevel::GfxIp10_1:
+        pDeCmdSpace = ValidateDraw<Indexed,
+                                   Indirect,
+                                   Pm4OptImmediate,
+                                   PipelineDirty,
+                                   StateDirty,
+                                   IsNgg,
+                                   GfxIpLevel::GfxIp10_1>(drawInfo, pDeCmdSpace);
+        break;
+    case GfxIpLevel::GfxIp10_3:
+        pDeCmdSpace = ValidateDraw<Indexed,
+                                   Indirect,
+                                   Pm4OptImmediate,
+                                   PipelineDirty,
+                                   StateDirty,
+                                   IsNgg,
+                                   GfxIpLevel::GfxIp10_3>(drawInfo, pDeCmdSpace);
+        break;
+    default:
+        pDeCmdSpace = ValidateDraw<Indexed,
+                                   Indirect,
+                                   Pm4OptImmediate,
+                                   PipelineDirty,
+                                   StateDirty,
+                                   IsNgg,
+                                   GfxIpLevel::_None>(drawInfo, pDeCmdSpace);
+        break;
+    }
+#else
+    pDeCmdSpace = ValidateDraw<Indexed,
+                               Indirect,
+                               Pm4OptImmediate,
+                               PipelineDirty,
+                               StateDirty,
+                               IsNgg,
+                               GfxIpLevel::_None>(drawInfo, pDeCmdSpace);
+#endif
+
+    return pDeCmdSpace;
+}
+
 // =====================================================================================================================
 // Performs draw-time dirty state validation. Returns the next unused DWORD in pDeCmdSpace.
-template <bool Indexed,
-          bool Indirect,
-          bool Pm4OptImmediate,
-          bool PipelineDirty,
-          bool StateDirty,
-          bool IsNgg>
+template <bool       Indexed,
+          bool       Indirect,
+          bool       Pm4OptImmediate,
+          bool       PipelineDirty,
+          bool       StateDirty,
+          bool       IsNgg,
+          GfxIpLevel GfxLevel>
 uint32* UniversalCmdBuffer::ValidateDraw(
     const ValidateDrawInfo& drawInfo,      // Draw info
     uint32*                 pDeCmdSpace)   // Write new draw-engine commands here.
 {
+    const GfxIpLevel gfxLevel = DrawGfxLevel<GfxLevel>();
+
     const auto*const pBlendState = static_cast<const ColorBlendState*>(m_graphicsState.pColorBlendState);
     const auto*const pDepthState = static_cast<const DepthStencilState*>(m_graphicsState.pDepthStencilState);
     const auto*const pPipeline   = static_cast<const GraphicsPipeline*>(m_graphicsState.pipelineState.pPipeline);
@@ -4781,7 +4851,7 @@ uint32* UniversalCmdBuffer::ValidateDraw(
         regIA_MULTI_VGT_PARAM iaMultiVgtParam = pPipeline->IaMultiVgtParam(wdSwitchOnEop);
         regVGT_LS_HS_CONFIG   vgtLsHsConfig   = pPipeline->VgtLsHsConfig();
 
-        if (IsGfx9(m_gfxIpLevel))
+        if (IsGfx9(gfxLevel))
         {
             pDeCmdSpace = m_deCmdStream.WriteSetOneConfigReg(Gfx09::mmIA_MULTI_VGT_PARAM,
                                                              iaMultiVgtParam.u32All,
@@ -4791,7 +4861,7 @@ uint32* UniversalCmdBuffer::ValidateDraw(
         else // For GFX10+
         {
             const bool   lineStippleEnabled = (pMsaaState != nullptr) ? pMsaaState->UsesLineStipple() : false;
-            const uint32 geCntl             = CalcGeCntl<IsNgg>(lineStippleEnabled, iaMultiVgtParam);
+            const uint32 geCntl             = CalcGeCntl<IsNgg, GfxLevel>(lineStippleEnabled, iaMultiVgtParam);
 
             // GE_CNTL tends to be the same so only bother writing it if the value has changed.
             if (geCntl != m_geCntl.u32All)
@@ -4891,7 +4961,7 @@ uint32* UniversalCmdBuffer::ValidateDraw(
         // the ideal bin sizes will change, so we must revalidate.
         if (m_enabledPbb || shouldEnablePbb
               // optimal gfx10 bin sizes are determined from render targets both when PBB is enabled or disabled
-              || IsGfx10(m_gfxIpLevel)
+              || IsGfx10(gfxLevel)
             )
         {
             m_enabledPbb = shouldEnablePbb;
@@ -4905,7 +4975,7 @@ uint32* UniversalCmdBuffer::ValidateDraw(
         pDeCmdSpace = m_deCmdStream.ReserveCommands();
     }
 
-    if ((PipelineDirty || (StateDirty && dirtyFlags.triangleRasterState)) && IsGfx10Plus(m_gfxIpLevel))
+    if ((PipelineDirty || (StateDirty && dirtyFlags.triangleRasterState)) && IsGfx10Plus(gfxLevel))
     {
         pDeCmdSpace = Gfx10ValidateTriangleRasterState(pPipeline, pDeCmdSpace);
     }
@@ -5997,12 +6067,13 @@ uint32* UniversalCmdBuffer::ValidateScissorRects(
 
 // =====================================================================================================================
 // Translates the supplied IA_MULTI_VGT_PARAM register to its equivalent GE_CNTL value
-template <bool IsNgg>
+template <bool IsNgg, GfxIpLevel GfxLevel>
 uint32 UniversalCmdBuffer::CalcGeCntl(
     bool                  usesLineStipple,
     regIA_MULTI_VGT_PARAM iaMultiVgtParam
     ) const
 {
+    const     GfxIpLevel gfxLevel         = DrawGfxLevel<GfxLevel>();
     const     auto*  pPalPipeline         = m_graphicsState.pipelineState.pPipeline;
     const     auto*  pPipeline            = static_cast<const GraphicsPipeline*>(pPalPipeline);
     const     bool   isTess               = IsTessEnabled();
@@ -6046,7 +6117,7 @@ uint32 UniversalCmdBuffer::CalcGeCntl(
         if (vertsPerSubgroup != 0)
         {
             //  These numbers below come from the hardware restrictions.
-            if (IsGfx103Plus(m_gfxIpLevel))
+            if (IsGfx103Plus(gfxLevel))
             {
                 if (vertsPerSubgroup < 29)
                 {
@@ -6054,7 +6125,7 @@ uint32 UniversalCmdBuffer::CalcGeCntl(
                 }
             }
             else
-            if (IsGfx101(m_gfxIpLevel))
+            if (IsGfx101(gfxLevel))
             {
                 if (vertsPerSubgroup < 24)
                 {
@@ -6230,7 +6301,9 @@ uint32* UniversalCmdBuffer::ValidateDrawTimeHwState(
 }
 
 // =====================================================================================================================
-// Performs dispatch-time dirty state validation.
+// Performs dispatch-time dirty state validation.  Unlike ValidateDraw(), this is not specialized per GFXIP level under
+// PAL_BUILD_GFXIP_SPECIALIZED_DRAWS: its only GFXIP-dependent work is the single COMPUTE_DISPATCH_TUNNEL check below,
+// so the extra instantiations and per-dispatch switch would cost more than the one runtime check they remove.
 void UniversalCmdBuffer::ValidateDispatch(
     ComputeState* pComputeState,
     CmdStream*    pCmdStream,
@@ -6239,6 +6312,8 @@ void UniversalCmdBuffer::ValidateDispatch(
     uint32        yDim,
     uint32        zDim)
 {
+    m_cpuStats.numDispatches++;
+
 #if PAL_BUILD_PM4_INSTRUMENTOR
     uint32 startingCmdLen = 0;
     uint32 pipelineCmdLen = 0;
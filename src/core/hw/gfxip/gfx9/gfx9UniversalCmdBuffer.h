@@ -624,6 +624,22 @@ protected:
         const ValidateDrawInfo& drawInfo,
         uint32*                 pDeCmdSpace);
 
+    template <bool       Indexed,
+              bool       Indirect,
+              bool       Pm4OptImmediate,
+              bool       PipelineDirty,
+              bool       StateDirty,
+              bool       IsNgg,
+              GfxIpLevel GfxLevel>
+    uint32* ValidateDraw(
+        const ValidateDrawInfo& drawInfo,
+        uint32*                 pDeCmdSpace);
+
+    // Returns the GFXIP level a draw-time validation path was specialized for. The generic instantiation, which uses
+    // GfxIpLevel::_None, falls back to this command buffer's level.
+    template <GfxIpLevel GfxLevel>
+    GfxIpLevel DrawGfxLevel() const { return (GfxLevel == GfxIpLevel::_None) ? m_gfxIpLevel : GfxLevel; }
+
     template <bool Indexed, bool Indirect, bool Pm4OptImmediate>
     uint32* ValidateDrawTimeHwState(
         regPA_SC_MODE_CNTL_1    paScModeCntl1,
@@ -720,7 +736,7 @@ private:
         uint32      xDim,
         uint32      yDim,
         uint32      zDim);
-    template <bool IsNgg>
+    template <bool IsNgg, GfxIpLevel GfxLevel>
     uint32 CalcGeCntl(
         bool                  usesLineStipple,
         regIA_MULTI_VGT_PARAM iaMultiVgtParam) const;
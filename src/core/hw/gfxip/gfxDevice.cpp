@@ -644,20 +644,24 @@ void GfxDevice::DescribeHotRegisters(
     uint16        shRegBase,
     const uint32* pCtxRegSeenSets,
     const uint32* pCtxRegKeptSets,
+    const uint32* pCtxRegRollCauses,
     uint32        ctxRegCount,
     uint16        ctxRegBase
     ) const
 {
     Developer::OptimizedRegistersData data = { };
-    data.pCmdBuffer      = pCmdBuf;
-    data.pShRegSeenSets  = pShRegSeenSets;
-    data.pShRegKeptSets  = pShRegKeptSets;
-    data.shRegCount      = shRegCount;
-    data.shRegBase       = shRegBase;
-    data.pCtxRegSeenSets = pCtxRegSeenSets;
-    data.pCtxRegKeptSets = pCtxRegKeptSets;
-    data.ctxRegCount     = ctxRegCount;
-    data.ctxRegBase      = ctxRegBase;
+    data.pCmdBuffer        = pCmdBuf;
+    data.pShRegSeenSets    = pShRegSeenSets;
+    data.pShRegKeptSets    = pShRegKeptSets;
+    data.shRegCount        = shRegCount;
+    data.shRegBase         = shRegBase;
+    data.pCtxRegSeenSets   = pCtxRegSeenSets;
+    data.pCtxRegKeptSets   = pCtxRegKeptSets;
+#if PAL_CLIENT_INTERFACE_MAJOR_VERSION >= 642
+    data.pCtxRegRollCauses = pCtxRegRollCauses;
+#endif
+    data.ctxRegCount       = ctxRegCount;
+    data.ctxRegBase        = ctxRegBase;
 
     m_pParent->DeveloperCb(Developer::CallbackType::OptimizedRegisters, &data);
 }
@@ -578,6 +578,7 @@ public:
         uint16        shRegBase,
         const uint32* pCtxRegSeenSets,
         const uint32* pCtxRegKeptSets,
+        const uint32* pCtxRegRollCauses,
         uint32        ctxRegCount,
         uint16        ctxRegBase) const;
 #endif
@@ -27,6 +27,7 @@
 #include "core/dmaUploadRing.h"
 #include "core/g_palSettings.h"
 #include "core/platform.h"
+#include "core/settingsLoader.h"
 #include "core/hw/gfxip/gfxDevice.h"
 #include "core/hw/gfxip/pipeline.h"
 #include "palFile.h"
@@ -88,6 +89,14 @@ Pipeline::~Pipeline()
 {
     if (m_gpuMem.IsBound())
     {
+        if (m_uploadFenceToken != 0)
+        {
+            // The DMA upload batch which copies this pipeline into its GPU memory may still be open or executing. It is
+            // shared with other pipelines and must retire before the memory goes back to the internal memory manager.
+            const Result result = m_pDevice->WaitForPendingUploadCpu(m_uploadFenceToken);
+            PAL_ASSERT(result == Result::Success);
+        }
+
         m_pDevice->MemMgr()->FreeGpuMem(m_gpuMem.Memory(), m_gpuMem.Offset());
         m_gpuMem.Update(nullptr, 0);
     }
@@ -503,18 +512,20 @@ void Pipeline::DumpPipelineElf(
     ) const
 {
 #if PAL_ENABLE_PRINTS_ASSERTS
-    const PalSettings& settings = m_pDevice->Settings();
-    uint64 hashToDump = settings.pipelineElfLogConfig.logHash;
+    const PalSettings&       settings        = m_pDevice->Settings();
+    const RuntimeSettingsRef runtimeSettingsRef(*m_pDevice);
+    const RuntimeSettings&   runtimeSettings = *runtimeSettingsRef;
+    uint64 hashToDump = runtimeSettings.pipelineElfLogConfig.logHash;
     bool hashMatches = ((hashToDump == 0) || (m_info.internalPipelineHash.stable == hashToDump));
 
-    const bool dumpInternal  = settings.pipelineElfLogConfig.logInternal;
-    const bool dumpExternal  = settings.pipelineElfLogConfig.logExternal;
+    const bool dumpInternal  = runtimeSettings.pipelineElfLogConfig.logInternal;
+    const bool dumpExternal  = runtimeSettings.pipelineElfLogConfig.logExternal;
     const bool dumpPipeline  =
         (settings.logPipelineElf && hashMatches && ((dumpExternal && !IsInternal()) || (dumpInternal && IsInternal())));
 
     if (dumpPipeline)
     {
-        const char*const pLogDir = &settings.pipelineElfLogConfig.logDirectory[0];
+        const char*const pLogDir = &runtimeSettings.pipelineElfLogConfig.logDirectory[0];
 
         // Create the directory. We don't care if it fails (existing is fine, failure is caught when opening the file).
         MkDir(pLogDir);
@@ -638,6 +649,7 @@ PipelineUploader::PipelineUploader(
     m_pagingFenceVal(0),
     m_pipelineHeapType(GpuHeap::GpuHeapCount),
     m_slotId(0),
+    m_slotAcquired(false),
     m_heapInvisUploadOffset(0)
 {
 }
@@ -646,6 +658,19 @@ PipelineUploader::PipelineUploader(
 PipelineUploader::~PipelineUploader()
 {
     PAL_ASSERT(m_pMappedPtr == nullptr); // If this fires, the caller forgot to call End()!
+
+    if (m_slotAcquired)
+    {
+        // Pipeline creation failed after joining a DMA upload batch. The batch is shared with other pipelines, so it
+        // must still be told that this upload is done or it will never be submitted. It also holds copies into our GPU
+        // memory, which the caller is about to free, so wait for it to retire.
+        UploadFenceToken uploadFence = 0;
+        if (m_pDevice->SubmitDmaUploadRing(m_slotId, &uploadFence, m_pagingFenceVal) == Result::Success)
+        {
+            const Result result = m_pDevice->WaitForPendingUploadCpu(uploadFence);
+            PAL_ASSERT(result == Result::Success);
+        }
+    }
 }
 
 // =====================================================================================================================
@@ -871,6 +896,8 @@ Result PipelineUploader::UploadUsingDma(
     Result result = m_pDevice->AcquireRingSlot(&m_slotId);
     if (result == Result::Success)
     {
+        m_slotAcquired = true;
+
         const gpusize gpuVirtAddr = (m_pGpuMemory->Desc().gpuVirtAddr + m_baseOffset);
 
         const ElfReader::Reader&   elfReader     = m_abiReader.GetElfReader();
@@ -1131,8 +1158,9 @@ Result PipelineUploader::ApplyRelocationSection(
 }
 
 // =====================================================================================================================
-// "Finishes" uploading a pipeline to GPU memory by requesting the device to submit a DMA copy of the pipeline from
-// its initial heap to the local invisible heap. The temporary CPU visible heap is freed.
+// "Finishes" uploading a pipeline to GPU memory by adding the DMA copy of the pipeline from its initial heap to the
+// local invisible heap to the device's current upload batch. The batch is submitted once it fills up or a submission
+// needs it. The temporary CPU visible heap is freed.
 Result PipelineUploader::End(
     UploadFenceToken* pCompletionFence)
 {
@@ -1162,6 +1190,7 @@ Result PipelineUploader::End(
             if (result == Result::Success)
             {
                 result = m_pDevice->SubmitDmaUploadRing(m_slotId, pCompletionFence, m_pagingFenceVal);
+                m_slotAcquired = false;
                 PAL_ASSERT(*pCompletionFence > 0);
                 PAL_SAFE_FREE(m_pMappedPtr, m_pDevice->GetPlatform());
             }
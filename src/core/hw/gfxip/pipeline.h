@@ -466,6 +466,7 @@ private:
 
     GpuHeap         m_pipelineHeapType; // The heap type where this pipeline is located.
     UploadRingSlot  m_slotId;
+    bool            m_slotAcquired;     // If this uploader joined a DMA upload batch which it has not finished yet.
     gpusize         m_heapInvisUploadOffset;
 
     PAL_DISALLOW_DEFAULT_CTOR(PipelineUploader);
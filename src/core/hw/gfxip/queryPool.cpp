@@ -47,7 +47,8 @@ QueryPool::QueryPool(
     m_timestampSizePerSlotInBytes(tsSizeInBytes),
     m_boundSizeInBytes((querySizeInBytes + tsSizeInBytes) * createInfo.numSlots),
     m_device(device),
-    m_timestampStartOffset(m_createInfo.numSlots * m_gpuResultSizePerSlotInBytes)
+    m_timestampStartOffset(m_createInfo.numSlots * m_gpuResultSizePerSlotInBytes),
+    m_pInternalMemMgr(nullptr)
 {
     ResourceDescriptionQueryPool desc = {};
     desc.pCreateInfo = &m_createInfo;
@@ -62,6 +63,11 @@ QueryPool::QueryPool(
 // =====================================================================================================================
 QueryPool::~QueryPool()
 {
+    if (m_pInternalMemMgr != nullptr)
+    {
+        m_pInternalMemMgr->FreeGpuMem(m_gpuMemory.Memory(), m_gpuMemory.Offset());
+    }
+
     ResourceDestroyEventData data = {};
     data.pObj = this;
     m_device.GetPlatform()->GetEventProvider()->LogGpuMemoryResourceDestroyEvent(data);
@@ -202,6 +208,9 @@ Result QueryPool::BindGpuMemory(
     IGpuMemory* pGpuMemory,
     gpusize     offset)
 {
+    // Internally bound pools are bound exactly once, by PAL, during creation.
+    PAL_ASSERT(m_pInternalMemMgr == nullptr);
+
     Result result = Device::ValidateBindObjectMemoryInput(pGpuMemory,
                                                           offset,
                                                           m_boundSizeInBytes,
@@ -223,6 +232,26 @@ Result QueryPool::BindGpuMemory(
     return result;
 }
 
+// =====================================================================================================================
+// Sub-allocates GPU memory for this pool from the internal memory manager's shared pools and binds it. Only used for
+// pools created with the internalMemBind flag; the memory is returned to the manager when the pool is destroyed.
+Result QueryPool::AllocateAndBindInternalGpuMemory(
+    InternalMemMgr* pMemMgr)
+{
+#if PAL_CLIENT_INTERFACE_MAJOR_VERSION >= 642
+    PAL_ASSERT(m_createInfo.flags.internalMemBind == 1);
+#endif
+
+    const Result result = pMemMgr->AllocateAndBindGpuMem(this, false);
+
+    if (result == Result::Success)
+    {
+        m_pInternalMemMgr = pMemMgr;
+    }
+
+    return result;
+}
+
 // =====================================================================================================================
 // Resets the query pool, performing either an optimized or normal reset depending on the command buffer type.
 void QueryPool::Reset(
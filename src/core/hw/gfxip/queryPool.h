@@ -35,6 +35,7 @@ namespace Pal
 class CmdStream;
 class Device;
 class GfxCmdBuffer;
+class InternalMemMgr;
 
 // =====================================================================================================================
 // Represents a set of queries that can be used to retrieve detailed info about the GPU's execution of a particular
@@ -53,6 +54,8 @@ public:
     // NOTE: Part of the IGpuMemoryBindable interface.
     virtual Result BindGpuMemory(IGpuMemory* pGpuMemory, gpusize offset) override;
 
+    Result AllocateAndBindInternalGpuMemory(InternalMemMgr* pMemMgr);
+
     // NOTE: Part of the IQueryPool interface.
     virtual Result GetResults(
         QueryResultFlags flags,
@@ -163,6 +166,9 @@ private:
                                                  // address when the End() is called. And in WaitForSlots() we wait for
                                                  // this timestamp.
 
+    // Set if the bound GPU memory was sub-allocated by PAL on behalf of a pool with the internalMemBind flag.
+    InternalMemMgr* m_pInternalMemMgr;
+
     PAL_DISALLOW_COPY_AND_ASSIGN(QueryPool);
     PAL_DISALLOW_DEFAULT_CTOR(QueryPool);
 };
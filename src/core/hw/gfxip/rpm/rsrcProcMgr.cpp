@@ -1291,6 +1291,29 @@ void RsrcProcMgr::CopyImageCompute(
     pCmdBuffer->CmdSaveComputeState(ComputeStatePipelineAndUserData);
     pCmdBuffer->CmdBindPipeline({ PipelineBindPoint::Compute, pPipeline, InternalApiPsoHash, });
 
+    // Atlas-style copies often issue many regions between the same pair of subresources. Building SRDs is far more
+    // expensive than copying them, so keep the SRDs of the last region and reuse them while the views don't change.
+    const uint8  numSlots     = isFmaskCopy ? 3 : 2;
+    const uint32 numSrdDwords = (SrdDwordAlignment() * numSlots);
+
+    constexpr uint32 MaxCachedSrdDwords = 48;
+    PAL_ASSERT(numSrdDwords <= MaxCachedSrdDwords);
+
+    // Everything the SRDs of a region depend on besides the images themselves.
+    struct SrdViewKey
+    {
+        SubresId       dstSubres;
+        SubresId       srcSubres;
+        uint32         numSlices;
+        uint32         numFmaskSlices;
+        SwizzledFormat dstFormat;
+        SwizzledFormat srcFormat;
+    };
+
+    uint32     cachedSrds[MaxCachedSrdDwords];
+    SrdViewKey cachedViewKey;
+    bool       cachedSrdsValid = false;
+
     // Now begin processing the list of copy regions.
     for (uint32 idx = 0; idx < regionCount; ++idx)
     {
@@ -1360,10 +1383,8 @@ void RsrcProcMgr::CopyImageCompute(
 
         // Create an embedded user-data table and bind it to user data 0. We need image views for the src and dst
         // subresources, as well as some inline constants for the copy offsets and extents.
-        const uint8 numSlots = isFmaskCopy ? 3 : 2;
         uint32* pUserData = RpmUtil::CreateAndBindEmbeddedUserData(pCmdBuffer,
-                                                                   (SrdDwordAlignment() * numSlots +
-                                                                    RpmUtil::CopyImageInfoDwords),
+                                                                   (numSrdDwords + RpmUtil::CopyImageInfoDwords),
                                                                    SrdDwordAlignment(),
                                                                    PipelineBindPoint::Compute,
                                                                    0);
@@ -1371,66 +1392,83 @@ void RsrcProcMgr::CopyImageCompute(
         // When we treat 3D images as 2D arrays each z-slice must be treated as an array slice.
         const uint32 numSlices = (imageType == ImageType::Tex3d) ? copyRegion.extent.depth : copyRegion.numSlices;
 
-        ImageViewInfo imageView[2] = {};
-        SubresRange   viewRange    = { copyRegion.dstSubres, 1, numSlices };
+        SrdViewKey viewKey;
+        memset(&viewKey, 0, sizeof(viewKey));
+        viewKey.dstSubres      = copyRegion.dstSubres;
+        viewKey.srcSubres      = copyRegion.srcSubres;
+        viewKey.numSlices      = numSlices;
+        viewKey.numFmaskSlices = copyRegion.numSlices;
+        viewKey.dstFormat      = dstFormat;
+        viewKey.srcFormat      = srcFormat;
 
-        PAL_ASSERT(TestAnyFlagSet(dstImageLayout.usages, LayoutShaderWrite | LayoutCopyDst) == true);
-        RpmUtil::BuildImageViewInfo(&imageView[0],
-                                    dstImage,
-                                    viewRange,
-                                    dstFormat,
-                                    dstImageLayout,
-                                    device.TexOptLevel());
+        if ((cachedSrdsValid == false) || (memcmp(&viewKey, &cachedViewKey, sizeof(viewKey)) != 0))
+        {
+            ImageViewInfo imageView[2] = {};
+            SubresRange   viewRange    = { copyRegion.dstSubres, 1, numSlices };
 
-        viewRange.startSubres = copyRegion.srcSubres;
-        RpmUtil::BuildImageViewInfo(&imageView[1],
-                                    srcImage,
-                                    viewRange,
-                                    srcFormat,
-                                    srcImageLayout,
-                                    device.TexOptLevel());
+            PAL_ASSERT(TestAnyFlagSet(dstImageLayout.usages, LayoutShaderWrite | LayoutCopyDst) == true);
+            RpmUtil::BuildImageViewInfo(&imageView[0],
+                                        dstImage,
+                                        viewRange,
+                                        dstFormat,
+                                        dstImageLayout,
+                                        device.TexOptLevel());
 
-        // The shader treats all images as 2D arrays which means we need to override the view type to 2D. We also used
-        // to do this for 3D images but that caused test failures when the images used mipmaps because the HW expected
-        // the "numSlices" to be constant for all mip levels (rather than halving at each mip as z-slices do).
-        //
-        // Is it legal for the shader to view 1D and 3D images as 2D?
-        if (imageType == ImageType::Tex1d)
-        {
-            imageView[0].viewType = ImageViewType::Tex2d;
-            imageView[1].viewType = ImageViewType::Tex2d;
-        }
+            viewRange.startSubres = copyRegion.srcSubres;
+            RpmUtil::BuildImageViewInfo(&imageView[1],
+                                        srcImage,
+                                        viewRange,
+                                        srcFormat,
+                                        srcImageLayout,
+                                        device.TexOptLevel());
 
-        if (useMipInSrd == false)
-        {
-            // The miplevel as specified in the shader instruction is actually an offset from the mip-level
-            // as specified in the SRD.
-            imageView[0].subresRange.startSubres.mipLevel = 0;  // dst
-            imageView[1].subresRange.startSubres.mipLevel = 0;  // src
+            // The shader treats all images as 2D arrays which means we need to override the view type to 2D. We also
+            // used to do this for 3D images but that caused test failures when the images used mipmaps because the HW
+            // expected the "numSlices" to be constant for all mip levels (rather than halving at each mip as z-slices
+            // do).
+            //
+            // Is it legal for the shader to view 1D and 3D images as 2D?
+            if (imageType == ImageType::Tex1d)
+            {
+                imageView[0].viewType = ImageViewType::Tex2d;
+                imageView[1].viewType = ImageViewType::Tex2d;
+            }
 
-            // The mip-level from the instruction is also clamped to the "last level" as specified in the SRD.
-            imageView[0].subresRange.numMips = copyRegion.dstSubres.mipLevel + viewRange.numMips;
-            imageView[1].subresRange.numMips = copyRegion.srcSubres.mipLevel + viewRange.numMips;
-        }
+            if (useMipInSrd == false)
+            {
+                // The miplevel as specified in the shader instruction is actually an offset from the mip-level
+                // as specified in the SRD.
+                imageView[0].subresRange.startSubres.mipLevel = 0;  // dst
+                imageView[1].subresRange.startSubres.mipLevel = 0;  // src
+
+                // The mip-level from the instruction is also clamped to the "last level" as specified in the SRD.
+                imageView[0].subresRange.numMips = copyRegion.dstSubres.mipLevel + viewRange.numMips;
+                imageView[1].subresRange.numMips = copyRegion.srcSubres.mipLevel + viewRange.numMips;
+            }
 
-        PAL_ASSERT(singleSubres == false);
+            PAL_ASSERT(singleSubres == false);
 
-        // Turn our image views into HW SRDs here
-        device.CreateImageViewSrds(2, &imageView[0], pUserData);
-        pUserData += SrdDwordAlignment() * 2;
+            // Turn our image views into HW SRDs here
+            device.CreateImageViewSrds(2, &imageView[0], &cachedSrds[0]);
 
-        if (isFmaskCopy)
-        {
-            // If this is an Fmask-accelerated Copy, create an image view of the source Image's Fmask surface.
-            FmaskViewInfo fmaskView = {};
-            fmaskView.pImage         = &srcImage;
-            fmaskView.baseArraySlice = copyRegion.srcSubres.arraySlice;
-            fmaskView.arraySize      = copyRegion.numSlices;
+            if (isFmaskCopy)
+            {
+                // If this is an Fmask-accelerated Copy, create an image view of the source Image's Fmask surface.
+                FmaskViewInfo fmaskView = {};
+                fmaskView.pImage         = &srcImage;
+                fmaskView.baseArraySlice = copyRegion.srcSubres.arraySlice;
+                fmaskView.arraySize      = copyRegion.numSlices;
 
-            m_pDevice->Parent()->CreateFmaskViewSrds(1, &fmaskView, pUserData);
-            pUserData += SrdDwordAlignment();
+                m_pDevice->Parent()->CreateFmaskViewSrds(1, &fmaskView, &cachedSrds[SrdDwordAlignment() * 2]);
+            }
+
+            memcpy(&cachedViewKey, &viewKey, sizeof(viewKey));
+            cachedSrdsValid = true;
         }
 
+        memcpy(pUserData, &cachedSrds[0], (numSrdDwords * sizeof(uint32)));
+        pUserData += numSrdDwords;
+
         // Copy the copy parameters into the embedded user-data space
         memcpy(pUserData, &copyImageInfo, sizeof(copyImageInfo));
 
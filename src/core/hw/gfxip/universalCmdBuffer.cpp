@@ -172,9 +172,10 @@ Result UniversalCmdBuffer::End()
         m_graphicsState.leakFlags.u32All |= m_graphicsState.dirtyFlags.u32All;
 
 #if PAL_ENABLE_PRINTS_ASSERTS
-        if (IsDumpingEnabled() && DumpFile()->IsOpen())
+        // The dump file is only open if dumping was enabled when this command buffer was begun.
+        if (DumpFile()->IsOpen())
         {
-            if (m_device.Parent()->Settings().cmdBufDumpFormat == CmdBufDumpFormatBinaryHeaders)
+            if (DumpFormat() == CmdBufDumpFormatBinaryHeaders)
             {
                 const CmdBufferDumpFileHeader fileHeader =
                 {
@@ -198,7 +199,7 @@ Result UniversalCmdBuffer::End()
                 DumpFile()->Write(&listHeader, sizeof(listHeader));
             }
 
-            DumpCmdStreamsToFile(DumpFile(), m_device.Parent()->Settings().cmdBufDumpFormat);
+            DumpCmdStreamsToFile(DumpFile(), DumpFormat());
             DumpFile()->Close();
         }
 #endif
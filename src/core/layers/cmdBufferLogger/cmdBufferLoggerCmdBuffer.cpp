@@ -940,6 +940,15 @@ CmdBuffer::CmdBuffer(
         m_annotations.u32All = 0;
     }
 
+    // In binary mode, calls which have a BinaryRecord encoding write it instead of their text annotations. All other
+    // calls keep their text annotations, so the categories stay fully annotated.
+    m_binaryAnnotations.u32All = 0;
+
+    if (m_annotations.binaryRecords)
+    {
+        m_binaryAnnotations = m_annotations;
+    }
+
     m_funcTable.pfnCmdSetUserData[static_cast<uint32>(PipelineBindPoint::Compute)]  = &CmdBuffer::CmdSetUserDataCs;
     m_funcTable.pfnCmdSetUserData[static_cast<uint32>(PipelineBindPoint::Graphics)] = &CmdBuffer::CmdSetUserDataGfx;
 
@@ -976,7 +985,11 @@ Result CmdBuffer::Begin(
 
     Result result = GetNextLayer()->Begin(NextCmdBufferBuildInfo(info));
 
-    if (m_annotations.logMiscellaneous)
+    if (m_binaryAnnotations.logMiscellaneous)
+    {
+        WriteRecord(CmdBufCallId::Begin);
+    }
+    else if (m_annotations.logMiscellaneous)
     {
         GetNextLayer()->CmdCommentString(GetCmdBufCallIdString(CmdBufCallId::Begin));
     }
@@ -987,7 +1000,11 @@ Result CmdBuffer::Begin(
 // =====================================================================================================================
 Result CmdBuffer::End()
 {
-    if (m_annotations.logMiscellaneous)
+    if (m_binaryAnnotations.logMiscellaneous)
+    {
+        WriteRecord(CmdBufCallId::End);
+    }
+    else if (m_annotations.logMiscellaneous)
     {
         GetNextLayer()->CmdCommentString(GetCmdBufCallIdString(CmdBufCallId::End));
     }
@@ -1044,7 +1061,30 @@ static void CmdBindPipelineToString(
 void CmdBuffer::CmdBindPipeline(
     const PipelineBindParams& params)
 {
-    if (m_annotations.logCmdBinds)
+    if (m_binaryAnnotations.logCmdBinds)
+    {
+        PipelineHash internalHash = { };
+
+        if (params.pPipeline != nullptr)
+        {
+            internalHash = params.pPipeline->GetInfo().internalPipelineHash;
+        }
+
+        const uint32 args[] =
+        {
+            static_cast<uint32>(params.pipelineBindPoint),
+            (params.pPipeline != nullptr) ? 1u : 0u,
+            LowPart(internalHash.stable),
+            HighPart(internalHash.stable),
+            LowPart(internalHash.unique),
+            HighPart(internalHash.unique),
+            LowPart(params.apiPsoHash),
+            HighPart(params.apiPsoHash),
+        };
+
+        WriteRecord(CmdBufCallId::CmdBindPipeline, args);
+    }
+    else if (m_annotations.logCmdBinds)
     {
         GetNextLayer()->CmdCommentString(GetCmdBufCallIdString(CmdBufCallId::CmdBindPipeline));
 
@@ -1102,7 +1142,11 @@ void CmdBuffer::CmdBindIndexData(
     uint32    indexCount,
     IndexType indexType)
 {
-    if (m_annotations.logCmdBinds)
+    if (m_binaryAnnotations.logCmdBinds)
+    {
+        WriteRecord(CmdBufCallId::CmdBindIndexData);
+    }
+    else if (m_annotations.logCmdBinds)
     {
         GetNextLayer()->CmdCommentString(GetCmdBufCallIdString(CmdBufCallId::CmdBindIndexData));
 
@@ -1364,7 +1408,11 @@ void PAL_STDCALL CmdBuffer::CmdSetUserDataCs(
 {
     auto* pCmdBuf = static_cast<CmdBuffer*>(pCmdBuffer);
 
-    if (pCmdBuf->Annotations().logCmdSetUserData)
+    if (pCmdBuf->m_binaryAnnotations.logCmdSetUserData && (entryCount <= UserDataRecordMaxEntries))
+    {
+        pCmdBuf->WriteUserDataRecord(PipelineBindPoint::Compute, firstEntry, entryCount, pEntryValues);
+    }
+    else if (pCmdBuf->Annotations().logCmdSetUserData)
     {
         pCmdBuf->GetNextLayer()->CmdCommentString(GetCmdBufCallIdString(CmdBufCallId::CmdSetUserData));
 
@@ -1383,7 +1431,11 @@ void PAL_STDCALL CmdBuffer::CmdSetUserDataGfx(
 {
     auto* pCmdBuf = static_cast<CmdBuffer*>(pCmdBuffer);
 
-    if (pCmdBuf->Annotations().logCmdSetUserData)
+    if (pCmdBuf->m_binaryAnnotations.logCmdSetUserData && (entryCount <= UserDataRecordMaxEntries))
+    {
+        pCmdBuf->WriteUserDataRecord(PipelineBindPoint::Graphics, firstEntry, entryCount, pEntryValues);
+    }
+    else if (pCmdBuf->Annotations().logCmdSetUserData)
     {
         pCmdBuf->GetNextLayer()->CmdCommentString(GetCmdBufCallIdString(CmdBufCallId::CmdSetUserData));
 
@@ -2195,7 +2247,31 @@ static void CmdBarrierToString(
 void CmdBuffer::CmdBarrier(
     const BarrierInfo& barrierInfo)
 {
-    if (m_annotations.logCmdBarrier)
+    // The record only holds the fixed part of the barrier, so barriers with any lists are annotated with text to keep
+    // their pipe points, events, targets and transitions in the log.
+    const bool hasBarrierLists = ((barrierInfo.pipePointWaitCount          > 0) ||
+                                  (barrierInfo.gpuEventWaitCount           > 0) ||
+                                  (barrierInfo.rangeCheckedTargetWaitCount > 0) ||
+                                  (barrierInfo.transitionCount             > 0));
+
+    if (m_binaryAnnotations.logCmdBarrier && (hasBarrierLists == false))
+    {
+        const uint32 args[] =
+        {
+            barrierInfo.flags.u32All,
+            static_cast<uint32>(barrierInfo.waitPoint),
+            barrierInfo.pipePointWaitCount,
+            barrierInfo.gpuEventWaitCount,
+            barrierInfo.rangeCheckedTargetWaitCount,
+            barrierInfo.transitionCount,
+            barrierInfo.globalSrcCacheMask,
+            barrierInfo.globalDstCacheMask,
+            barrierInfo.reason,
+        };
+
+        WriteRecord(CmdBufCallId::CmdBarrier, args);
+    }
+    else if (m_annotations.logCmdBarrier)
     {
         GetNextLayer()->CmdCommentString(GetCmdBufCallIdString(CmdBufCallId::CmdBarrier));
 
@@ -2505,6 +2581,49 @@ void CmdBuffer::AddDrawDispatchInfo(
     }
 }
 
+// =====================================================================================================================
+// Writes a BinaryRecord for the given call into a NOP packet. This is the binary counterpart of the comment strings.
+void CmdBuffer::WriteRecord(
+    CmdBufCallId  callId,
+    uint32        argCount,
+    const uint32* pArgs)
+{
+    PAL_ASSERT(argCount <= BinaryRecordMaxArgs);
+
+    BinaryRecord record = { };
+    record.signature    = BinaryRecordSignature;
+    record.callId       = static_cast<uint16>(callId);
+    record.argCount     = static_cast<uint16>(argCount);
+
+    if (argCount > 0)
+    {
+        memcpy(&record.args[0], pArgs, sizeof(uint32) * argCount);
+    }
+
+    GetNextLayer()->CmdNop(&record, sizeof(record) / sizeof(uint32));
+}
+
+// =====================================================================================================================
+// Writes the BinaryRecord for a CmdSetUserData call. The record is packed as the bind point, the first entry and the
+// entry count, followed by the entry values. Callers annotate larger calls with text instead.
+void CmdBuffer::WriteUserDataRecord(
+    PipelineBindPoint bindPoint,
+    uint32            firstEntry,
+    uint32            entryCount,
+    const uint32*     pEntryValues)
+{
+    PAL_ASSERT(entryCount <= UserDataRecordMaxEntries);
+
+    uint32 args[BinaryRecordMaxArgs];
+    args[0] = static_cast<uint32>(bindPoint);
+    args[1] = firstEntry;
+    args[2] = entryCount;
+
+    memcpy(&args[UserDataRecordHeaderArgs], pEntryValues, sizeof(uint32) * entryCount);
+
+    WriteRecord(CmdBufCallId::CmdSetUserData, UserDataRecordHeaderArgs + entryCount, &args[0]);
+}
+
 // =====================================================================================================================
 void CmdBuffer::UpdateDrawDispatchInfo(
     const IPipeline*  pPipeline,
@@ -3051,7 +3170,12 @@ void PAL_STDCALL CmdBuffer::CmdDraw(
 {
     auto* pThis = static_cast<CmdBuffer*>(pCmdBuffer);
 
-    if (pThis->m_annotations.logCmdDraws)
+    if (pThis->m_binaryAnnotations.logCmdDraws)
+    {
+        const uint32 args[] = { firstVertex, vertexCount, firstInstance, instanceCount, drawId };
+        pThis->WriteRecord(CmdBufCallId::CmdDraw, args);
+    }
+    else if (pThis->m_annotations.logCmdDraws)
     {
         pThis->GetNextLayer()->CmdCommentString(GetCmdBufCallIdString(CmdBufCallId::CmdDraw));
 
@@ -3088,7 +3212,11 @@ void PAL_STDCALL CmdBuffer::CmdDrawOpaque(
 {
     auto* pThis = static_cast<CmdBuffer*>(pCmdBuffer);
 
-    if (pThis->m_annotations.logCmdDraws)
+    if (pThis->m_binaryAnnotations.logCmdDraws)
+    {
+        pThis->WriteRecord(CmdBufCallId::CmdDrawOpaque);
+    }
+    else if (pThis->m_annotations.logCmdDraws)
     {
         pThis->GetNextLayer()->CmdCommentString(GetCmdBufCallIdString(CmdBufCallId::CmdDrawOpaque));
         // TODO: Add comment string.
@@ -3111,7 +3239,20 @@ void PAL_STDCALL CmdBuffer::CmdDrawIndexed(
 {
     auto* pThis = static_cast<CmdBuffer*>(pCmdBuffer);
 
-    if (pThis->m_annotations.logCmdDraws)
+    if (pThis->m_binaryAnnotations.logCmdDraws)
+    {
+        const uint32 args[] =
+        {
+            firstIndex,
+            indexCount,
+            static_cast<uint32>(vertexOffset),
+            firstInstance,
+            instanceCount,
+            drawId
+        };
+        pThis->WriteRecord(CmdBufCallId::CmdDrawIndexed, args);
+    }
+    else if (pThis->m_annotations.logCmdDraws)
     {
         pThis->GetNextLayer()->CmdCommentString(GetCmdBufCallIdString(CmdBufCallId::CmdDrawIndexed));
 
@@ -3150,7 +3291,11 @@ void PAL_STDCALL CmdBuffer::CmdDrawIndirectMulti(
 {
     auto* pThis = static_cast<CmdBuffer*>(pCmdBuffer);
 
-    if (pThis->m_annotations.logCmdDraws)
+    if (pThis->m_binaryAnnotations.logCmdDraws)
+    {
+        pThis->WriteRecord(CmdBufCallId::CmdDrawIndirectMulti);
+    }
+    else if (pThis->m_annotations.logCmdDraws)
     {
         pThis->GetNextLayer()->CmdCommentString(GetCmdBufCallIdString(CmdBufCallId::CmdDrawIndirectMulti));
 
@@ -3173,7 +3318,11 @@ void PAL_STDCALL CmdBuffer::CmdDrawIndexedIndirectMulti(
 {
     auto* pThis = static_cast<CmdBuffer*>(pCmdBuffer);
 
-    if (pThis->m_annotations.logCmdDraws)
+    if (pThis->m_binaryAnnotations.logCmdDraws)
+    {
+        pThis->WriteRecord(CmdBufCallId::CmdDrawIndexedIndirectMulti);
+    }
+    else if (pThis->m_annotations.logCmdDraws)
     {
         pThis->GetNextLayer()->CmdCommentString(GetCmdBufCallIdString(CmdBufCallId::CmdDrawIndexedIndirectMulti));
 
@@ -3198,7 +3347,12 @@ void PAL_STDCALL CmdBuffer::CmdDispatch(
 {
     auto* pThis = static_cast<CmdBuffer*>(pCmdBuffer);
 
-    if (pThis->m_annotations.logCmdDispatchs)
+    if (pThis->m_binaryAnnotations.logCmdDispatchs)
+    {
+        const uint32 args[] = { xDim, yDim, zDim };
+        pThis->WriteRecord(CmdBufCallId::CmdDispatch, args);
+    }
+    else if (pThis->m_annotations.logCmdDispatchs)
     {
         pThis->GetNextLayer()->CmdCommentString(GetCmdBufCallIdString(CmdBufCallId::CmdDispatch));
 
@@ -3228,7 +3382,11 @@ void PAL_STDCALL CmdBuffer::CmdDispatchIndirect(
 {
     auto* pThis = static_cast<CmdBuffer*>(pCmdBuffer);
 
-    if (pThis->m_annotations.logCmdDispatchs)
+    if (pThis->m_binaryAnnotations.logCmdDispatchs)
+    {
+        pThis->WriteRecord(CmdBufCallId::CmdDispatchIndirect);
+    }
+    else if (pThis->m_annotations.logCmdDispatchs)
     {
         pThis->GetNextLayer()->CmdCommentString(GetCmdBufCallIdString(CmdBufCallId::CmdDispatchIndirect));
 
@@ -3252,7 +3410,11 @@ void PAL_STDCALL CmdBuffer::CmdDispatchOffset(
 {
     auto* pThis = static_cast<CmdBuffer*>(pCmdBuffer);
 
-    if (pThis->m_annotations.logCmdDispatchs)
+    if (pThis->m_binaryAnnotations.logCmdDispatchs)
+    {
+        pThis->WriteRecord(CmdBufCallId::CmdDispatchOffset);
+    }
+    else if (pThis->m_annotations.logCmdDispatchs)
     {
         pThis->GetNextLayer()->CmdCommentString(GetCmdBufCallIdString(CmdBufCallId::CmdDispatchOffset));
 
@@ -51,7 +51,8 @@ union CmdBufferLoggerAnnotations
         uint32 logCmdSets           :  1;
         uint32 logCmdBlts           :  1;
         uint32 logMiscellaneous     :  1;
-        uint32 reserved             : 23;
+        uint32 binaryRecords        :  1; // Annotate calls which have a BinaryRecord encoding with it instead of text.
+        uint32 reserved             : 22;
     };
 
     uint32 u32All;
@@ -72,6 +73,29 @@ struct DrawDispatchInfo
     uint32     unused[34];
 };
 
+// Every BinaryRecord starts with this signature ("CBLR" in little-endian byte order).
+constexpr uint32 BinaryRecordSignature = 0x524C4243;
+constexpr uint32 BinaryRecordMaxArgs   = 10;
+
+// A CmdSetUserData record holds the bind point, first entry and entry count followed by the entry values. Calls with
+// more entries than fit are annotated with text.
+constexpr uint32 UserDataRecordHeaderArgs = 3;
+constexpr uint32 UserDataRecordMaxEntries = BinaryRecordMaxArgs - UserDataRecordHeaderArgs;
+
+// =====================================================================================================================
+// Fixed-size record written into a NOP payload for each annotated call which has an encoding when the binaryRecords
+// annotation is set; calls without one, or whose arguments don't fit, keep their comment strings. Unlike the comment
+// strings, building a record needs no formatting and no temporary memory. Each call packs the arguments its text
+// annotation would print into args; tools/cmdBufferLoggerTools/decodeBinaryRecords.py turns the records found in a
+// command buffer dump back into the text annotations.
+struct BinaryRecord
+{
+    uint32 signature;                 // Always BinaryRecordSignature.
+    uint16 callId;                    // The annotated CmdBufCallId.
+    uint16 argCount;                  // Number of valid entries in args.
+    uint32 args[BinaryRecordMaxArgs];
+};
+
 class Device;
 
 // =====================================================================================================================
@@ -487,6 +511,13 @@ public:
         return GetNextLayer()->GetUsedSize(type);
     }
 
+#if PAL_CLIENT_INTERFACE_MAJOR_VERSION >= 642
+    virtual Result GetStats(CmdBufferStats* pStats) const override
+    {
+        return GetNextLayer()->GetStats(pStats);
+    }
+#endif
+
 #if PAL_CLIENT_INTERFACE_MAJOR_VERSION >= 554
     virtual void CmdResolvePrtPlusImage(
         const IImage&                    srcImage,
@@ -582,9 +613,26 @@ private:
     void AddDrawDispatchInfo(
         Developer::DrawDispatchType drawDispatchType);
 
+    void WriteRecord(CmdBufCallId callId, uint32 argCount, const uint32* pArgs);
+    void WriteRecord(CmdBufCallId callId) { WriteRecord(callId, 0, nullptr); }
+
+    void WriteUserDataRecord(
+        PipelineBindPoint bindPoint,
+        uint32            firstEntry,
+        uint32            entryCount,
+        const uint32*     pEntryValues);
+
+    template <size_t ArgCount>
+    void WriteRecord(CmdBufCallId callId, const uint32 (&args)[ArgCount])
+    {
+        static_assert(ArgCount <= BinaryRecordMaxArgs, "Too many arguments for a BinaryRecord.");
+        WriteRecord(callId, ArgCount, &args[0]);
+    }
+
     Device*const                 m_pDevice;
     Util::VirtualLinearAllocator m_allocator;       // Temp storage for argument translation.
     CmdBufferLoggerAnnotations   m_annotations;
+    CmdBufferLoggerAnnotations   m_binaryAnnotations; // Calls annotated with BinaryRecords instead of comment strings.
     uint32                       m_drawDispatchCount;
     DrawDispatchInfo             m_drawDispatchInfo;
     bool                         m_embedDrawDispatchInfo;
@@ -28,6 +28,7 @@
 #include "palBorderColorPalette.h"
 #include "palCmdAllocator.h"
 #include "palCmdBuffer.h"
+#include "palCmdTokenStream.h"
 #include "palColorBlendState.h"
 #include "palColorTargetView.h"
 #include "palDepthStencilState.h"
@@ -945,6 +946,21 @@ public:
         void*                                 pPlacementAddr,
         IIndirectCmdGenerator**               ppGenerator) const override;
 
+#if PAL_CLIENT_INTERFACE_MAJOR_VERSION >= 642
+    // Token streams only hold client objects and replay through the client's command buffers, so every layer hands
+    // out the bottom layer's object without wrapping it.
+    virtual size_t GetCmdTokenStreamSize(
+        const CmdTokenStreamCreateInfo& createInfo,
+        Result*                         pResult) const override
+        { return m_pNextLayer->GetCmdTokenStreamSize(createInfo, pResult); }
+
+    virtual Result CreateCmdTokenStream(
+        const CmdTokenStreamCreateInfo& createInfo,
+        void*                           pPlacementAddr,
+        ICmdTokenStream**               ppTokenStream) override
+        { return m_pNextLayer->CreateCmdTokenStream(createInfo, pPlacementAddr, ppTokenStream); }
+#endif
+
     virtual size_t GetPerfExperimentSize(
         const PerfExperimentCreateInfo& createInfo,
         Result*                         pResult) const override;
@@ -1209,6 +1225,10 @@ public:
 
     virtual Result Reset() override { return m_pNextLayer->Reset(); }
 
+#if PAL_CLIENT_INTERFACE_MAJOR_VERSION >= 642
+    virtual Result GetStats(CmdAllocatorStats* pStats) const override { return m_pNextLayer->GetStats(pStats); }
+#endif
+
     // Part of the IDestroyable public interface.
     virtual void Destroy() override
     {
@@ -2020,6 +2040,13 @@ public:
         return m_pNextLayer->GetUsedSize(type);
     }
 
+#if PAL_CLIENT_INTERFACE_MAJOR_VERSION >= 642
+    virtual Result GetStats(CmdBufferStats* pStats) const override
+    {
+        return m_pNextLayer->GetStats(pStats);
+    }
+#endif
+
 #if PAL_CLIENT_INTERFACE_MAJOR_VERSION >= 554
     virtual void CmdResolvePrtPlusImage(
         const IImage&                    srcImage,
@@ -3060,6 +3087,14 @@ public:
 
     virtual bool NeedWindowSizeChangedCheck() const override { return m_pNextLayer->NeedWindowSizeChangedCheck(); }
 
+#if PAL_CLIENT_INTERFACE_MAJOR_VERSION >= 642
+    virtual Result GetPresentTimings(
+        uint32*              pNumRecords,
+        PresentTimingRecord* pRecords,
+        PresentTimingStats*  pStats) override
+        { return m_pNextLayer->GetPresentTimings(pNumRecords, pRecords, pStats); }
+#endif
+
     const IDevice*  GetDevice() const { return m_pDevice; }
     ISwapChain*     GetNextLayer() const { return m_pNextLayer; }
 
@@ -61,11 +61,9 @@ CmdBuffer::CmdBuffer(
     m_timestampAddr(0),
     m_counter(0),
     m_engineType(createInfo.engineType),
-    m_pTokenStream(nullptr),
-    m_tokenStreamSize(m_pDevice->GetPlatform()->PlatformSettings().gpuDebugConfig.tokenAllocatorSize),
-    m_tokenWriteOffset(0),
-    m_tokenReadOffset(0),
-    m_tokenStreamResult(Result::Success),
+    m_tokenStream(m_pDevice->GetPlatform(),
+                  m_pDevice->GetPlatform()->PlatformSettings().gpuDebugConfig.tokenAllocatorSize),
+    m_tokenReader(m_tokenStream),
     m_pLastTgtCmdBuffer(nullptr)
 {
     m_funcTable.pfnCmdSetUserData[static_cast<uint32>(PipelineBindPoint::Compute)]  = &CmdBuffer::CmdSetUserDataCs;
@@ -84,58 +82,6 @@ CmdBuffer::CmdBuffer(
 // =====================================================================================================================
 CmdBuffer::~CmdBuffer()
 {
-    PAL_FREE(m_pTokenStream, m_pDevice->GetPlatform());
-}
-
-// =====================================================================================================================
-void* CmdBuffer::AllocTokenSpace(
-    size_t numBytes,
-    size_t alignment)
-{
-    void*        pTokenSpace        = nullptr;
-    const size_t alignedWriteOffset = Pow2Align(m_tokenWriteOffset, alignment);
-    const size_t nextWriteOffset    = alignedWriteOffset + numBytes;
-
-    if (nextWriteOffset > m_tokenStreamSize)
-    {
-        // Double the size of the token stream until we have enough space.
-        size_t newStreamSize = m_tokenStreamSize * 2;
-
-        while (nextWriteOffset > newStreamSize)
-        {
-            newStreamSize *= 2;
-        }
-
-        // Allocate the new buffer and copy the current tokens over.
-        void* pNewStream = PAL_MALLOC(newStreamSize, m_pDevice->GetPlatform(), AllocInternal);
-
-        if (pNewStream != nullptr)
-        {
-            memcpy(pNewStream, m_pTokenStream, m_tokenWriteOffset);
-            PAL_FREE(m_pTokenStream, m_pDevice->GetPlatform());
-
-            m_pTokenStream    = pNewStream;
-            m_tokenStreamSize = newStreamSize;
-        }
-        else
-        {
-            // We've run out of memory, this stream is now invalid.
-            m_tokenStreamResult = Result::ErrorOutOfMemory;
-        }
-    }
-
-    // Return null if we've previously encountered an error or just failed to reallocate the token stream. Otherwise,
-    // return a properly aligned write pointer and update the write offset to point at the end of the allocated space.
-    if (m_tokenStreamResult == Result::Success)
-    {
-        // Malloc is required to give us memory that is aligned high enough for any variable, but let's double check.
-        PAL_ASSERT(IsPow2Aligned(reinterpret_cast<uint64>(m_pTokenStream), alignment));
-
-        pTokenSpace        = VoidPtrInc(m_pTokenStream, alignedWriteOffset);
-        m_tokenWriteOffset = nextWriteOffset;
-    }
-
-    return pTokenSpace;
 }
 
 // =====================================================================================================================
@@ -291,21 +237,7 @@ Result CmdBuffer::Begin(
     m_counter           = 0;
 
     // Reset the token stream state so that we can reuse our old token stream buffer.
-    m_tokenWriteOffset = 0;
-    m_tokenReadOffset = 0;
-    m_tokenStreamResult = Result::Success;
-
-    // We lazy allocate the first token stream during the first Begin() call to avoid allocating a lot of extra
-    // memory if the client creates a ton of command buffers but doesn't use them.
-    if (m_pTokenStream == nullptr)
-    {
-        m_pTokenStream = PAL_MALLOC(m_tokenStreamSize, m_pDevice->GetPlatform(), AllocInternal);
-
-        if (m_pTokenStream == nullptr)
-        {
-            m_tokenStreamResult = Result::ErrorOutOfMemory;
-        }
-    }
+    m_tokenStream.Reset();
 
     m_buildInfo                 = info;
     m_buildInfo.pInheritedState = {};
@@ -318,7 +250,7 @@ Result CmdBuffer::Begin(
     }
 
     // We should return an error immediately if we couldn't allocate enough token memory for the Begin call.
-    Result result = m_tokenStreamResult;
+    Result result = m_tokenStream.GetResult();
 
     if (result == Result::Success)
     {
@@ -410,7 +342,7 @@ Result CmdBuffer::End()
     // the token stream and this command buffer are both invalid.
     if (result == Result::Success)
     {
-        result = m_tokenStreamResult;
+        result = m_tokenStream.GetResult();
     }
 
     return result;
@@ -3608,10 +3540,10 @@ Result CmdBuffer::Replay(
     Result result = Result::Success;
 
     // Don't even try to replay the stream if some error occured during recording.
-    if (m_tokenStreamResult == Result::Success)
+    if (m_tokenStream.GetResult() == Result::Success)
     {
         // Start reading from the beginning of the token stream.
-        m_tokenReadOffset = 0;
+        m_tokenReader.Rewind();
 
         CmdBufCallId     callId;
         TargetCmdBuffer* pTgtCmdBuffer = nullptr;
@@ -3630,7 +3562,7 @@ Result CmdBuffer::Replay(
             (this->*ReplayFuncTbl[static_cast<uint32>(callId)])(pQueue, pTgtCmdBuffer);
 
             result = pTgtCmdBuffer->GetLastResult();
-        } while ((m_tokenReadOffset != m_tokenWriteOffset) && (result == Result::Success));
+        } while ((m_tokenReader.IsAtEnd() == false) && (result == Result::Success));
     }
 
     return result;
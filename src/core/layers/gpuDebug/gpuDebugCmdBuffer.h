@@ -30,6 +30,7 @@
 #include "palCmdBuffer.h"
 #include "palPipeline.h"
 #include "palLinearAllocator.h"
+#include "core/cmdTokenStream.h"
 #include "core/layers/decorators.h"
 #include "core/layers/functionIds.h"
 
@@ -458,6 +459,13 @@ public:
         return GetNextLayer()->GetUsedSize(type);
     }
 
+#if PAL_CLIENT_INTERFACE_MAJOR_VERSION >= 642
+    virtual Result GetStats(CmdBufferStats* pStats) const override
+    {
+        return GetNextLayer()->GetStats(pStats);
+    }
+#endif
+
 #if PAL_CLIENT_INTERFACE_MAJOR_VERSION >= 554
     virtual void CmdResolvePrtPlusImage(
         const IImage&                    srcImage,
@@ -556,60 +564,20 @@ private:
         uint32      yDim,
         uint32      zDim);
 
-    void* AllocTokenSpace(size_t numBytes, size_t alignment);
-
     // Insert a copy of the specified value into the token stream.
-    template <typename T> void InsertToken(const T& token)
-    {
-        T*const pDst = static_cast<T*>(AllocTokenSpace(sizeof(T), __alignof(T)));
-        if (pDst != nullptr)
-        {
-            *pDst = token;
-        }
-    }
+    template <typename T> void InsertToken(const T& token) { m_tokenStream.Insert(token); }
 
     // Insert a copy of an array of values into the token stream.
     template <typename T> void InsertTokenArray(const T* pData, uint32 count)
-    {
-        InsertToken(count);
-        if (count > 0)
-        {
-            void*const pDst = AllocTokenSpace(sizeof(T) * count, __alignof(T));
-            if (pDst != nullptr)
-            {
-                memcpy(pDst, pData, sizeof(T) * count);
-            }
-        }
-    }
+        { m_tokenStream.InsertArray(pData, count); }
 
     // Retrieves the value of the next item in the token stream then advances the read pointer.  Complement of
     // InsertToken().
-    template <typename T> const T& ReadTokenVal()
-    {
-        PAL_ASSERT(m_tokenStreamResult == Result::Success);
-        m_tokenReadOffset = Util::Pow2Align(m_tokenReadOffset, __alignof(T));
-        const T& val = *static_cast<T*>(Util::VoidPtrInc(m_pTokenStream, m_tokenReadOffset));
-        m_tokenReadOffset += sizeof(T);
-        return val;
-    }
+    template <typename T> const T& ReadTokenVal() { return m_tokenReader.Read<T>(); }
 
     // Retrieves a pointer to the next array of value(s) in the token stream then advances the read pointer.  Returns
     // the number of items stored in the array.  Complement of InsertTokenArray().
-    template <typename T> uint32 ReadTokenArray(T** ppToken)
-    {
-        uint32 count = ReadTokenVal<uint32>();
-        if (count != 0)
-        {
-            m_tokenReadOffset = Util::Pow2Align(m_tokenReadOffset, __alignof(T));
-            *ppToken = static_cast<T*>(Util::VoidPtrInc(m_pTokenStream, m_tokenReadOffset));
-            m_tokenReadOffset += sizeof(T) * count;
-        }
-        else
-        {
-            *ppToken = nullptr;
-        }
-        return count;
-    }
+    template <typename T> uint32 ReadTokenArray(T** ppToken) { return m_tokenReader.ReadArray(ppToken); }
 
     // Helper methods for each ICmdBuffer entry point that replay the recorded tokens into the specified target
     // command buffer.
@@ -746,12 +714,8 @@ private:
     uint32                       m_counter;
     const EngineType             m_engineType;
 
-    // The token stream is a single block of memory that doubles in size each time it runs out of space.
-    void*            m_pTokenStream;      // Storage for tokenized commands. Rewind here on command buffer reset.
-    size_t           m_tokenStreamSize;   // The size of the token stream buffer in bytes.
-    size_t           m_tokenWriteOffset;  // Write the next token at this offset within the token stream.
-    size_t           m_tokenReadOffset;   // Read the next token at this offset within the token stream.
-    Result           m_tokenStreamResult; // This must be Success unless an error occured during AllocTokenSpace.
+    CmdTokenStream         m_tokenStream; // Tokenized commands, recorded between Begin() and End().
+    CmdTokenStream::Reader m_tokenReader; // Replays m_tokenStream into the target command buffers.
 
     CmdBufferBuildInfo m_buildInfo;
     TargetCmdBuffer*   m_pLastTgtCmdBuffer;
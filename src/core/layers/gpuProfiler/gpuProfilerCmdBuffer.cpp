@@ -53,11 +53,8 @@ CmdBuffer::CmdBuffer(
     m_pDevice(pDevice),
     m_queueType(createInfo.queueType),
     m_engineType(createInfo.engineType),
-    m_pTokenStream(nullptr),
-    m_tokenStreamSize(m_pDevice->GetPlatform()->PlatformSettings().gpuProfilerTokenAllocatorSize),
-    m_tokenWriteOffset(0),
-    m_tokenReadOffset(0),
-    m_tokenStreamResult(Result::Success),
+    m_tokenStream(m_pDevice->GetPlatform(), m_pDevice->GetPlatform()->PlatformSettings().gpuProfilerTokenAllocatorSize),
+    m_tokenReader(m_tokenStream),
     m_disableDataGathering(false),
     m_forceDrawGranularityLogging(false),
     m_curLogFrame(0)
@@ -91,58 +88,6 @@ CmdBuffer::CmdBuffer(
 // =====================================================================================================================
 CmdBuffer::~CmdBuffer()
 {
-    PAL_FREE(m_pTokenStream, m_pDevice->GetPlatform());
-}
-
-// =====================================================================================================================
-void* CmdBuffer::AllocTokenSpace(
-    size_t numBytes,
-    size_t alignment)
-{
-    void*        pTokenSpace        = nullptr;
-    const size_t alignedWriteOffset = Pow2Align(m_tokenWriteOffset, alignment);
-    const size_t nextWriteOffset    = alignedWriteOffset + numBytes;
-
-    if (nextWriteOffset > m_tokenStreamSize)
-    {
-        // Double the size of the token stream until we have enough space.
-        size_t newStreamSize = m_tokenStreamSize * 2;
-
-        while (nextWriteOffset > newStreamSize)
-        {
-            newStreamSize *= 2;
-        }
-
-        // Allocate the new buffer and copy the current tokens over.
-        void* pNewStream = PAL_MALLOC(newStreamSize, m_pDevice->GetPlatform(), AllocInternal);
-
-        if (pNewStream != nullptr)
-        {
-            memcpy(pNewStream, m_pTokenStream, m_tokenWriteOffset);
-            PAL_FREE(m_pTokenStream, m_pDevice->GetPlatform());
-
-            m_pTokenStream    = pNewStream;
-            m_tokenStreamSize = newStreamSize;
-        }
-        else
-        {
-            // We've run out of memory, this stream is now invalid.
-            m_tokenStreamResult = Result::ErrorOutOfMemory;
-        }
-    }
-
-    // Return null if we've previously encountered an error or just failed to reallocate the token stream. Otherwise,
-    // return a properly aligned write pointer and update the write offset to point at the end of the allocated space.
-    if (m_tokenStreamResult == Result::Success)
-    {
-        // Malloc is required to give us memory that is aligned high enough for any variable, but let's double check.
-        PAL_ASSERT(IsPow2Aligned(reinterpret_cast<uint64>(m_pTokenStream), alignment));
-
-        pTokenSpace        = VoidPtrInc(m_pTokenStream, alignedWriteOffset);
-        m_tokenWriteOffset = nextWriteOffset;
-    }
-
-    return pTokenSpace;
 }
 
 // =====================================================================================================================
@@ -150,23 +95,10 @@ Result CmdBuffer::Begin(
     const CmdBufferBuildInfo& info)
 {
     m_flags.containsPresent = 0;
+    m_flags.containsNested  = 0;
 
     // Reset the token stream state so that we can reuse our old token stream buffer.
-    m_tokenWriteOffset  = 0;
-    m_tokenReadOffset   = 0;
-    m_tokenStreamResult = Result::Success;
-
-    // We lazy allocate the first token stream during the first Begin() call to avoid allocating a lot of extra
-    // memory if the client creates a ton of command buffers but doesn't use them.
-    if (m_pTokenStream == nullptr)
-    {
-        m_pTokenStream = PAL_MALLOC(m_tokenStreamSize, m_pDevice->GetPlatform(), AllocInternal);
-
-        if (m_pTokenStream == nullptr)
-        {
-            m_tokenStreamResult = Result::ErrorOutOfMemory;
-        }
-    }
+    m_tokenStream.Reset();
 
     InsertToken(CmdBufCallId::Begin);
     InsertToken(info);
@@ -176,7 +108,7 @@ Result CmdBuffer::Begin(
     }
 
     // We should return an error immediately if we couldn't allocate enough token memory for the Begin call.
-    Result result = m_tokenStreamResult;
+    Result result = m_tokenStream.GetResult();
 
     if (result == Result::Success)
     {
@@ -213,8 +145,8 @@ void CmdBuffer::ReplayBegin(
     // We must remove the client's external allocator because PAL can only use it during command building from the
     // client's perspective. By batching and replaying command building later on we're breaking that rule. The good news
     // is that we can replace it with our queue's command buffer replay allocator because replaying is thread-safe with
-    // respect to each queue.
-    info.pMemAllocator = pQueue->ReplayAllocator();
+    // respect to each queue. If the queue replays on multiple threads, each ReplayWorker provides its own allocator.
+    info.pMemAllocator = pQueue->ReplayAllocator(*pTgtCmdBuffer);
 
     pTgtCmdBuffer->Begin(NextCmdBufferBuildInfo(info));
 
@@ -255,7 +187,7 @@ void CmdBuffer::ReplayBegin(
         {
             m_cmdBufLogItem.pGpaSession = pTgtCmdBuffer->GetGpaSession();
         }
-        pQueue->AddLogItem(m_cmdBufLogItem);
+        pQueue->AddReplayLogItem(*pTgtCmdBuffer, m_cmdBufLogItem);
     }
     else
     {
@@ -276,7 +208,7 @@ Result CmdBuffer::End()
     // the token stream and this command buffer are both invalid.
     if (result == Result::Success)
     {
-        result = m_tokenStreamResult;
+        result = m_tokenStream.GetResult();
     }
 
     return result;
@@ -303,7 +235,7 @@ void CmdBuffer::ReplayEnd(
         logItem.frameId                = m_curLogFrame;
         logItem.cmdBufCall.callId      = CmdBufCallId::End;
         logItem.cmdBufCall.subQueueIdx = pTgtCmdBuffer->GetSubQueueIdx();
-        pQueue->AddLogItem(logItem);
+        pQueue->AddReplayLogItem(*pTgtCmdBuffer, logItem);
     }
 
     pTgtCmdBuffer->End();
@@ -2922,6 +2854,8 @@ void CmdBuffer::CmdExecuteNestedCmdBuffers(
 {
     InsertToken(CmdBufCallId::CmdExecuteNestedCmdBuffers);
     InsertTokenArray(ppCmdBuffers, cmdBufferCount);
+
+    m_flags.containsNested = 1;
 }
 
 // =====================================================================================================================
@@ -2938,7 +2872,7 @@ void CmdBuffer::ReplayCmdExecuteNestedCmdBuffers(
         logItem.type              = CmdBufferCall;
         logItem.frameId           = m_curLogFrame;
         logItem.cmdBufCall.callId = CmdBufCallId::CmdExecuteNestedCmdBuffers;
-        pQueue->AddLogItem(logItem);
+        pQueue->AddReplayLogItem(*pTgtCmdBuffer, logItem);
     }
 
     ICmdBuffer*const* ppCmdBuffers   = nullptr;
@@ -3353,7 +3287,7 @@ void CmdBuffer::ReplayCmdCommentString(
         const size_t copySize = sizeof(char) * Min<size_t>(commentLength, MaxCommentLength - 1);
         memcpy(logItem.cmdBufCall.comment.string, pComment, copySize);
 
-        pQueue->AddLogItem(logItem);
+        pQueue->AddReplayLogItem(*pTgtCmdBuffer, logItem);
     }
 
     pTgtCmdBuffer->CmdCommentString(pComment);
@@ -3650,10 +3584,10 @@ Result CmdBuffer::Replay(
     Result result = Result::Success;
 
     // Don't even try to replay the stream if some error occured during recording.
-    if (m_tokenStreamResult == Result::Success)
+    if (m_tokenStream.GetResult() == Result::Success)
     {
         // Start reading from the beginning of the token stream.
-        m_tokenReadOffset = 0;
+        m_tokenReader.Rewind();
 
         CmdBufCallId callId;
 
@@ -3771,7 +3705,7 @@ void CmdBuffer::LogPostTimedCall(
         m_sampleFlags.u8All = 0;
 
         // Add this log item to the queue for processing once the corresponding submit is idle.
-        pQueue->AddLogItem(*pLogItem);
+        pQueue->AddReplayLogItem(*pTgtCmdBuffer, *pLogItem);
     }
 }
 
@@ -3851,7 +3785,8 @@ TargetCmdBuffer::TargetCmdBuffer(
     m_supportTimestamps(false),
     m_pGpaSession(nullptr),
     m_result(Result::Success),
-    m_subQueueIdx(subQueueIdx)
+    m_subQueueIdx(subQueueIdx),
+    m_pReplayWorker(nullptr)
 {
 }
 
@@ -25,6 +25,7 @@
 
 #pragma once
 
+#include "core/cmdTokenStream.h"
 #include "core/layers/functionIds.h"
 #include "core/layers/gpuProfiler/gpuProfilerQueue.h"
 #include "palLinearAllocator.h"
@@ -42,6 +43,7 @@ namespace GpuProfiler
 
 class Device;
 class TargetCmdBuffer;
+struct ReplayWorker;
 
 // Used to track currently-bound compute/graphics pipeline/shader state during replay.
 struct PipelineState
@@ -71,6 +73,7 @@ public:
     Result Replay(Queue* pQueue, TargetCmdBuffer* pTgtCmdBuf, uint32 curFrame);
 
     bool ContainsPresent() const { return m_flags.containsPresent; }
+    bool ContainsNestedCmdBuffers() const { return m_flags.containsNested; }
 
     ICmdBuffer* NextLayer() { return GetNextLayer(); }
     const ICmdBuffer* NextLayer() const { return GetNextLayer(); }
@@ -473,6 +476,14 @@ public:
         return 0;
     }
 
+#if PAL_CLIENT_INTERFACE_MAJOR_VERSION >= 642
+    virtual Result GetStats(CmdBufferStats* pStats) const override
+    {
+        // Build CMD calls are recorded and may not be replayed yet, so there is nothing meaningful to report.
+        return (pStats != nullptr) ? Result::ErrorUnavailable : Result::ErrorInvalidPointer;
+    }
+#endif
+
 #if PAL_CLIENT_INTERFACE_MAJOR_VERSION >= 554
     virtual void CmdResolvePrtPlusImage(
         const IImage&                    srcImage,
@@ -560,60 +571,20 @@ private:
         uint32      yDim,
         uint32      zDim);
 
-    void* AllocTokenSpace(size_t numBytes, size_t alignment);
-
     // Insert a copy of the specified value into the token stream.
-    template <typename T> void InsertToken(const T& token)
-    {
-        T*const pDst = static_cast<T*>(AllocTokenSpace(sizeof(T), __alignof(T)));
-        if (pDst != nullptr)
-        {
-            *pDst = token;
-        }
-    }
+    template <typename T> void InsertToken(const T& token) { m_tokenStream.Insert(token); }
 
     // Insert a copy of an array of values into the token stream.
     template <typename T> void InsertTokenArray(const T* pData, uint32 count)
-    {
-        InsertToken(count);
-        if (count > 0)
-        {
-            void*const pDst = AllocTokenSpace(sizeof(T) * count, __alignof(T));
-            if (pDst != nullptr)
-            {
-                memcpy(pDst, pData, sizeof(T) * count);
-            }
-        }
-    }
+        { m_tokenStream.InsertArray(pData, count); }
 
     // Retrieves the value of the next item in the token stream then advances the read pointer.  Complement of
     // InsertToken().
-    template <typename T> const T& ReadTokenVal()
-    {
-        PAL_ASSERT(m_tokenStreamResult == Result::Success);
-        m_tokenReadOffset = Util::Pow2Align(m_tokenReadOffset, __alignof(T));
-        const T& val = *static_cast<T*>(Util::VoidPtrInc(m_pTokenStream, m_tokenReadOffset));
-        m_tokenReadOffset += sizeof(T);
-        return val;
-    }
+    template <typename T> const T& ReadTokenVal() { return m_tokenReader.Read<T>(); }
 
     // Retrieves a pointer to the next array of value(s) in the token stream then advances the read pointer.  Returns
     // the number of items stored in the array.  Complement of InsertTokenArray().
-    template <typename T> uint32 ReadTokenArray(T** ppToken)
-    {
-        uint32 count = ReadTokenVal<uint32>();
-        if (count != 0)
-        {
-            m_tokenReadOffset = Util::Pow2Align(m_tokenReadOffset, __alignof(T));
-            *ppToken = static_cast<T*>(Util::VoidPtrInc(m_pTokenStream, m_tokenReadOffset));
-            m_tokenReadOffset += sizeof(T) * count;
-        }
-        else
-        {
-            *ppToken = nullptr;
-        }
-        return count;
-    }
+    template <typename T> uint32 ReadTokenArray(T** ppToken) { return m_tokenReader.ReadArray(ppToken); }
 
     // Helper methods for each ICmdBuffer entry point that replay the recorded tokens into the specified target
     // command buffer.
@@ -746,12 +717,8 @@ private:
     const QueueType  m_queueType;
     const EngineType m_engineType;
 
-    // The token stream is a single block of memory that doubles in size each time it runs out of space.
-    void*            m_pTokenStream;      // Storage for tokenized commands. Rewind here on command buffer reset.
-    size_t           m_tokenStreamSize;   // The size of the token stream buffer in bytes.
-    size_t           m_tokenWriteOffset;  // Write the next token at this offset within the token stream.
-    size_t           m_tokenReadOffset;   // Read the next token at this offset within the token stream.
-    Result           m_tokenStreamResult; // This must be Success unless an error occured during AllocTokenSpace.
+    CmdTokenStream         m_tokenStream; // Tokenized commands, recorded between Begin() and End().
+    CmdTokenStream::Reader m_tokenReader; // Replays m_tokenStream into the target command buffers.
 
     struct
     {
@@ -759,7 +726,8 @@ private:
         uint32 enableSqThreadTrace :  1;  // Thread traces should be collected based on specified data granularity.
         uint32 containsPresent     :  1;  // A CmdPresent() call is made in this command buffer.
         uint32 nested              :  1;  // This is a nested command buffer.
-        uint32 reserved            : 28;
+        uint32 containsNested      :  1;  // A CmdExecuteNestedCmdBuffers() call is made in this command buffer.
+        uint32 reserved            : 27;
     } m_flags;
 
     union
@@ -832,6 +800,10 @@ public:
     bool IsFromMasterSubQue() const { return m_subQueueIdx == 0; }
     uint32 GetSubQueueIdx() const { return m_subQueueIdx; }
 
+    // The worker replaying into this command buffer, or null if it is replayed serially by the submitting thread.
+    ReplayWorker* GetReplayWorker() const { return m_pReplayWorker; }
+    void SetReplayWorker(ReplayWorker* pWorker) { m_pReplayWorker = pWorker; }
+
 protected:
     virtual ~TargetCmdBuffer() {}
 
@@ -854,6 +826,8 @@ private:
     // The subQueue to which this tgtCmdBuf belongs. This won't change onced the tgtCmdBuf is created.
     const uint32                 m_subQueueIdx;
 
+    ReplayWorker*                m_pReplayWorker;
+
     PAL_DISALLOW_DEFAULT_CTOR(TargetCmdBuffer);
     PAL_DISALLOW_COPY_AND_ASSIGN(TargetCmdBuffer);
 };
@@ -93,6 +93,7 @@ public:
     bool   GetSqttAddTtvHashes() const { return m_sqttAddTtvHashes; }
 
     bool LoggingEnabled(GpuProfilerGranularity granularity) const;
+    GpuProfilerGranularity GetProfilerGranularity() const { return m_profilerGranularity; }
 
     bool SqttEnabledForPipeline(const PipelineState& state, PipelineBindPoint bindPoint) const;
 
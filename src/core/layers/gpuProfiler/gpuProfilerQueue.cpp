@@ -52,6 +52,11 @@ Queue::Queue(
     m_shaderEngineCount(0),
     m_pCmdAllocator(nullptr),
     m_replayAllocator(64 * 1024),
+    m_parallelReplay(false),
+    m_replayJobs(static_cast<Platform*>(pDevice->GetPlatform())),
+    m_nextReplayJob(0),
+    m_numReplayWorkers(0),
+    m_replayTerminate(false),
     m_availableGpaSessions(static_cast<Platform*>(pDevice->GetPlatform())),
     m_busyGpaSessions(static_cast<Platform*>(pDevice->GetPlatform())),
     m_availPerfExpMem(static_cast<Platform*>(pDevice->GetPlatform())),
@@ -68,6 +73,7 @@ Queue::Queue(
     memset(&m_gpaSessionSampleConfig,    0, sizeof(m_gpaSessionSampleConfig));
     memset(&m_nextSubmitInfo,            0, sizeof(m_nextSubmitInfo));
     memset(&m_perFrameLogItem,           0, sizeof(m_perFrameLogItem));
+    memset(&m_pReplayWorkers[0],         0, sizeof(m_pReplayWorkers));
 
     // All nested allocations are set the the minimum size (4KB) because applications that submit hundreds of nested
     // command buffers can potentially exhaust the GPU VA range by simply playing back too many nested command buffers.
@@ -86,6 +92,8 @@ Queue::Queue(
 // =====================================================================================================================
 Queue::~Queue()
 {
+    StopReplayWorkers();
+
     // Ensure all log items are flushed out before we shut down.
     WaitIdle();
     ProcessIdleSubmits();
@@ -240,10 +248,38 @@ Result Queue::Init(
         result = m_replayAllocator.Init();
     }
 
+    if (result == Result::Success)
+    {
+        result = m_replayLock.Init();
+    }
+
+    if (result == Result::Success)
+    {
+        result = m_replayStart.Init(ReplayThreadCount, 0);
+    }
+
+    if (result == Result::Success)
+    {
+        result = m_replayDone.Init(ReplayThreadCount, 0);
+    }
+
+    // Command buffers of one submit can only be replayed concurrently when all they need from the queue is timestamps:
+    // perf experiments and thread traces acquire memory from pools shared by all of this queue's GPA sessions.
+    const auto& profilerConfig = m_pDevice->GetPlatform()->PlatformSettings().gpuProfilerConfig;
+
+    m_parallelReplay = (ReplayThreadCount > 1)                                             &&
+                       (profilerConfig.breakSubmitBatches == false)                        &&
+                       (m_pDevice->GetProfilerGranularity() == GpuProfilerGranularityDraw) &&
+                       (m_pDevice->NumGlobalPerfCounters() == 0)                           &&
+                       (m_pDevice->NumStreamingPerfCounters() == 0)                        &&
+                       (m_pDevice->IsThreadTraceEnabled() == false)                        &&
+                       (m_pDevice->IsSpmTraceEnabled() == false);
+
     if (result == Result::Success)
     {
         CmdAllocatorCreateInfo createInfo = { };
         createInfo.flags.autoMemoryReuse                      = 1;
+        createInfo.flags.threadSafe                           = m_parallelReplay ? 1 : 0;
         createInfo.allocInfo[CommandDataAlloc].allocHeap      = GpuHeapGartUswc;
         createInfo.allocInfo[CommandDataAlloc].allocSize      = 2 * 1024 * 1024;
         createInfo.allocInfo[CommandDataAlloc].suballocSize   = 64 * 1024;
@@ -463,6 +499,14 @@ Result Queue::Submit(
 
     bool breakBatches = m_pDevice->GetPlatform()->PlatformSettings().gpuProfilerConfig.breakSubmitBatches;
 
+    // Replaying with per-draw timing is expensive, so spread the command buffers of this submit over multiple threads
+    // when that is safe. Note that m_parallelReplay is never set if breakBatches is.
+    const bool parallelReplay = m_parallelReplay                                   &&
+                                m_pDevice->LoggingEnabled(GpuProfilerGranularityDraw) &&
+                                CanReplayInParallel(submitInfo);
+
+    m_replayJobs.Clear();
+
     AutoBuffer<GpuMemoryRef, 32, PlatformDecorator> nextGpuMemoryRefs(submitInfo.gpuMemRefCount, pPlatform);
     AutoBuffer<DoppRef,      32, PlatformDecorator> nextDoppRefs(submitInfo.doppRefCount, pPlatform);
 #if PAL_CLIENT_INTERFACE_MAJOR_VERSION >= 568
@@ -594,10 +638,24 @@ Result Queue::Submit(
                     nextCmdBuffers[globalCmdBufIdx + localCmdBufIdx] = NextCmdBuffer(pTargetCmdBuffer);
                     localCmdBufIdx++;
 
-                    // Replay the client-specified command buffer commands into the queue-owned command buffer.
-                    result = pRecordedCmdBuffer->Replay(this,
-                                                        pTargetCmdBuffer,
-                                                        static_cast<Platform*>(m_pDevice->GetPlatform())->FrameId());
+                    const uint32 frameId = static_cast<Platform*>(m_pDevice->GetPlatform())->FrameId();
+
+                    if (parallelReplay)
+                    {
+                        // Defer the replay until every target command buffer of this submit has been acquired in
+                        // submission order; the jobs are then replayed concurrently by ReplayInParallel().
+                        ReplayJob job          = { };
+                        job.pRecordedCmdBuffer = pRecordedCmdBuffer;
+                        job.pTargetCmdBuffer   = pTargetCmdBuffer;
+                        job.frameId            = frameId;
+
+                        result = m_replayJobs.PushBack(job);
+                    }
+                    else
+                    {
+                        // Replay the client-specified command buffer commands into the queue-owned command buffer.
+                        result = pRecordedCmdBuffer->Replay(this, pTargetCmdBuffer, frameId);
+                    }
 
                     nextPerSubQueueInfosBreakBatch[subQueueIdx].cmdBufferCount = needPresent ? 2 : 1;
                     nextPerSubQueueInfosBreakBatch[subQueueIdx].ppCmdBuffers = &nextCmdBuffers[
@@ -662,6 +720,11 @@ Result Queue::Submit(
             nextPerSubQueueInfosBreakBatch[subQueueIdx].pCmdBufInfoList = nullptr;
         } // end of traversing each perSubQueueInfo
 
+        if ((result == Result::Success) && parallelReplay)
+        {
+            result = ReplayInParallel();
+        }
+
         if ((result == Result::Success) && (breakBatches == false))
         {
             // Make sure we didn't overflow the next arrays.
@@ -971,6 +1034,9 @@ TargetCmdBuffer* Queue::AcquireNestedCmdBuf(
 Result Queue::AcquireGpaSession(
     GpuUtil::GpaSession** ppGpaSession)
 {
+    // Target command buffers replayed by different ReplayWorkers may acquire their sessions concurrently.
+    MutexAuto lock(&m_replayLock);
+
     Result result = Result::Success;
 
     // A session is acquired from either available list or newly-created
@@ -1143,6 +1209,259 @@ void Queue::AddLogItem(
     }
 }
 
+// =====================================================================================================================
+// Adds an entry to the queue of logged calls on behalf of the command buffer being replayed into tgtCmdBuffer.
+void Queue::AddReplayLogItem(
+    const TargetCmdBuffer& tgtCmdBuffer,
+    const LogItem&         logItem)
+{
+    ReplayWorker*const pWorker = tgtCmdBuffer.GetReplayWorker();
+
+    if (pWorker == nullptr)
+    {
+        AddLogItem(logItem);
+    }
+    else
+    {
+        // ReplayInParallel() moves this item to m_logItems once all jobs of the current submit are done.
+        pWorker->logItems.PushBack(logItem);
+        pWorker->pCurJob->logItemCount++;
+    }
+}
+
+// =====================================================================================================================
+// Returns the allocator for temporary memory needed while replaying into tgtCmdBuffer.
+VirtualLinearAllocator* Queue::ReplayAllocator(
+    const TargetCmdBuffer& tgtCmdBuffer)
+{
+    ReplayWorker*const pWorker = tgtCmdBuffer.GetReplayWorker();
+
+    return (pWorker == nullptr) ? &m_replayAllocator : &pWorker->allocator;
+}
+
+// =====================================================================================================================
+// Returns true if the recorded command buffers of the given submit can be replayed concurrently. Besides needing more
+// than one command buffer, none of them may share state with another one during replay: a present advances the frame
+// and nested command buffers are replayed through their own recorded command buffer, which can be executed by several
+// of the submitted command buffers.
+//
+// Parallelism is per recorded command buffer only: a submit of a single command buffer is always replayed serially.
+// Splitting one token stream into ranges at barriers or Begin/End isn't implemented, because the target command buffer
+// replaying a later range would first need all pipeline, user data and target state bound by the earlier ranges.
+bool Queue::CanReplayInParallel(
+    const MultiSubmitInfo& submitInfo
+    ) const
+{
+    bool   canReplay  = true;
+    uint32 totalCount = 0;
+
+    for (uint32 qIdx = 0; ((qIdx < submitInfo.perSubQueueInfoCount) && canReplay); qIdx++)
+    {
+        const PerSubQueueSubmitInfo& subQueueInfo = submitInfo.pPerSubQueueInfo[qIdx];
+
+        for (uint32 i = 0; ((i < subQueueInfo.cmdBufferCount) && canReplay); i++)
+        {
+            const auto*const pCmdBuffer = static_cast<const CmdBuffer*>(subQueueInfo.ppCmdBuffers[i]);
+
+            canReplay = ((pCmdBuffer->ContainsPresent() == false) &&
+                         (pCmdBuffer->ContainsNestedCmdBuffers() == false));
+
+            // The same command buffer can be submitted more than once, but its replay state can't be shared.
+            for (uint32 prevQIdx = 0; ((prevQIdx <= qIdx) && canReplay); prevQIdx++)
+            {
+                const PerSubQueueSubmitInfo& prevInfo  = submitInfo.pPerSubQueueInfo[prevQIdx];
+                const uint32                 prevCount = (prevQIdx == qIdx) ? i : prevInfo.cmdBufferCount;
+
+                for (uint32 j = 0; ((j < prevCount) && canReplay); j++)
+                {
+                    canReplay = (prevInfo.ppCmdBuffers[j] != pCmdBuffer);
+                }
+            }
+
+            totalCount++;
+        }
+    }
+
+    return canReplay && (totalCount > 1);
+}
+
+// =====================================================================================================================
+// Creates the first workerCount replay workers if they don't exist yet. Every worker but the first one, which stands
+// for the submitting thread, gets its own helper thread. This is best effort: if a worker can't be created, the jobs
+// are simply spread over fewer threads.
+void Queue::StartReplayWorkers(
+    uint32 workerCount)
+{
+    Platform*const pPlatform = static_cast<Platform*>(m_pDevice->GetPlatform());
+    Result         result    = Result::Success;
+
+    while ((m_numReplayWorkers < workerCount) && (result == Result::Success))
+    {
+        ReplayWorker* pWorker = PAL_NEW(ReplayWorker, pPlatform, AllocInternal)(this, pPlatform);
+
+        if (pWorker == nullptr)
+        {
+            result = Result::ErrorOutOfMemory;
+        }
+        else
+        {
+            result = pWorker->allocator.Init();
+
+            if ((result == Result::Success) && (m_numReplayWorkers > 0))
+            {
+                result = pWorker->thread.Begin(&ReplayThreadCallback, pWorker);
+            }
+
+            if (result == Result::Success)
+            {
+                m_pReplayWorkers[m_numReplayWorkers++] = pWorker;
+            }
+            else
+            {
+                PAL_SAFE_DELETE(pWorker, pPlatform);
+            }
+        }
+    }
+}
+
+// =====================================================================================================================
+// Terminates all helper threads and destroys the replay workers.
+void Queue::StopReplayWorkers()
+{
+    Platform*const pPlatform = static_cast<Platform*>(m_pDevice->GetPlatform());
+
+    if (m_numReplayWorkers > 1)
+    {
+        m_replayTerminate = true;
+        m_replayStart.Post(m_numReplayWorkers - 1);
+    }
+
+    for (uint32 idx = 0; idx < m_numReplayWorkers; idx++)
+    {
+        if (idx > 0)
+        {
+            m_pReplayWorkers[idx]->thread.Join();
+        }
+
+        PAL_SAFE_DELETE(m_pReplayWorkers[idx], pPlatform);
+    }
+
+    m_numReplayWorkers = 0;
+}
+
+// =====================================================================================================================
+// Entry point of the replay helper threads. Each time the queue posts m_replayStart, the thread helps replaying the
+// jobs of the current submit until none are left and then posts m_replayDone.
+void Queue::ReplayThreadCallback(
+    void* pParameter) // Opaque pointer to a ReplayWorker
+{
+    ReplayWorker*const pWorker = static_cast<ReplayWorker*>(pParameter);
+    Queue*const        pQueue  = pWorker->pQueue;
+
+    while (true)
+    {
+        pQueue->m_replayStart.Wait(UINT32_MAX);
+
+        if (pQueue->m_replayTerminate)
+        {
+            pWorker->thread.End();
+        }
+
+        pQueue->ExecuteReplayJobs(pWorker);
+        pQueue->m_replayDone.Post();
+    }
+
+    PAL_NEVER_CALLED(); // This area should be unreachable.
+}
+
+// =====================================================================================================================
+// Replays jobs of the current submit on the calling thread until none are left.
+void Queue::ExecuteReplayJobs(
+    ReplayWorker* pWorker)
+{
+    const uint32 jobCount = m_replayJobs.NumElements();
+    uint32       jobIdx   = AtomicIncrement(&m_nextReplayJob) - 1;
+
+    while (jobIdx < jobCount)
+    {
+        ReplayJob*const pJob = &m_replayJobs.At(jobIdx);
+
+        pJob->pWorker    = pWorker;
+        pWorker->pCurJob = pJob;
+
+        pJob->pTargetCmdBuffer->SetReplayWorker(pWorker);
+        pJob->result = pJob->pRecordedCmdBuffer->Replay(this, pJob->pTargetCmdBuffer, pJob->frameId);
+        pJob->pTargetCmdBuffer->SetReplayWorker(nullptr);
+
+        jobIdx = AtomicIncrement(&m_nextReplayJob) - 1;
+    }
+
+    pWorker->pCurJob = nullptr;
+}
+
+// =====================================================================================================================
+// Replays the jobs deferred by the current submit on the submitting thread and up to ReplayThreadCount - 1 helper
+// threads. Each worker collects the log items of its jobs privately; they are merged back in submission order here so
+// the log output is identical to a serial replay.
+Result Queue::ReplayInParallel()
+{
+    const uint32 jobCount = m_replayJobs.NumElements();
+
+    StartReplayWorkers(Min(jobCount, ReplayThreadCount));
+
+    Result result = Result::Success;
+
+    if (m_numReplayWorkers == 0)
+    {
+        // We couldn't even create a worker for this thread, fall back to a serial replay.
+        for (uint32 jobIdx = 0; ((jobIdx < jobCount) && (result == Result::Success)); jobIdx++)
+        {
+            const ReplayJob& job = m_replayJobs.At(jobIdx);
+
+            result = job.pRecordedCmdBuffer->Replay(this, job.pTargetCmdBuffer, job.frameId);
+        }
+    }
+    else
+    {
+        const uint32 helperCount = Min(jobCount, m_numReplayWorkers) - 1;
+
+        m_nextReplayJob = 0;
+
+        if (helperCount > 0)
+        {
+            m_replayStart.Post(helperCount);
+        }
+
+        ExecuteReplayJobs(m_pReplayWorkers[0]);
+
+        for (uint32 i = 0; i < helperCount; i++)
+        {
+            m_replayDone.Wait(UINT32_MAX);
+        }
+
+        for (uint32 jobIdx = 0; jobIdx < jobCount; jobIdx++)
+        {
+            const ReplayJob& job = m_replayJobs.At(jobIdx);
+
+            for (uint32 i = 0; i < job.logItemCount; i++)
+            {
+                LogItem logItem;
+                job.pWorker->logItems.PopFront(&logItem);
+                AddLogItem(logItem);
+            }
+
+            if (result == Result::Success)
+            {
+                result = job.result;
+            }
+        }
+    }
+
+    m_replayJobs.Clear();
+
+    return result;
+}
+
 // =====================================================================================================================
 // Adds a log entry for the specified queue call.
 void Queue::LogQueueCall(
@@ -31,6 +31,10 @@
 #include "palFile.h"
 #include "palGpaSession.h"
 #include "palLinearAllocator.h"
+#include "palMutex.h"
+#include "palSemaphore.h"
+#include "palThread.h"
+#include "palVector.h"
 
 namespace Pal
 {
@@ -40,6 +44,7 @@ namespace GpuProfiler
 class CmdBuffer;
 class Device;
 class Platform;
+class Queue;
 class TargetCmdBuffer;
 
 static constexpr size_t MaxCommentLength = 512;
@@ -169,6 +174,44 @@ struct SubQueueInfo
 typedef Util::Deque<TargetCmdBuffer*, Platform> CmdBufDeque;
 typedef Util::Deque<NestedInfo, Platform> NestedCmdBufDeque;
 
+struct ReplayWorker;
+
+// Number of threads, including the submitting thread, which may replay the recorded command buffers of one submit.
+static constexpr uint32 ReplayThreadCount = 4;
+
+// A recorded command buffer whose replay into its queue-owned target command buffer has been deferred so that it can
+// run concurrently with the other command buffers in the same submit.
+struct ReplayJob
+{
+    CmdBuffer*       pRecordedCmdBuffer;
+    TargetCmdBuffer* pTargetCmdBuffer;
+    uint32           frameId;      // Frame ID the recorded command buffer is replayed for.
+    ReplayWorker*    pWorker;      // Worker which replayed this job.
+    uint32           logItemCount; // Number of log items this job added to its worker's list.
+    Result           result;
+};
+
+// Private state of one thread replaying ReplayJobs.  Everything a replayed command buffer would normally get from the
+// Queue and which isn't safe to share between threads (temporary memory, the ordered log item list) is provided here
+// instead; the Queue merges the log items back into its own list in submission order once all jobs are done.
+struct ReplayWorker
+{
+    ReplayWorker(Queue* pQueue, Platform* pPlatform)
+        :
+        pQueue(pQueue),
+        allocator(64 * 1024),
+        logItems(pPlatform),
+        pCurJob(nullptr)
+    {
+    }
+
+    Queue*const                    pQueue;
+    Util::Thread                   thread;    // Never started for worker zero, which is the submitting thread.
+    Util::VirtualLinearAllocator   allocator; // Replaces the Queue's replay allocator for this worker's jobs.
+    Util::Deque<LogItem, Platform> logItems;  // Log items added by this worker's jobs, in job order.
+    ReplayJob*                     pCurJob;   // Job currently being replayed by this worker.
+};
+
 // =====================================================================================================================
 // GpuProfiler implementation of the IQueue interface.  Resposible for generating instrumented versions of the
 // recorded ICmdBuffer objects the client submits and gathering/reporting performance data.
@@ -190,7 +233,10 @@ public:
 
     void AddLogItem(const LogItem& logItem);
 
-    Util::VirtualLinearAllocator* ReplayAllocator() { return &m_replayAllocator; }
+    // Variants of the above which are called while replaying into the given target command buffer. They redirect to
+    // the replaying thread's private state if the target is being replayed by a ReplayWorker.
+    void AddReplayLogItem(const TargetCmdBuffer& tgtCmdBuffer, const LogItem& logItem);
+    Util::VirtualLinearAllocator* ReplayAllocator(const TargetCmdBuffer& tgtCmdBuffer);
 
     // Public IQueue interface methods:
     virtual Result Submit(
@@ -239,6 +285,13 @@ private:
 
     void BeginNextFrame(bool samplingEnabled);
 
+    bool CanReplayInParallel(const MultiSubmitInfo& submitInfo) const;
+    void StartReplayWorkers(uint32 workerCount);
+    void StopReplayWorkers();
+    Result ReplayInParallel();
+    void ExecuteReplayJobs(ReplayWorker* pWorker);
+    static void ReplayThreadCallback(void* pParameter);
+
     void LogQueueCall(QueueCallId callId);
 
     void OutputLogItemsToFile(size_t count, bool hasDrawsDispatches);
@@ -277,6 +330,18 @@ private:
 
     Util::VirtualLinearAllocator m_replayAllocator; // Used to allocate temporary memory during command buffer replay.
 
+    // State for replaying the command buffers of one submit on multiple threads. This is only enabled for draw
+    // granularity timing because perf experiments and thread traces draw from pools shared by the whole queue.
+    bool                                      m_parallelReplay;
+    Util::Mutex                               m_replayLock;       // Protects queue-owned pools during replay.
+    Util::Vector<ReplayJob, 16, Platform>     m_replayJobs;       // Jobs deferred by the current submit.
+    volatile uint32                           m_nextReplayJob;    // Index of the next job to be picked up.
+    ReplayWorker*                             m_pReplayWorkers[ReplayThreadCount];
+    uint32                                    m_numReplayWorkers; // Number of valid entries in m_pReplayWorkers.
+    Util::Semaphore                           m_replayStart;      // Posted once per helper thread to start work.
+    Util::Semaphore                           m_replayDone;       // Posted by each helper thread once it runs dry.
+    volatile bool                             m_replayTerminate;  // Asks the helper threads to exit.
+
     // Each replayed nested command buffer needs its own allocator which will be created from this create info.
     CmdAllocatorCreateInfo m_nestedAllocatorCreateInfo;
 
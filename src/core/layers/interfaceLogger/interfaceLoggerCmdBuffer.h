@@ -448,6 +448,14 @@ public:
         return GetNextLayer()->GetUsedSize(type);
     }
 
+#if PAL_CLIENT_INTERFACE_MAJOR_VERSION >= 642
+    virtual Result GetStats(CmdBufferStats* pStats) const override
+    {
+        // This function is not logged because it doesn't modify the command buffer.
+        return GetNextLayer()->GetStats(pStats);
+    }
+#endif
+
 #if PAL_CLIENT_INTERFACE_MAJOR_VERSION >= 554
     virtual void CmdResolvePrtPlusImage(
         const IImage&                    srcImage,
@@ -566,6 +566,13 @@ void LogContext::Struct(
         Value("disableBusyChunkTracking");
     }
 
+#if PAL_CLIENT_INTERFACE_MAJOR_VERSION >= 642
+    if (value.flags.useHugePages)
+    {
+        Value("useHugePages");
+    }
+#endif
+
     EndList();
     KeyAndBeginMap("allocInfo", false);
 
@@ -2258,7 +2265,23 @@ void LogContext::Struct(
         Value("notifyOnly");
     }
 
+#if PAL_CLIENT_INTERFACE_MAJOR_VERSION >= 642
+    if (value.flags.paced)
+    {
+        Value("paced");
+    }
+#endif
+
     EndList();
+
+#if PAL_CLIENT_INTERFACE_MAJOR_VERSION >= 642
+    if (value.flags.paced)
+    {
+        KeyAndValue("targetPresentTime", value.targetPresentTime);
+        KeyAndValue("presentInterval", value.presentInterval);
+    }
+#endif
+
     EndMap();
 }
 
@@ -46,7 +46,8 @@ CmdBuffer::CmdBuffer(
     :
     CmdBufferFwdDecorator(pNextCmdBuffer, pDevice),
     m_shRegs(static_cast<Platform*>(pDevice->GetPlatform())),
-    m_ctxRegs(static_cast<Platform*>(pDevice->GetPlatform()))
+    m_ctxRegs(static_cast<Platform*>(pDevice->GetPlatform())),
+    m_pipelines(static_cast<Platform*>(pDevice->GetPlatform()))
 {
     ResetStatistics();
 
@@ -73,6 +74,13 @@ void CmdBuffer::ResetStatistics()
 
     m_shRegBase  = 0;
     m_ctxRegBase = 0;
+
+    m_pipelines.Clear();
+
+    for (uint32 i = 0; i < static_cast<uint32>(PipelineBindPoint::Count); ++i)
+    {
+        m_boundPipelineIdx[i] = InvalidPipelineIdx;
+    }
 }
 
 // =====================================================================================================================
@@ -134,6 +142,8 @@ void CmdBuffer::PostDispatchCall(
         ++m_stats.internalEvent[Id].count;
         m_stats.internalEvent[Id].cmdSize += m_validationData.pipelineCmdSize;
     }
+
+    AccumulatePipelineStats(PipelineBindPoint::Compute);
 }
 
 // =====================================================================================================================
@@ -165,6 +175,25 @@ void CmdBuffer::PostDrawCall(
         ++m_stats.internalEvent[Id].count;
         m_stats.internalEvent[Id].cmdSize += m_validationData.pipelineCmdSize;
     }
+
+    AccumulatePipelineStats(PipelineBindPoint::Graphics);
+}
+
+// =====================================================================================================================
+// Charges the validation done by the last draw or dispatch to the pipeline bound to the given bind point.
+void CmdBuffer::AccumulatePipelineStats(
+    PipelineBindPoint bindPoint)
+{
+    const uint32 pipelineIdx = m_boundPipelineIdx[static_cast<uint32>(bindPoint)];
+
+    if (pipelineIdx != InvalidPipelineIdx)
+    {
+        PipelineStats& stats = m_pipelines.At(pipelineIdx);
+
+        ++stats.callCount;
+        stats.userDataCmdSize += m_validationData.userDataCmdSize;
+        stats.pipelineCmdSize += m_validationData.pipelineCmdSize;
+    }
 }
 
 // =====================================================================================================================
@@ -188,6 +217,7 @@ void CmdBuffer::UpdateOptimizedRegisters(
             RegisterInfo info;
             info.setPktTotal = data.pShRegSeenSets[i];
             info.setPktKept  = data.pShRegKeptSets[i];
+            info.rollCauses  = 0;
 
             m_shRegs.PushBack(info);
         }
@@ -202,6 +232,11 @@ void CmdBuffer::UpdateOptimizedRegisters(
             RegisterInfo info;
             info.setPktTotal = data.pCtxRegSeenSets[i];
             info.setPktKept  = data.pCtxRegKeptSets[i];
+#if PAL_CLIENT_INTERFACE_MAJOR_VERSION >= 642
+            info.rollCauses  = data.pCtxRegRollCauses[i];
+#else
+            info.rollCauses  = 0;
+#endif
 
             m_ctxRegs.PushBack(info);
         }
@@ -422,6 +457,39 @@ void CmdBuffer::CmdBindPipeline(
     PreCall();
     CmdBufferFwdDecorator::CmdBindPipeline(params);
     PostCall(CmdBufCallId::CmdBindPipeline);
+
+    uint32 pipelineIdx = InvalidPipelineIdx;
+
+    if (params.pPipeline != nullptr)
+    {
+        const uint64 hash = params.pPipeline->GetInfo().internalPipelineHash.stable;
+
+        // Command buffers tend to bind a small number of pipelines, so a linear search is good enough here.
+        for (uint32 i = 0; i < m_pipelines.NumElements(); ++i)
+        {
+            const PipelineStats& stats = m_pipelines.At(i);
+
+            if ((stats.hash == hash) && (stats.bindPoint == params.pipelineBindPoint))
+            {
+                pipelineIdx = i;
+                break;
+            }
+        }
+
+        if (pipelineIdx == InvalidPipelineIdx)
+        {
+            PipelineStats stats = {};
+            stats.hash      = hash;
+            stats.bindPoint = params.pipelineBindPoint;
+
+            if (m_pipelines.PushBack(stats) == Result::Success)
+            {
+                pipelineIdx = (m_pipelines.NumElements() - 1);
+            }
+        }
+    }
+
+    m_boundPipelineIdx[static_cast<uint32>(params.pipelineBindPoint)] = pipelineIdx;
 }
 
 // =====================================================================================================================
@@ -466,6 +466,8 @@ public:
     const RegisterInfoVector& ShRegs() const { return m_shRegs; }
     const RegisterInfoVector& CtxRegs() const { return m_ctxRegs; }
 
+    const PipelineStatsVector& Pipelines() const { return m_pipelines; }
+
     uint16 ShRegBase() const { return m_shRegBase; }
     uint16 CtxRegBase() const { return m_ctxRegBase; }
 
@@ -483,6 +485,8 @@ private:
     void PreDrawCall();
     void PostDrawCall(CmdBufCallId callId);
 
+    void AccumulatePipelineStats(PipelineBindPoint bindPoint);
+
     static void PAL_STDCALL CmdSetUserDataDecoratorCs(
         ICmdBuffer*   pCmdBuffer,
         uint32        firstEntry,
@@ -557,6 +561,12 @@ private:
     uint16  m_shRegBase;
     uint16  m_ctxRegBase;
 
+    PipelineStatsVector  m_pipelines;
+    // Index into m_pipelines of the pipeline currently bound to each bind point, or InvalidPipelineIdx.
+    uint32               m_boundPipelineIdx[static_cast<uint32>(PipelineBindPoint::Count)];
+
+    static constexpr uint32 InvalidPipelineIdx = UINT32_MAX;
+
     Developer::DrawDispatchValidationData  m_validationData;
 
     PAL_DISALLOW_DEFAULT_CTOR(CmdBuffer);
@@ -185,15 +185,26 @@ Result Device::CreateQueue(
 
         if (enableLayer)
         {
-            pQueue = PAL_PLACEMENT_NEW(pPlacementAddr) Queue(pNextQueue, this);
+            Queue*const pInstrumentedQueue = PAL_PLACEMENT_NEW(pPlacementAddr) Queue(pNextQueue, this);
+
+            result = pInstrumentedQueue->Init();
+            pQueue = pInstrumentedQueue;
         }
         else
         {
             pQueue = PAL_PLACEMENT_NEW(pPlacementAddr) QueueDecorator(pNextQueue, this);
         }
 
-        pNextQueue->SetClientData(pPlacementAddr);
-        (*ppQueue) = pQueue;
+        if (result == Result::Success)
+        {
+            pNextQueue->SetClientData(pPlacementAddr);
+            (*ppQueue) = pQueue;
+        }
+        else
+        {
+            // Tears down this layer's queue along with the next layer's queue.
+            pQueue->Destroy();
+        }
     }
 
     return result;
@@ -238,15 +249,26 @@ Result Device::CreateMultiQueue(
 
         if (enableLayer)
         {
-            pQueue = PAL_PLACEMENT_NEW(pPlacementAddr) Queue(pNextQueue, this);
+            Queue*const pInstrumentedQueue = PAL_PLACEMENT_NEW(pPlacementAddr) Queue(pNextQueue, this);
+
+            result = pInstrumentedQueue->Init();
+            pQueue = pInstrumentedQueue;
         }
         else
         {
             pQueue = PAL_PLACEMENT_NEW(pPlacementAddr) QueueDecorator(pNextQueue, this);
         }
 
-        pNextQueue->SetClientData(pPlacementAddr);
-        (*ppQueue) = pQueue;
+        if (result == Result::Success)
+        {
+            pNextQueue->SetClientData(pPlacementAddr);
+            (*ppQueue) = pQueue;
+        }
+        else
+        {
+            // Tears down this layer's queue along with the next layer's queue.
+            pQueue->Destroy();
+        }
     }
 
     return result;
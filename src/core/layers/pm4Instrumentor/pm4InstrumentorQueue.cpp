@@ -30,7 +30,9 @@
 #include "core/layers/pm4Instrumentor/pm4InstrumentorPlatform.h"
 #include "core/layers/pm4Instrumentor/pm4InstrumentorQueue.h"
 #include "palFile.h"
+#include "palHashMapImpl.h"
 #include "palInlineFuncs.h"
+#include "palJsonWriter.h"
 #include "palSysUtil.h"
 #include "palVectorImpl.h"
 
@@ -85,6 +87,43 @@ static const char* InternalEventIdToString(
     return StringTable[idx];
 }
 
+// =====================================================================================================================
+static const char* PipelineBindPointToString(
+    PipelineBindPoint value)
+{
+    const char*const StringTable[] =
+    {
+        "Compute",  // PipelineBindPoint::Compute
+        "Graphics", // PipelineBindPoint::Graphics
+    };
+
+    static_assert(ArrayLen(StringTable) == static_cast<uint32>(PipelineBindPoint::Count),
+                  "The PipelineBindPointToString string table needs to be updated.");
+
+    const uint32 idx = static_cast<uint32>(value);
+    PAL_ASSERT(idx < static_cast<uint32>(PipelineBindPoint::Count));
+
+    return StringTable[idx];
+}
+
+// =====================================================================================================================
+// JSON stream which writes its text straight into an open file.
+class FileJsonStream : public JsonStream
+{
+public:
+    explicit FileJsonStream(File* pFile) : m_pFile(pFile) { }
+    virtual ~FileJsonStream() { }
+
+    virtual void WriteString(const char* pString, uint32 length) override { m_pFile->Write(pString, length); }
+    virtual void WriteCharacter(char character) override { m_pFile->Write(&character, sizeof(character)); }
+
+private:
+    File*const m_pFile;
+
+    PAL_DISALLOW_DEFAULT_CTOR(FileJsonStream);
+    PAL_DISALLOW_COPY_AND_ASSIGN(FileJsonStream);
+};
+
 // =====================================================================================================================
 Queue::Queue(
     IQueue* pNextQueue,
@@ -97,6 +136,7 @@ Queue::Queue(
     m_ctxRegs(static_cast<Platform*>(pDevice->GetPlatform())),
     m_shRegBase(0),
     m_ctxRegBase(0),
+    m_pipelineStats(64, static_cast<Platform*>(pDevice->GetPlatform())),
     m_dumpMode(Pm4InstrumentorDumpQueueDestroy),
     m_dumpInterval(0),
     m_lastCpuPerfCounter(0)
@@ -121,6 +161,12 @@ Queue::Queue(
         &settings.pm4InstrumentorConfig.filenameSuffix[0]);
 }
 
+// =====================================================================================================================
+Result Queue::Init()
+{
+    return m_pipelineStats.Init();
+}
+
 // =====================================================================================================================
 Queue::~Queue()
 {
@@ -177,6 +223,7 @@ static void AccumulateRegisterInfo(
             {
                 pAccum->At(i).setPktTotal += source.At(i).setPktTotal;
                 pAccum->At(i).setPktKept  += source.At(i).setPktKept;
+                pAccum->At(i).rollCauses  += source.At(i).rollCauses;
             }
         }
     }
@@ -214,6 +261,32 @@ void Queue::AccumulateStatistics(
 
         m_shRegBase  = pCmdBuf->ShRegBase();
         m_ctxRegBase = pCmdBuf->CtxRegBase();
+
+        const PipelineStatsVector& pipelines = pCmdBuf->Pipelines();
+        for (uint32 j = 0; j < pipelines.NumElements(); ++j)
+        {
+            const PipelineStats& source = pipelines.At(j);
+
+            PipelineStatsKey key = {};
+            key.hash             = source.hash;
+            key.bindPoint        = source.bindPoint;
+
+            bool           existed = false;
+            PipelineStats* pAccum  = nullptr;
+            if (m_pipelineStats.FindAllocate(key, &existed, &pAccum) == Result::Success)
+            {
+                if (existed)
+                {
+                    pAccum->callCount       += source.callCount;
+                    pAccum->userDataCmdSize += source.userDataCmdSize;
+                    pAccum->pipelineCmdSize += source.pipelineCmdSize;
+                }
+                else
+                {
+                    (*pAccum) = source;
+                }
+            }
+        }
     }
 
     m_cmdBufCount += count;
@@ -296,6 +369,93 @@ void Queue::DumpStatistics()
             PrintRegisterStats(logFile, m_ctxRegs, m_ctxRegBase);
         }
     } // If log file was opened
+
+    DumpJsonStatistics();
+}
+
+// Context roll causes are only reported to clients which know about OptimizedRegistersData::pCtxRegRollCauses.
+constexpr bool HasCtxRegRollCauses = (PAL_CLIENT_INTERFACE_MAJOR_VERSION >= 642);
+
+// =====================================================================================================================
+// Helper function to write optimized register statistics as a list of JSON maps.
+static void WriteRegisterStats(
+    JsonWriter*               pWriter,
+    const char*               pKey,
+    const RegisterInfoVector& stats,
+    uint16                    registerBase,
+    bool                      hasRollCauses)
+{
+    pWriter->KeyAndBeginList(pKey, false);
+
+    for (auto i = stats.Begin(); i.IsValid(); i.Next())
+    {
+        const RegisterInfo& info = i.Get();
+
+        if (info.setPktTotal > 0)
+        {
+            const uint32 redundant = (info.setPktTotal - info.setPktKept);
+
+            pWriter->BeginMap(true);
+            pWriter->KeyAndValue("addr",           static_cast<uint32>(i.Position() + registerBase));
+            pWriter->KeyAndValue("total",          info.setPktTotal);
+            pWriter->KeyAndValue("kept",           info.setPktKept);
+            pWriter->KeyAndValue("redundantRatio", static_cast<float>(redundant) / info.setPktTotal);
+            if (hasRollCauses)
+            {
+                pWriter->KeyAndValue("rollCauses", info.rollCauses);
+            }
+            pWriter->EndMap();
+        }
+    }
+
+    pWriter->EndList();
+}
+
+// =====================================================================================================================
+// Dumps the register heatmap and per-pipeline validation statistics to a JSON file next to the .csv log. The format is
+// described in tools/pm4InstrumentorTools/hotRegisterReport.py, which can be used to view it.
+void Queue::DumpJsonStatistics() const
+{
+    char fileName[sizeof(m_fileName) + 8];
+    Snprintf(&fileName[0], sizeof(fileName), "%s.json", &m_fileName[0]);
+
+    File jsonFile;
+    if (jsonFile.Open(&fileName[0], FileAccessWrite) == Result::Success)
+    {
+        FileJsonStream stream(&jsonFile);
+        JsonWriter     writer(&stream);
+
+        constexpr uint32 FormatVersion = 1;
+
+        writer.BeginMap(false);
+        writer.KeyAndValue("version",     FormatVersion);
+        writer.KeyAndValue("queueType",   QueueTypeToString(m_pNextLayer->Type()));
+        writer.KeyAndValue("frames",      static_cast<Platform*>(m_pDevice->GetPlatform())->FrameCount());
+        writer.KeyAndValue("cmdBufCount", m_cmdBufCount);
+
+        WriteRegisterStats(&writer, "shRegisters",  m_shRegs,  m_shRegBase,  false);
+        WriteRegisterStats(&writer, "ctxRegisters", m_ctxRegs, m_ctxRegBase, HasCtxRegRollCauses);
+
+        writer.KeyAndBeginList("pipelines", false);
+        for (auto iter = m_pipelineStats.Begin(); iter.Get() != nullptr; iter.Next())
+        {
+            const PipelineStats& stats = iter.Get()->value;
+
+            char hashString[20];
+            Snprintf(&hashString[0], sizeof(hashString), "0x%016llx", stats.hash);
+
+            writer.BeginMap(true);
+            writer.KeyAndValue("hash",          &hashString[0]);
+            writer.KeyAndValue("bindPoint",     PipelineBindPointToString(stats.bindPoint));
+            writer.KeyAndValue("calls",         stats.callCount);
+            writer.KeyAndValue("userDataBytes", stats.userDataCmdSize);
+            writer.KeyAndValue("pipelineBytes", stats.pipelineCmdSize);
+            writer.EndMap();
+        }
+        writer.EndList();
+
+        writer.EndMap();
+    }
 }
 
 } // Pm4Instrumentor
@@ -30,6 +30,7 @@
 #include "core/g_palPlatformSettings.h"
 #include "core/layers/decorators.h"
 #include "core/layers/functionIds.h"
+#include "palHashMap.h"
 #include "palVector.h"
 
 namespace Pal
@@ -85,10 +86,34 @@ struct RegisterInfo
 {
     uint32  setPktTotal;    // Total number of SET and RMW packets seen for this register.
     uint32  setPktKept;     // Number of SET and RMW packets kept (after redundancy checking) for this register.
+    uint32  rollCauses;     // Number of context rolls caused by this register.  Always zero for SH registers.
 };
 
 typedef Util::Vector<RegisterInfo, 1u, Platform>  RegisterInfoVector;
 
+// Validation statistics for the draws or dispatches issued while a single pipeline was bound.  The user-data validation
+// consists almost entirely of SH register writes, so it shows how much SH register churn each pipeline causes.
+struct PipelineStats
+{
+    uint64             hash;            // Stable 64 bits of the pipeline's internal hash.
+    PipelineBindPoint  bindPoint;
+    uint32             callCount;       // Number of draws or dispatches issued with this pipeline bound.
+    gpusize            userDataCmdSize; // Size of the user-data validation PM4 written for those calls (bytes).
+    gpusize            pipelineCmdSize; // Size of the pipeline validation PM4 written for those calls (bytes).
+};
+
+// Identifies the statistics of one pipeline.  Like the command buffers, the queue keeps a pipeline bound to different
+// bind points apart.  The key is hashed and compared bytewise, so it has no implicit padding.
+struct PipelineStatsKey
+{
+    uint64             hash;
+    PipelineBindPoint  bindPoint;
+    uint32             reserved;  // Always zero.
+};
+
+typedef Util::Vector<PipelineStats, 16u, Platform>                                       PipelineStatsVector;
+typedef Util::HashMap<PipelineStatsKey, PipelineStats, Platform, Util::JenkinsHashFunc>  PipelineStatsMap;
+
 // =====================================================================================================================
 // Pm4Instrumentor layer implementation of IQueue.  Accumulates stats from each submitted command buffer and dumps them
 // to a log file.
@@ -98,6 +123,8 @@ public:
     Queue(IQueue*  pNextQueue,
           Device*  pDevice);
 
+    Result Init();
+
     virtual Result Submit(
         const MultiSubmitInfo& submitInfo) override;
 
@@ -108,6 +135,7 @@ private:
         const ICmdBuffer*const* ppCmdBuffers,
         uint32                  count);
     void DumpStatistics();
+    void DumpJsonStatistics() const;
 
     Device*const  m_pDevice;
 
@@ -120,6 +148,8 @@ private:
     uint16  m_shRegBase;
     uint16  m_ctxRegBase;
 
+    PipelineStatsMap  m_pipelineStats; // Keyed by pipeline hash and bind point, accumulated over the queue's lifetime.
+
     Pm4InstrumentorDumpMode  m_dumpMode;
     int64                    m_dumpInterval;
     int64                    m_lastCpuPerfCounter;
@@ -27,6 +27,7 @@
 #include "core/masterQueueSemaphore.h"
 #include "core/platform.h"
 #include "core/queue.h"
+#include "core/queueSemaphoreWaitService.h"
 #include "palDequeImpl.h"
 
 using namespace Util;
@@ -42,19 +43,20 @@ MasterQueueSemaphore::MasterQueueSemaphore(
     m_blockedQueues(pDevice->GetPlatform()),
     m_signalCount(0),
     m_waitCount(0),
-    m_waitThreadEnd(false)
+    m_waitServiceRegistered(false)
 {
 }
 
 // =====================================================================================================================
 MasterQueueSemaphore::~MasterQueueSemaphore()
 {
-    if (m_waitThread.IsCreated())
+    m_queuesLock.Lock();
+    const bool registered = m_waitServiceRegistered;
+    m_queuesLock.Unlock();
+
+    if (registered)
     {
-        m_waitThreadEnd = true;
-        m_threadNotify.Post();
-        PAL_ASSERT(m_waitThread.IsNotCurrentThread());
-        m_waitThread.Join();
+        m_pDevice->GetQueueSemaphoreWaitService()->Unregister(this);
     }
 }
 
@@ -295,36 +297,6 @@ Result MasterQueueSemaphore::SignalSemaphoreValueInternal(
     return SignalHelper(nullptr, pSemaphore, value, false);
 }
 
-// =====================================================================================================================
-// Executes the background thread used to schedule queued jobs
-void MasterQueueSemaphore::RunWaitThread()
-{
-    while (true)
-    {
-        Result result = Result::Success;
-
-        if (result == Result::Success)
-        {
-            result = ThreadReleaseBlockedQueues();
-            PAL_ASSERT(result == Result::Success);
-        }
-        if (m_waitThreadEnd)
-        {
-            m_waitThread.End();
-        }
-    }
-
-    PAL_NEVER_CALLED(); // This area should be unreachable.
-}
-
-// =====================================================================================================================
-// Callback for executing wait thread.
-static void WaitThreadCallback(
-    void* pParameter)   // Opaque pointer to a MasterQueueSemaphore
-{
-    static_cast<MasterQueueSemaphore*>(pParameter)->RunWaitThread();
-}
-
 // =====================================================================================================================
 // Waits on the specified Semaphore object associated with this Semaphore from the specified Queue. Potentially, this
 // could cause the Queue to become blocked if the corresponding Signal hasn't been seen yet.
@@ -385,20 +357,12 @@ Result MasterQueueSemaphore::WaitInternal(
                 // separate Semaphores from multiple threads simultaneously.
                 PAL_ASSERT(pQueue->WaitingSemaphore() == nullptr);
                 pQueue->SetWaitingSemaphore(this);
-                if (blockedOnThread)
+                if (blockedOnThread && (m_waitServiceRegistered == false))
                 {
-                    if (m_waitThread.IsCreated() == false)
-                    {
-                        result = m_threadNotify.Init(Semaphore::MaximumCountLimit, 0);
-                        if (result == Result::Success)
-                        {
-                            result = m_waitThread.Begin(&WaitThreadCallback, this);
-                        }
-                    }
-                    if (result == Result::Success)
-                    {
-                        m_threadNotify.Post();
-                    }
+                    // Only the OS knows when an external signal arrives, so hand this semaphore to the device's wait
+                    // service which will release the Queue once the signal has been submitted.
+                    result = m_pDevice->GetQueueSemaphoreWaitService()->Register(this);
+                    m_waitServiceRegistered = (result == Result::Success);
                 }
             }
         }
@@ -442,39 +406,34 @@ Result MasterQueueSemaphore::AddBlockedQueue(
 }
 
 // =====================================================================================================================
-// Releases all Queues currently blocked by this Semaphore because it was just signaled.
-// This is only called by waitThread.
-Result MasterQueueSemaphore::ThreadReleaseBlockedQueues()
+// Releases all Queues currently blocked by this Semaphore whose signals have been submitted to the OS. This is only
+// called by the device's QueueSemaphoreWaitService. If some Queues are still blocked, pNextValue receives the next
+// timeline point the service should wait for; otherwise this semaphore is no longer registered with the service.
+Result MasterQueueSemaphore::ServiceReleaseBlockedQueues(
+    uint64* pNextValue,
+    bool*   pHasBlockedQueues)
 {
-    Result result = Result::Success;
-
     PAL_ASSERT(IsTimeline() && ExternalThreadsCanSignal());
+    PAL_ASSERT((pNextValue != nullptr) && (pHasBlockedQueues != nullptr));
 
-    uint64 lastPoint    = 0;
-    size_t numToRelease = 0;
+    uint64 lastPoint = 0;
 
-    result = OsQuerySemaphoreLastValue(&lastPoint);
+    Result result = OsQuerySemaphoreLastValue(&lastPoint);
     if (result == Result::Success)
     {
-        result = TimelineReleaseBlockedQueues(lastPoint, &numToRelease);
+        result = TimelineReleaseBlockedQueues(lastPoint, nullptr);
     }
 
-    if (result == Result::Success)
+    // More waits may have been added since the release above dropped the lock, so decide whether we stay registered
+    // under the same lock that WaitInternal() uses to register us.
+    MutexAuto lock(&m_queuesLock);
+
+    (*pHasBlockedQueues) = (m_blockedQueues.NumElements() > 0);
+    (*pNextValue)        = lastPoint + 1;
+
+    if ((*pHasBlockedQueues) == false)
     {
-        if (numToRelease > 0)
-        {
-            uint64 nextLast = lastPoint + 1;
-            // wait for nextLast in waitThread to catch a signal event from kernel.
-            result = WaitSemaphoreValueAvailable(nextLast, UINT64_MAX);
-        }
-        else
-        {
-            if (m_waitThreadEnd == false)
-            {
-                //if m_blockedQueues is empty, we wait on Util::Semaphore wait.
-                result = m_threadNotify.Wait(UINT32_MAX);
-            }
-        }
+        m_waitServiceRegistered = false;
     }
 
     return result;
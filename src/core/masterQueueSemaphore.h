@@ -28,8 +28,6 @@
 #include "core/queueSemaphore.h"
 #include "palDeque.h"
 #include "palMutex.h"
-#include "palSemaphore.h"
-#include "palThread.h"
 
 namespace Pal
 {
@@ -88,14 +86,16 @@ public:
 
     Result EarlySignal();
 
-    void RunWaitThread();
+    // Called by the device's QueueSemaphoreWaitService to release the Queues blocked on this semaphore.
+    Result ServiceReleaseBlockedQueues(
+        uint64* pNextValue,
+        bool*   pHasBlockedQueues);
 
 private:
     Result AddBlockedQueue(
         Queue*          pQueue,
         QueueSemaphore* pSemaphore,
         uint64          value);
-    Result ThreadReleaseBlockedQueues();
 
     Result SignalHelper(
         Queue*          pQueue,
@@ -129,9 +129,8 @@ private:
     uint64  m_signalCount;
     uint64  m_waitCount;
 
-    Util::Semaphore m_threadNotify;         // Notify wait thread to consume semaphore wait.
-    Util::Thread    m_waitThread;           // The wait thread that executes semaphore wait.
-    volatile bool   m_waitThreadEnd;        // Send signal to thread to end thread
+    // Set while this semaphore is registered with the device's QueueSemaphoreWaitService. Protected by m_queuesLock.
+    bool  m_waitServiceRegistered;
 
     PAL_DISALLOW_DEFAULT_CTOR(MasterQueueSemaphore);
     PAL_DISALLOW_COPY_AND_ASSIGN(MasterQueueSemaphore);
@@ -58,6 +58,7 @@
 #include <climits>
 #include <inttypes.h>
 #include <math.h>
+#include <sched.h>
 #include <string.h>
 #include <stdlib.h>
 #include <sys/utsname.h>
@@ -70,6 +71,12 @@ namespace Pal
 namespace Amdgpu
 {
 
+// Bounds of the adaptive window during which fence waits poll before blocking in the kernel. Waits on short GPU
+// intervals often finish sooner than a sleep and wakeup in the kernel would take.
+static constexpr uint64 MinFenceSpinWindowNs     = 2000;
+static constexpr uint64 InitialFenceSpinWindowNs = 50000;
+static constexpr uint64 MaxFenceSpinWindowNs     = 200000;
+
 // =====================================================================================================================
 // Helper method which check result from drm function
 static PAL_INLINE Result CheckResult(
@@ -412,6 +419,7 @@ Device::Device(
     m_drmMajorVer(constructorParams.drmMajorVer),
     m_drmMinorVer(constructorParams.drmMinorVer),
     m_useDedicatedVmid(false),
+    m_fenceSpinWindowNs(InitialFenceSpinWindowNs),
     m_pSettingsPath(constructorParams.pSettingsPath),
     m_pSvmMgr(nullptr),
     m_mapAllocator(),
@@ -682,7 +690,17 @@ Result Device::EarlyInit(
             }
         }
 
-        if (result == Result::ErrorUnavailable)
+        if (result == Result::Success)
+        {
+            // AMD_CONFIG_WATCH opts in to polling the settings file every given number of milliseconds so changes to
+            // runtime-safe settings take effect without recreating the device.
+            const char* pWatchInterval = getenv("AMD_CONFIG_WATCH");
+            if (pWatchInterval != nullptr)
+            {
+                m_settingsWatchInterval = static_cast<uint32>(strtoul(pWatchInterval, nullptr, 0));
+            }
+        }
+        else if (result == Result::ErrorUnavailable)
         {
             // Unavailable means that the file was not found, which is an acceptable failure.
             PAL_DPINFO("No settings file loaded.");
@@ -2811,13 +2829,67 @@ Result Device::QueryFenceStatus(
 }
 
 // =====================================================================================================================
-// Call amdgpu to wait for multiple fences
+// Adjusts the fence spin window after a wait. Waits which were satisfied while polling widen the window to twice the
+// time they took, so that slightly longer intervals are still caught. Waits which had to block halve it, which keeps the
+// CPU cost of polling low when the device mostly sees long intervals.
+void Device::UpdateFenceSpinWindow(
+    bool   spinSucceeded,
+    uint64 spinTimeNs
+    ) const
+{
+    const uint64 windowNs = AtomicReadRelaxed64(&m_fenceSpinWindowNs);
+    const uint64 newNs    = spinSucceeded ? Min(MaxFenceSpinWindowNs, Max(windowNs, 2 * spinTimeNs))
+                                          : Max(MinFenceSpinWindowNs, windowNs / 2);
+
+    AtomicWriteRelaxed64(&m_fenceSpinWindowNs, newNs);
+}
+
+// =====================================================================================================================
+// Waits for multiple fences. All fences are handed to the kernel together, so the set costs one call per poll or wait.
+// Before blocking, the fences are polled for the adaptive spin window because the syscall and wakeup latency of a
+// blocking wait dominates when the GPU work is short.
 Result Device::WaitForFences(
     amdgpu_cs_fence* pFences,
     uint32           fenceCount,
     bool             waitAll,
     uint64           timeout
     ) const
+{
+    Result result = Result::Timeout;
+
+    if (timeout > 0)
+    {
+        const int64  startNs  = ComputeAbsTimeout(0);
+        const uint64 windowNs = Min(timeout, AtomicReadRelaxed64(&m_fenceSpinWindowNs));
+        uint64       spinNs   = 0;
+
+        do
+        {
+            result = QueryFences(pFences, fenceCount, waitAll, 0);
+            spinNs = static_cast<uint64>(ComputeAbsTimeout(0) - startNs);
+        } while ((result == Result::Timeout) && (spinNs < windowNs) && (sched_yield() == 0));
+
+        UpdateFenceSpinWindow((result != Result::Timeout), spinNs);
+
+        timeout -= Min(timeout, spinNs);
+    }
+
+    if (result == Result::Timeout)
+    {
+        result = QueryFences(pFences, fenceCount, waitAll, timeout);
+    }
+
+    return result;
+}
+
+// =====================================================================================================================
+// Call amdgpu to wait for multiple fences
+Result Device::QueryFences(
+    amdgpu_cs_fence* pFences,
+    uint32           fenceCount,
+    bool             waitAll,
+    uint64           timeout
+    ) const
 {
     Result result = Result::Success;
     uint32 status = 0;
@@ -2926,7 +2998,55 @@ Result Device::WaitForSemaphores(
 }
 
 // =====================================================================================================================
-// Call amdgpu to wait for multiple fences (fence based on Sync Object)
+// Call amdgpu to wait until a signal has been submitted for any of the given timeline semaphore points.
+Result Device::WaitForSemaphoresAvailable(
+    uint32                            semaphoreCount,
+    const Pal::QueueSemaphore*const*  ppSemaphores,
+    const uint64*                     pValues,
+    uint64                            timeoutNs) const
+{
+    PAL_ASSERT((semaphoreCount > 0) && (ppSemaphores != nullptr) && (pValues != nullptr));
+
+    Result result = Result::Success;
+
+    AutoBuffer<uint32, 16, Pal::Platform> hSyncobjs(semaphoreCount, GetPlatform());
+    AutoBuffer<uint64, 16, Pal::Platform> points(semaphoreCount, GetPlatform());
+
+    if (m_drmProcs.pfnAmdgpuCsSyncobjTimelineWaitisValid() == false)
+    {
+        result = Result::Unsupported;
+    }
+    else if ((hSyncobjs.Capacity() < semaphoreCount) || (points.Capacity() < semaphoreCount))
+    {
+        result = Result::ErrorOutOfMemory;
+    }
+    else
+    {
+        for (uint32 i = 0; i < semaphoreCount; i++)
+        {
+            hSyncobjs[i] = static_cast<uint32>(reinterpret_cast<uintptr_t>(ppSemaphores[i]->GetSyncObjHandle()));
+            points[i]    = pValues[i];
+        }
+
+        // Without DRM_SYNCOBJ_WAIT_FLAGS_WAIT_ALL the kernel returns as soon as any point becomes available.
+        constexpr uint32 WaitFlags = DRM_SYNCOBJ_WAIT_FLAGS_WAIT_AVAILABLE | DRM_SYNCOBJ_WAIT_FLAGS_WAIT_FOR_SUBMIT;
+
+        const int32 ret = m_drmProcs.pfnAmdgpuCsSyncobjTimelineWait(m_hDevice,
+                                                                    &hSyncobjs[0],
+                                                                    &points[0],
+                                                                    semaphoreCount,
+                                                                    ComputeAbsTimeout(timeoutNs),
+                                                                    WaitFlags,
+                                                                    nullptr);
+        result = CheckResult(ret, Result::ErrorUnknown);
+    }
+
+    return result;
+}
+
+// =====================================================================================================================
+// Waits for multiple fences based on Sync Objects; the timeout is absolute. Like WaitForFences(), the fences are polled
+// for the adaptive spin window before the blocking wait.
 Result Device::WaitForSyncobjFences(
     uint32*              pFences,
     uint32               fenceCount,
@@ -2934,6 +3054,42 @@ Result Device::WaitForSyncobjFences(
     uint32               flags,
     uint32*              pFirstSignaled
     ) const
+{
+    Result      result  = Result::Timeout;
+    const int64 startNs = ComputeAbsTimeout(0);
+
+    if (static_cast<int64>(timeout) > startNs)
+    {
+        const uint64 windowNs = Min(timeout - startNs, AtomicReadRelaxed64(&m_fenceSpinWindowNs));
+        uint64       spinNs   = 0;
+
+        do
+        {
+            // An absolute timeout of zero is always in the past, which turns the wait into a poll.
+            result = QuerySyncobjFences(pFences, fenceCount, 0, flags, pFirstSignaled);
+            spinNs = static_cast<uint64>(ComputeAbsTimeout(0) - startNs);
+        } while ((result == Result::Timeout) && (spinNs < windowNs) && (sched_yield() == 0));
+
+        UpdateFenceSpinWindow((result != Result::Timeout), spinNs);
+    }
+
+    if (result == Result::Timeout)
+    {
+        result = QuerySyncobjFences(pFences, fenceCount, timeout, flags, pFirstSignaled);
+    }
+
+    return result;
+}
+
+// =====================================================================================================================
+// Call amdgpu to wait for multiple fences (fence based on Sync Object)
+Result Device::QuerySyncobjFences(
+    uint32*              pFences,
+    uint32               fenceCount,
+    uint64               timeout,
+    uint32               flags,
+    uint32*              pFirstSignaled
+    ) const
 {
     Result result = Result::Success;
 
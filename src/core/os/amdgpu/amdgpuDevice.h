@@ -518,6 +518,12 @@ public:
         uint32                       flags,
         uint64                       timeout) const override;
 
+    virtual Result WaitForSemaphoresAvailable(
+        uint32                            semaphoreCount,
+        const Pal::QueueSemaphore*const*  ppSemaphores,
+        const uint64*                     pValues,
+        uint64                            timeoutNs) const override;
+
     Result QueryFenceStatus(
         struct amdgpu_cs_fence* pFence,
         uint64                  timeoutNs) const;
@@ -900,6 +906,21 @@ private:
         amdgpu_bo_handle        hBuffer,
         amdgpu_va_handle        hVaRange);
 
+    Result QueryFences(
+        amdgpu_cs_fence* pFences,
+        uint32           fenceCount,
+        bool             waitAll,
+        uint64           timeout) const;
+
+    Result QuerySyncobjFences(
+        uint32*              pFences,
+        uint32               fenceCount,
+        uint64               timeout,
+        uint32               flags,
+        uint32*              pFirstSignaled) const;
+
+    void UpdateFenceSpinWindow(bool spinSucceeded, uint64 spinTimeNs) const;
+
     int32                 m_fileDescriptor;         // File descriptor used for communicating with the kernel driver
     int32                 m_primaryFileDescriptor;  // primary node file descriptor used for display subsystem.
     amdgpu_device_handle  m_hDevice;                // Device handle of the amdgpu
@@ -919,6 +940,10 @@ private:
     bool  m_useDedicatedVmid;         // Indicate if use per-process VMID.
     bool  m_supportExternalSemaphore; // Indicate if external semaphore is supported.
 
+    // How long fence waits poll before blocking in the kernel, in nanoseconds. It adapts to the waits this device sees
+    // and may be updated by several waiting threads at once; a lost update only costs a slightly stale window.
+    mutable volatile uint64 m_fenceSpinWindowNs;
+
     const char*  m_pSettingsPath;
 
     SvmMgr* m_pSvmMgr;
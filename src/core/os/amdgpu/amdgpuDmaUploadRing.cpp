@@ -43,9 +43,9 @@ DmaUploadRing::DmaUploadRing(Device* pDevice)
 }
 
 // =====================================================================================================================
-Result DmaUploadRing::WaitForPendingUpload(
+Result DmaUploadRing::WaitForTimestamp(
     Pal::Queue* pWaiter,
-    UploadFenceToken fenceValue)
+    uint64      timestamp)
 {
     Result      result = Result::Success;
     SubmissionContext* pContext = static_cast<SubmissionContext*>(m_pDmaQueue->GetSubmissionContext());
@@ -55,7 +55,7 @@ Result DmaUploadRing::WaitForPendingUpload(
     struct amdgpu_cs_fence queryFence = {};
 
     queryFence.context     = pContext->Handle();
-    queryFence.fence       = fenceValue;
+    queryFence.fence       = timestamp;
     queryFence.ring        = pContext->EngineId();
     queryFence.ip_instance = 0;
     queryFence.ip_type     = pContext->IpType();
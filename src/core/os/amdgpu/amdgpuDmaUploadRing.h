@@ -39,9 +39,10 @@ class DmaUploadRing : public Pal::DmaUploadRing
 public:
     explicit DmaUploadRing(Device* pDevice);
     virtual ~DmaUploadRing() {};
-    virtual Result WaitForPendingUpload(
+protected:
+    virtual Result WaitForTimestamp(
         Pal::Queue* pWaiter,
-        UploadFenceToken fenceValue);
+        uint64      timestamp);
 private:
     PAL_DISALLOW_DEFAULT_CTOR(DmaUploadRing);
     PAL_DISALLOW_COPY_AND_ASSIGN(DmaUploadRing);
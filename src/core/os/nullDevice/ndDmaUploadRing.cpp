@@ -39,9 +39,9 @@ DmaUploadRing::DmaUploadRing(Device* pDevice)
 
 }
 
-Result DmaUploadRing::WaitForPendingUpload(
+Result DmaUploadRing::WaitForTimestamp(
     Pal::Queue* pWaiter,
-    UploadFenceToken fenceValue)
+    uint64      timestamp)
 {
     return Result::Success;
 }
@@ -28,6 +28,7 @@
 #include "core/queue.h"
 #include "core/swapChain.h"
 #include "palIntrusiveListImpl.h"
+#include "palSysUtil.h"
 using namespace Util;
 
 namespace Pal
@@ -95,6 +96,7 @@ PresentSchedulerJob::PresentSchedulerJob()
     m_type(PresentJobType::Terminate)
 {
     memset(&m_presentInfo, 0, sizeof(m_presentInfo));
+    memset(&m_timing, 0, sizeof(m_timing));
 }
 
 // =====================================================================================================================
@@ -115,8 +117,15 @@ PresentScheduler::PresentScheduler(
     :
     m_pDevice(pDevice),
     m_pSignalQueue(nullptr),
-    m_workerActive(false)
+    m_workerActive(false),
+    m_perfFrequency(static_cast<uint64>(GetPerfFrequency())),
+    m_presentCount(0),
+    m_lastPacedTime(0),
+    m_numTimingRecords(0),
+    m_firstUnreadRecord(0)
 {
+    memset(&m_timingStats, 0, sizeof(m_timingStats));
+
     for (uint32 deviceIndex = 0; deviceIndex < XdmaMaxDevices; deviceIndex++)
     {
         m_pPresentQueues[deviceIndex] = nullptr;
@@ -198,6 +207,11 @@ Result PresentScheduler::Init(
         result = m_workerThreadNotify.Init(Semaphore::MaximumCountLimit, 0);
     }
 
+    if (result == Result::Success)
+    {
+        result = m_timingMutex.Init();
+    }
+
     return result;
 }
 
@@ -260,6 +274,18 @@ static void WorkerThreadCallback(
     static_cast<PresentScheduler*>(pParameter)->RunWorkerThread();
 }
 
+// =====================================================================================================================
+// Presents can only be paced by clients which know about PresentSwapChainInfo::flags::paced.
+static bool IsPacedPresent(
+    const PresentSwapChainInfo& presentInfo)
+{
+#if PAL_CLIENT_INTERFACE_MAJOR_VERSION >= 642
+    return (presentInfo.flags.paced != 0);
+#else
+    return false;
+#endif
+}
+
 // =====================================================================================================================
 Result PresentScheduler::PreparePresent(
     IQueue*              pQueue,
@@ -301,10 +327,25 @@ Result PresentScheduler::Present(
 {
     Result result = Result::Success;
 
-    // Check if we can immediately process a present on the current thread and queue.
-    if (CanInlinePresent(presentInfo, *pQueue))
+    PresentTimingRecord timing = {};
+    timing.presentId     = AtomicIncrement64(&m_presentCount);
+    timing.imageIndex    = presentInfo.imageIndex;
+    timing.flags.paced   = IsPacedPresent(presentInfo);
+    timing.requestedTime = static_cast<uint64>(GetPerfCpuTime());
+
+    // Check if we can immediately process a present on the current thread and queue. Paced presents may have to wait
+    // so they always go through the worker thread.
+    if ((timing.flags.paced == 0) && CanInlinePresent(presentInfo, *pQueue))
     {
+        timing.flags.inlined = 1;
+        timing.dequeuedTime  = timing.requestedTime;
+        timing.submittedTime = timing.requestedTime;
+
         result = ProcessPresent(presentInfo, pQueue, true);
+
+        timing.flags.dropped = (result != Result::Success);
+        timing.completedTime = static_cast<uint64>(GetPerfCpuTime());
+        RecordTiming(timing);
     }
     else
     {
@@ -328,6 +369,7 @@ Result PresentScheduler::Present(
         {
             pJob->SetType(PresentJobType::Present);
             pJob->SetPresentInfo(presentInfo);
+            pJob->SetTiming(timing);
         }
 
         if (result == Result::Success)
@@ -373,6 +415,12 @@ Result PresentScheduler::Present(
             // If we failed to queue the job we must clean up some state to prevent the swap chain from deadlocking.
             const Result cleanupResult = FailedToQueuePresentJob(presentInfo, pQueue);
             result = CollapseResults(result, cleanupResult);
+
+            timing.flags.dropped = 1;
+            timing.dequeuedTime  = static_cast<uint64>(GetPerfCpuTime());
+            timing.submittedTime = timing.dequeuedTime;
+            timing.completedTime = timing.dequeuedTime;
+            RecordTiming(timing);
         }
     }
 
@@ -416,6 +464,130 @@ Result PresentScheduler::WaitIdle()
     return result;
 }
 
+// =====================================================================================================================
+// Returns the oldest present timing records which the client hasn't retrieved yet and/or the lifetime statistics.
+Result PresentScheduler::GetPresentTimings(
+    uint32*              pNumRecords,
+    PresentTimingRecord* pRecords,
+    PresentTimingStats*  pStats)
+{
+    Result result = Result::Success;
+
+    if (pNumRecords == nullptr)
+    {
+        result = Result::ErrorInvalidPointer;
+    }
+    else
+    {
+        MutexAuto lock(&m_timingMutex);
+
+        const uint32 numAvailable = static_cast<uint32>(m_numTimingRecords - m_firstUnreadRecord);
+
+        if (pRecords == nullptr)
+        {
+            *pNumRecords = numAvailable;
+        }
+        else
+        {
+            const uint32 numRecords = Min(*pNumRecords, numAvailable);
+
+            for (uint32 idx = 0; idx < numRecords; ++idx)
+            {
+                pRecords[idx] = m_timingRecords[(m_firstUnreadRecord + idx) % ISwapChain::MaxPresentTimingRecords];
+            }
+
+            m_firstUnreadRecord += numRecords;
+            *pNumRecords         = numRecords;
+        }
+
+        if (pStats != nullptr)
+        {
+            *pStats = m_timingStats;
+        }
+    }
+
+    return result;
+}
+
+// =====================================================================================================================
+// A paced present is queued at its target time, but no sooner than its interval after the previous paced present.
+uint64 PresentScheduler::ComputePresentTime(
+    const PresentSwapChainInfo& presentInfo,
+    uint64                      lastPresentTime)
+{
+    uint64 presentTime = 0;
+
+#if PAL_CLIENT_INTERFACE_MAJOR_VERSION >= 642
+    presentTime = presentInfo.targetPresentTime;
+
+    if ((presentInfo.presentInterval != 0) && (lastPresentTime != 0))
+    {
+        presentTime = Max(presentTime, lastPresentTime + presentInfo.presentInterval);
+    }
+#endif
+
+    return presentTime;
+}
+
+// =====================================================================================================================
+// Blocks the calling thread until the given GetPerfCpuTime() time. The wait is capped at one second so that a bogus
+// target can't stall the swap chain indefinitely.
+void PresentScheduler::WaitUntil(
+    uint64 targetTime
+    ) const
+{
+    const uint64 startTime  = static_cast<uint64>(GetPerfCpuTime());
+    const uint64 endTime    = Min(targetTime, startTime + m_perfFrequency);
+    const uint64 ticksPerMs = Max<uint64>(m_perfFrequency / 1000, 1);
+
+    for (uint64 now = startTime; now < endTime; now = static_cast<uint64>(GetPerfCpuTime()))
+    {
+        const uint64 remainingMs = (endTime - now) / ticksPerMs;
+
+        // Sleep through all but the last millisecond, then yield until the target time to avoid oversleeping it.
+        if (remainingMs > 1)
+        {
+            SleepMs(static_cast<uint32>(remainingMs - 1));
+        }
+        else
+        {
+            YieldThread();
+        }
+    }
+}
+
+// =====================================================================================================================
+// Stores the timing of a processed present, overwriting the oldest unread record if the client isn't keeping up.
+void PresentScheduler::RecordTiming(
+    const PresentTimingRecord& timing)
+{
+    MutexAuto lock(&m_timingMutex);
+
+    if ((m_numTimingRecords - m_firstUnreadRecord) == ISwapChain::MaxPresentTimingRecords)
+    {
+        m_firstUnreadRecord++;
+        m_timingStats.numOverflowed++;
+    }
+
+    m_timingRecords[m_numTimingRecords % ISwapChain::MaxPresentTimingRecords] = timing;
+    m_numTimingRecords++;
+
+    m_timingStats.numPresents++;
+    m_timingStats.numPaced += timing.flags.paced;
+
+    if (timing.flags.dropped != 0)
+    {
+        m_timingStats.numDropped++;
+    }
+    else
+    {
+        const uint64 latencyUs = ((timing.completedTime - timing.requestedTime) * 1000000) / m_perfFrequency;
+        const uint32 bucket    = Min(Log2(latencyUs), PresentLatencyHistogramBuckets - 1);
+
+        m_timingStats.latencyHistogram[bucket]++;
+    }
+}
+
 // =====================================================================================================================
 // A thread-safe helper function to reuse an idle PresentSchedulerJob or create a new one.
 Result PresentScheduler::GetIdleJob(
@@ -490,6 +662,10 @@ void PresentScheduler::RunWorkerThread()
 
             case PresentJobType::Present:
                 {
+                    const PresentSwapChainInfo& presentInfo = pJob->GetPresentInfo();
+                    PresentTimingRecord*const   pTiming     = pJob->GetTiming();
+
+                    pTiming->dequeuedTime = static_cast<uint64>(GetPerfCpuTime());
 #if !defined(__unix__)
                     // Block the thread until the current job's image is ready to be presented. Directly waiting on
                     // the fence is preferable to submitting a queue semaphore wait because some OS-specific
@@ -500,8 +676,26 @@ void PresentScheduler::RunWorkerThread()
                     const Result     waitResult = m_pDevice->WaitForFences(1, &pFence, true, Timeout);
                     PAL_ALERT(IsErrorResult(waitResult) || (waitResult == Result::Timeout));
 #endif
-                    const Result presentResult = ProcessPresent(pJob->GetPresentInfo(), pJob->GetQueue(), false);
+                    if (pTiming->flags.paced != 0)
+                    {
+                        pTiming->targetTime = ComputePresentTime(presentInfo, m_lastPacedTime);
+                        WaitUntil(pTiming->targetTime);
+                    }
+
+                    pTiming->submittedTime = static_cast<uint64>(GetPerfCpuTime());
+
+                    const Result presentResult = ProcessPresent(presentInfo, pJob->GetQueue(), false);
                     PAL_ALERT(IsErrorResult(presentResult));
+
+                    pTiming->completedTime = static_cast<uint64>(GetPerfCpuTime());
+                    pTiming->flags.dropped = (presentResult != Result::Success);
+
+                    if (pTiming->flags.paced != 0)
+                    {
+                        m_lastPacedTime = pTiming->submittedTime;
+                    }
+
+                    RecordTiming(*pTiming);
                 }
 
                 m_idleJobMutex.Lock();
@@ -29,6 +29,7 @@
 #include "palMutex.h"
 #include "palQueue.h"
 #include "palSemaphore.h"
+#include "palSwapChain.h"
 #include "palThread.h"
 
 namespace Pal
@@ -70,6 +71,9 @@ public:
     void SetQueue(IQueue* pQueue) { m_pQueue = pQueue; }
     IQueue* GetQueue() const { return m_pQueue; }
 
+    void SetTiming(const PresentTimingRecord& timing) { m_timing = timing; }
+    PresentTimingRecord* GetTiming() { return &m_timing; }
+
 private:
     PresentSchedulerJob();
     ~PresentSchedulerJob();
@@ -81,6 +85,7 @@ private:
     PresentJobType       m_type;            // How to interpret this job (e.g., execute a present).
     PresentSwapChainInfo m_presentInfo;     // All of the information for a present.
     IQueue*              m_pQueue;          // Internal queue of the same device as the original presentation queue.
+    PresentTimingRecord  m_timing;          // Timing of the present, completed by the worker thread.
 };
 
 // =====================================================================================================================
@@ -104,6 +109,13 @@ public:
     // Waits for all internal present work to be idle before returning.
     Result WaitIdle();
 
+    // Implements ISwapChain::GetPresentTimings for the swap chain which owns this scheduler.
+    Result GetPresentTimings(uint32* pNumRecords, PresentTimingRecord* pRecords, PresentTimingStats* pStats);
+
+    // Returns the time at which a paced present should be queued to the OS given the time the previous paced present
+    // was queued (zero if there was none). This has no side effects so the pacing policy can be checked in isolation.
+    static uint64 ComputePresentTime(const PresentSwapChainInfo& presentInfo, uint64 lastPresentTime);
+
     // Must be declared public but meant for internal use only.
     void RunWorkerThread();
 
@@ -132,6 +144,8 @@ protected:
 private:
     Result GetIdleJob(PresentSchedulerJob** ppJob);
     void EnqueueJob(PresentSchedulerJob* pJob);
+    void WaitUntil(uint64 targetTime) const;
+    void RecordTiming(const PresentTimingRecord& timing);
 
     // All of this state is used to store and process asynchronous presentation requests. If all presents can be inlined
     // none of it will be used and the worker thread will never be started.
@@ -145,6 +159,16 @@ private:
     Util::Thread    m_workerThread;       // The driver thread that executes presents later on.
     volatile bool   m_workerActive;       // If the driver thread has been created.
 
+    // Present pacing and timing feedback state. All times are in Util::GetPerfCpuTime() ticks.
+    const uint64        m_perfFrequency;      // Ticks per second of Util::GetPerfCpuTime().
+    volatile uint64     m_presentCount;       // Number of presents requested so far, used to assign present IDs.
+    uint64              m_lastPacedTime;      // When the worker thread queued the last paced present.
+    Util::Mutex         m_timingMutex;        // Protects the timing records and statistics.
+    uint64              m_numTimingRecords;   // Number of timing records ever written to m_timingRecords.
+    uint64              m_firstUnreadRecord;  // Index of the oldest record the client hasn't retrieved yet.
+    PresentTimingStats  m_timingStats;
+    PresentTimingRecord m_timingRecords[ISwapChain::MaxPresentTimingRecords]; // Ring of the most recent records.
+
     PAL_DISALLOW_DEFAULT_CTOR(PresentScheduler);
     PAL_DISALLOW_COPY_AND_ASSIGN(PresentScheduler);
 };
@@ -34,6 +34,7 @@
 #include "core/queue.h"
 #include "core/queueContext.h"
 #include "core/queueSemaphore.h"
+#include "core/settingsLoader.h"
 #include "core/swapChain.h"
 #include "core/hw/ossip/ossDevice.h"
 #include "core/hw/gfxip/gfxDevice.h"
@@ -53,8 +54,8 @@ namespace Pal
 // Struct for passing the log file and pal setting pointers to the command buffer dump callback.
 struct CmdDumpToFilePayload
 {
-    File*               pLogFile;
-    const PalSettings*  pSettings;
+    File*                  pLogFile;
+    const RuntimeSettings* pSettings;
 };
 
 // =====================================================================================================================
@@ -620,11 +621,15 @@ Result Queue::SubmitInternal(
         if (result == Result::Success)
         {
 #if PAL_CLIENT_INTERFACE_MAJOR_VERSION >= 555
-            if (IsCmdDumpEnabled())
+            // Use one copy of the runtime settings for the whole dump, even if the settings file is reloaded meanwhile.
+            const RuntimeSettingsRef runtimeSettings(*m_pDevice);
+
+            if (IsCmdDumpEnabled(*runtimeSettings))
             {
                 Util::File logFile;
                 // Open file for write depending on the settings
-                const Result openResult = OpenCommandDumpFile(submitInfo, internalSubmitInfos[0], &logFile);
+                const Result openResult =
+                    OpenCommandDumpFile(*runtimeSettings, submitInfo, internalSubmitInfos[0], &logFile);
 
                 if (openResult == Result::Success) // file opened correctly
                 {
@@ -632,7 +637,7 @@ Result Queue::SubmitInternal(
 
                     CmdDumpToFilePayload payload = {};
                     payload.pLogFile = &logFile;
-                    payload.pSettings = &m_pDevice->Settings();
+                    payload.pSettings = &(*runtimeSettings);
 
                     submitInfoCopy.pfnCmdDumpCb = WriteCmdDumpToFile;
                     submitInfoCopy.pUserData = &payload;
@@ -807,10 +812,11 @@ void Queue::DumpCmdStream(
 #if PAL_ENABLE_PRINTS_ASSERTS
 // =====================================================================================================================
 // Helper function to find out if command dumping to file at submit time is enabled.
-bool Queue::IsCmdDumpEnabled() const
+bool Queue::IsCmdDumpEnabled(
+    const RuntimeSettings& settings
+    ) const
 {
     // To dump the command buffer upon submission for the specified frames
-    const auto& settings              = m_pDevice->Settings();
     const CmdBufDumpFormat dumpFormat = settings.cmdBufDumpFormat;
     const uint32 frameCnt             = m_pDevice->GetFrameCount();
 
@@ -824,6 +830,7 @@ bool Queue::IsCmdDumpEnabled() const
 // =====================================================================================================================
 // Opens the command buffer dump file and writes out the header according to settings.
 Result Queue::OpenCommandDumpFile(
+    const RuntimeSettings&      settings,
     const MultiSubmitInfo&      submitInfo,
     const InternalSubmitInfo&   internalSubmitInfo,
     Util::File*                 pLogFile)
@@ -831,7 +838,6 @@ Result Queue::OpenCommandDumpFile(
     if (submitInfo.perSubQueueInfoCount > 0)
     {
         // To dump the command buffer upon submission for the specified frames
-        const auto& settings = m_pDevice->Settings();
         const CmdBufDumpFormat dumpFormat = settings.cmdBufDumpFormat;
 
         static const char* const pSuffix[] =
@@ -963,8 +969,9 @@ void Queue::DumpCmdToFile(
     const InternalSubmitInfo& internalSubmitInfo)
 {
     // To dump the command buffer upon submission for the specified frames
-    const auto&            settings   = m_pDevice->Settings();
-    const CmdBufDumpFormat dumpFormat = settings.cmdBufDumpFormat;
+    const RuntimeSettingsRef settingsRef(*m_pDevice);
+    const RuntimeSettings&   settings   = *settingsRef;
+    const CmdBufDumpFormat   dumpFormat = settings.cmdBufDumpFormat;
 
     static const char* const pSuffix[] =
     {
@@ -43,6 +43,7 @@ class Image;
 class Platform;
 class QueueContext;
 class GpuMemory;
+struct RuntimeSettings;
 
 // On some hardware layers, particular Queue types may need to bundle several "special" command streams with each
 // client submission to guarantee the state of the GPU is consistent across multiple submissions. These constants
@@ -412,8 +413,9 @@ private:
 
 #if PAL_CLIENT_INTERFACE_MAJOR_VERSION >= 555
 #if PAL_ENABLE_PRINTS_ASSERTS
-    bool IsCmdDumpEnabled() const;
+    bool IsCmdDumpEnabled(const RuntimeSettings& settings) const;
     Result OpenCommandDumpFile(
+        const RuntimeSettings&      settings,
         const MultiSubmitInfo&      submitInfo,
         const InternalSubmitInfo&   internalSubmitInfo,
         Util::File*                 logFile);
@@ -0,0 +1,438 @@
+/*
+ ***********************************************************************************************************************
+ *
+ *  Copyright (c) 2020 Advanced Micro Devices, Inc. All Rights Reserved.
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy
+ *  of this software and associated documentation files (the "Software"), to deal
+ *  in the Software without restriction, including without limitation the rights
+ *  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *  copies of the Software, and to permit persons to whom the Software is
+ *  furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in all
+ *  copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ *  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *  SOFTWARE.
+ *
+ **********************************************************************************************************************/
+
+#include "core/device.h"
+#include "core/masterQueueSemaphore.h"
+#include "core/platform.h"
+#include "core/queueSemaphoreWaitService.h"
+#include "palThread.h"
+#include "palVectorImpl.h"
+
+using namespace Util;
+
+namespace Pal
+{
+
+// =====================================================================================================================
+// One worker thread of the QueueSemaphoreWaitService. The worker owns a list of registered semaphores and an internal
+// timeline "wake" semaphore. Each pass releases whatever blocked Queues it can and then blocks in one OS call until any
+// registered semaphore gets a new signal submitted or until the wake semaphore is signaled because the list changed.
+class SemaphoreWaitWorker
+{
+public:
+    explicit SemaphoreWaitWorker(Device* pDevice);
+    ~SemaphoreWaitWorker();
+
+    Result Init();
+
+    Result AddSemaphore(MasterQueueSemaphore* pSemaphore);
+    void   RemoveSemaphore(MasterQueueSemaphore* pSemaphore);
+
+    void RunWorkerThread();
+
+private:
+    void WakeWorker();
+    bool EraseSemaphore(MasterQueueSemaphore* pSemaphore);
+
+    typedef Vector<MasterQueueSemaphore*, 16, Platform> SemaphoreList;
+    typedef Vector<const QueueSemaphore*, 16, Platform> WaitSemaphoreList;
+    typedef Vector<uint64, 16, Platform>                WaitValueList;
+
+    Device*const      m_pDevice;
+    Thread            m_workerThread;
+    Mutex             m_listLock;       // Protects m_semaphores and m_wakeCount. Never held while calling out.
+    Mutex             m_passLock;       // Held by the worker thread for the duration of each release-and-wait pass.
+    SemaphoreList     m_semaphores;     // Semaphores which currently have blocked Queues waiting on this worker.
+    IQueueSemaphore*  m_pWakeSemaphore; // Internal timeline semaphore used to interrupt the multiplexed wait.
+    uint64            m_wakeCount;      // Last value signaled on m_pWakeSemaphore.
+    volatile bool     m_terminate;      // Asks the worker thread to exit at the end of its current pass.
+
+    // Per-pass scratch storage, only touched by the worker thread. Kept here so passes don't allocate.
+    SemaphoreList     m_passSemaphores;
+    WaitSemaphoreList m_waitSemaphores;
+    WaitValueList     m_waitValues;
+
+    PAL_DISALLOW_DEFAULT_CTOR(SemaphoreWaitWorker);
+    PAL_DISALLOW_COPY_AND_ASSIGN(SemaphoreWaitWorker);
+};
+
+// =====================================================================================================================
+SemaphoreWaitWorker::SemaphoreWaitWorker(
+    Device* pDevice)
+    :
+    m_pDevice(pDevice),
+    m_semaphores(pDevice->GetPlatform()),
+    m_pWakeSemaphore(nullptr),
+    m_wakeCount(0),
+    m_terminate(false),
+    m_passSemaphores(pDevice->GetPlatform()),
+    m_waitSemaphores(pDevice->GetPlatform()),
+    m_waitValues(pDevice->GetPlatform())
+{
+}
+
+// =====================================================================================================================
+SemaphoreWaitWorker::~SemaphoreWaitWorker()
+{
+    // Closing down the worker thread must be the first thing we do, to prevent data races.
+    if (m_workerThread.IsCreated())
+    {
+        PAL_ASSERT(m_workerThread.IsNotCurrentThread());
+
+        m_terminate = true;
+        WakeWorker();
+        m_workerThread.Join();
+    }
+
+    // Every semaphore must have unregistered itself before being destroyed.
+    PAL_ASSERT(m_semaphores.IsEmpty());
+
+    if (m_pWakeSemaphore != nullptr)
+    {
+        m_pWakeSemaphore->Destroy();
+        PAL_SAFE_FREE(m_pWakeSemaphore, m_pDevice->GetPlatform());
+    }
+}
+
+// =====================================================================================================================
+// Callback for executing the worker thread.
+static void WorkerThreadCallback(
+    void* pParameter)   // Opaque pointer to a SemaphoreWaitWorker
+{
+    static_cast<SemaphoreWaitWorker*>(pParameter)->RunWorkerThread();
+}
+
+// =====================================================================================================================
+// Creates the wake semaphore and starts the worker thread.
+Result SemaphoreWaitWorker::Init()
+{
+    Result result = m_listLock.Init();
+
+    if (result == Result::Success)
+    {
+        result = m_passLock.Init();
+    }
+
+    QueueSemaphoreCreateInfo createInfo = { };
+    createInfo.flags.timeline = 1;
+    createInfo.initialCount   = m_wakeCount;
+
+    if (result == Result::Success)
+    {
+        const size_t semaphoreSize = m_pDevice->GetQueueSemaphoreSize(createInfo, &result);
+
+        if (result == Result::Success)
+        {
+            void* pMemory = PAL_MALLOC(semaphoreSize, m_pDevice->GetPlatform(), AllocInternal);
+
+            if (pMemory != nullptr)
+            {
+                result = m_pDevice->CreateQueueSemaphore(createInfo, pMemory, &m_pWakeSemaphore);
+
+                if (result != Result::Success)
+                {
+                    PAL_SAFE_FREE(pMemory, m_pDevice->GetPlatform());
+                }
+            }
+            else
+            {
+                result = Result::ErrorOutOfMemory;
+            }
+        }
+    }
+
+    if (result == Result::Success)
+    {
+        result = m_workerThread.Begin(&WorkerThreadCallback, this);
+    }
+
+    return result;
+}
+
+// =====================================================================================================================
+// Signals the next value on the wake semaphore, which makes the worker's current (or next) multiplexed wait return.
+void SemaphoreWaitWorker::WakeWorker()
+{
+    MutexAuto lock(&m_listLock);
+
+    ++m_wakeCount;
+
+    const Result result = m_pWakeSemaphore->SignalSemaphoreValue(m_wakeCount);
+    PAL_ASSERT(result == Result::Success);
+}
+
+// =====================================================================================================================
+// Adds a semaphore to this worker's list and makes the worker pick it up.
+Result SemaphoreWaitWorker::AddSemaphore(
+    MasterQueueSemaphore* pSemaphore)
+{
+    m_listLock.Lock();
+    const Result result = m_semaphores.PushBack(pSemaphore);
+    m_listLock.Unlock();
+
+    if (result == Result::Success)
+    {
+        WakeWorker();
+    }
+
+    return result;
+}
+
+// =====================================================================================================================
+// Removes one instance of the given semaphore from the list. Returns true if it was found.
+bool SemaphoreWaitWorker::EraseSemaphore(
+    MasterQueueSemaphore* pSemaphore)
+{
+    MutexAuto lock(&m_listLock);
+
+    bool found = false;
+    for (uint32 idx = 0; idx < m_semaphores.NumElements(); ++idx)
+    {
+        if (m_semaphores.At(idx) == pSemaphore)
+        {
+            // Order doesn't matter, so just move the last element into the hole.
+            MasterQueueSemaphore* pLast = nullptr;
+            m_semaphores.PopBack(&pLast);
+
+            if (idx < m_semaphores.NumElements())
+            {
+                m_semaphores.At(idx) = pLast;
+            }
+
+            found = true;
+            break;
+        }
+    }
+
+    return found;
+}
+
+// =====================================================================================================================
+// Removes the semaphore from this worker and synchronizes with the worker thread so that it's safe to destroy the
+// semaphore afterwards.
+void SemaphoreWaitWorker::RemoveSemaphore(
+    MasterQueueSemaphore* pSemaphore)
+{
+    if (EraseSemaphore(pSemaphore))
+    {
+        // The worker might be in the middle of a pass which still references the semaphore. Interrupt its wait and
+        // wait for the pass to finish; any later pass won't see the semaphore anymore.
+        WakeWorker();
+
+        m_passLock.Lock();
+        m_passLock.Unlock();
+    }
+}
+
+// =====================================================================================================================
+// Executes the worker thread which releases blocked Queues for all semaphores assigned to this worker.
+void SemaphoreWaitWorker::RunWorkerThread()
+{
+    while (true)
+    {
+        Result result = Result::Success;
+
+        m_passLock.Lock();
+
+        // Take a snapshot of the registered semaphores and the wake value so that we never call out to a semaphore or
+        // the OS while holding the list lock. Any wake which happens after this point signals a value beyond
+        // wakeCount, so the wait below will return immediately instead of missing it.
+        m_listLock.Lock();
+        const uint64 wakeCount = m_wakeCount;
+        m_passSemaphores.Clear();
+        for (uint32 idx = 0; (idx < m_semaphores.NumElements()) && (result == Result::Success); ++idx)
+        {
+            result = m_passSemaphores.PushBack(m_semaphores.At(idx));
+        }
+        m_listLock.Unlock();
+
+        m_waitSemaphores.Clear();
+        m_waitValues.Clear();
+
+        for (uint32 idx = 0; (idx < m_passSemaphores.NumElements()) && (result == Result::Success); ++idx)
+        {
+            MasterQueueSemaphore*const pSemaphore = m_passSemaphores.At(idx);
+
+            uint64 nextValue       = 0;
+            bool   hasBlockedQueue = false;
+            result = pSemaphore->ServiceReleaseBlockedQueues(&nextValue, &hasBlockedQueue);
+
+            if (result == Result::Success)
+            {
+                if (hasBlockedQueue)
+                {
+                    result = m_waitSemaphores.PushBack(pSemaphore);
+
+                    if (result == Result::Success)
+                    {
+                        result = m_waitValues.PushBack(nextValue);
+                    }
+                }
+                else
+                {
+                    // The semaphore has already deregistered itself, so drop it from our list.
+                    EraseSemaphore(pSemaphore);
+                }
+            }
+        }
+
+        if (result == Result::Success)
+        {
+            result = m_waitSemaphores.PushBack(static_cast<QueueSemaphore*>(m_pWakeSemaphore));
+        }
+
+        if (result == Result::Success)
+        {
+            result = m_waitValues.PushBack(wakeCount + 1);
+        }
+
+        if ((result == Result::Success) && (m_terminate == false))
+        {
+            result = m_pDevice->WaitForSemaphoresAvailable(m_waitSemaphores.NumElements(),
+                                                           m_waitSemaphores.Data(),
+                                                           m_waitValues.Data(),
+                                                           UINT64_MAX);
+        }
+        PAL_ASSERT(result == Result::Success);
+
+        m_passLock.Unlock();
+
+        if (m_terminate)
+        {
+            m_workerThread.End();
+        }
+    }
+
+    PAL_NEVER_CALLED(); // This area should be unreachable.
+}
+
+// =====================================================================================================================
+QueueSemaphoreWaitService::QueueSemaphoreWaitService(
+    Device* pDevice)
+    :
+    m_pDevice(pDevice)
+{
+    memset(&m_pWorkers[0], 0, sizeof(m_pWorkers));
+}
+
+// =====================================================================================================================
+QueueSemaphoreWaitService::~QueueSemaphoreWaitService()
+{
+    // The workers must be destroyed in Cleanup() while the device can still destroy their wake semaphores.
+    for (uint32 idx = 0; idx < NumWorkers; ++idx)
+    {
+        PAL_ASSERT(m_pWorkers[idx] == nullptr);
+    }
+}
+
+// =====================================================================================================================
+Result QueueSemaphoreWaitService::Init()
+{
+    return m_workerLock.Init();
+}
+
+// =====================================================================================================================
+// Stops all worker threads. All semaphores which used the service must have been destroyed already.
+void QueueSemaphoreWaitService::Cleanup()
+{
+    MutexAuto lock(&m_workerLock);
+
+    for (uint32 idx = 0; idx < NumWorkers; ++idx)
+    {
+        PAL_SAFE_DELETE(m_pWorkers[idx], m_pDevice->GetPlatform());
+    }
+}
+
+// =====================================================================================================================
+// Picks the worker which owns a semaphore. The assignment only depends on the semaphore's address, so it's stable for
+// the semaphore's lifetime without storing any per-semaphore state.
+uint32 QueueSemaphoreWaitService::WorkerIndex(
+    const MasterQueueSemaphore* pSemaphore
+    ) const
+{
+    // The low bits of a heap address carry no entropy.
+    return static_cast<uint32>((reinterpret_cast<uintptr_t>(pSemaphore) >> 6) % NumWorkers);
+}
+
+// =====================================================================================================================
+Result QueueSemaphoreWaitService::Register(
+    MasterQueueSemaphore* pSemaphore)
+{
+    Result result = Result::Success;
+
+    const uint32 workerIdx = WorkerIndex(pSemaphore);
+
+    m_workerLock.Lock();
+
+    if (m_pWorkers[workerIdx] == nullptr)
+    {
+        SemaphoreWaitWorker* pWorker = PAL_NEW(SemaphoreWaitWorker, m_pDevice->GetPlatform(), AllocInternal)(m_pDevice);
+
+        if (pWorker == nullptr)
+        {
+            result = Result::ErrorOutOfMemory;
+        }
+        else
+        {
+            result = pWorker->Init();
+
+            if (result == Result::Success)
+            {
+                m_pWorkers[workerIdx] = pWorker;
+            }
+            else
+            {
+                PAL_SAFE_DELETE(pWorker, m_pDevice->GetPlatform());
+            }
+        }
+    }
+
+    SemaphoreWaitWorker*const pWorker = m_pWorkers[workerIdx];
+
+    m_workerLock.Unlock();
+
+    if (result == Result::Success)
+    {
+        result = pWorker->AddSemaphore(pSemaphore);
+    }
+
+    return result;
+}
+
+// =====================================================================================================================
+void QueueSemaphoreWaitService::Unregister(
+    MasterQueueSemaphore* pSemaphore)
+{
+    m_workerLock.Lock();
+    SemaphoreWaitWorker*const pWorker = m_pWorkers[WorkerIndex(pSemaphore)];
+    m_workerLock.Unlock();
+
+    if (pWorker != nullptr)
+    {
+        pWorker->RemoveSemaphore(pSemaphore);
+    }
+}
+
+} // Pal
@@ -0,0 +1,75 @@
+/*
+ ***********************************************************************************************************************
+ *
+ *  Copyright (c) 2020 Advanced Micro Devices, Inc. All Rights Reserved.
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy
+ *  of this software and associated documentation files (the "Software"), to deal
+ *  in the Software without restriction, including without limitation the rights
+ *  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *  copies of the Software, and to permit persons to whom the Software is
+ *  furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in all
+ *  copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ *  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *  SOFTWARE.
+ *
+ **********************************************************************************************************************/
+
+#pragma once
+
+#include "pal.h"
+#include "palMutex.h"
+
+namespace Pal
+{
+
+// Forward decl's
+class Device;
+class MasterQueueSemaphore;
+class SemaphoreWaitWorker;
+
+// =====================================================================================================================
+// Device-level service which releases Queues blocked on timeline semaphores that can be signaled outside of PAL (i.e.,
+// external or shareable timeline semaphores). Rather than dedicating one thread to each such semaphore, a small fixed
+// pool of worker threads multiplexes the waits of all registered semaphores into a single "wait for any" OS call per
+// worker. Each semaphore is assigned to one worker for its whole lifetime, so the thread count stays constant no matter
+// how many semaphores the client creates.
+class QueueSemaphoreWaitService
+{
+public:
+    explicit QueueSemaphoreWaitService(Device* pDevice);
+    ~QueueSemaphoreWaitService();
+
+    Result Init();
+    void   Cleanup();
+
+    // Asks the service to release the Queues blocked on the given semaphore once the OS sees the signals they wait on.
+    // The semaphore stays registered until it has no blocked Queues left.
+    Result Register(MasterQueueSemaphore* pSemaphore);
+
+    // Removes the given semaphore from the service. On return, no worker thread references the semaphore anymore.
+    void Unregister(MasterQueueSemaphore* pSemaphore);
+
+    // Number of worker threads which share the registered semaphores. Workers are only started on demand.
+    static constexpr uint32 NumWorkers = 2;
+
+private:
+    uint32 WorkerIndex(const MasterQueueSemaphore* pSemaphore) const;
+
+    Device*const         m_pDevice;
+    Util::Mutex          m_workerLock;              // Serializes on-demand worker creation and destruction.
+    SemaphoreWaitWorker* m_pWorkers[NumWorkers];
+
+    PAL_DISALLOW_DEFAULT_CTOR(QueueSemaphoreWaitService);
+    PAL_DISALLOW_COPY_AND_ASSIGN(QueueSemaphoreWaitService);
+};
+
+} // Pal
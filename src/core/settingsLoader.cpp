@@ -29,6 +29,7 @@
 #include "core/settingsLoader.h"
 #include "palAssert.h"
 #include "palInlineFuncs.h"
+#include "palMutex.h"
 #include "palSysMemory.h"
 
 #include "core/hw/amdgpu_asic.h"
@@ -52,9 +53,12 @@ SettingsLoader::SettingsLoader(
     ISettingsLoader(pDevice->GetPlatform(), static_cast<DriverSettings*>(&m_settings), g_palNumSettings),
     m_pDevice(pDevice),
     m_settings(),
+    m_pRuntimeSettings(&m_runtimeSettings),
+    m_runtimeReaders(0),
     m_pComponentName("Pal")
 {
     memset(&m_settings, 0, sizeof(PalSettings));
+    memset(&m_runtimeSettings, 0, sizeof(m_runtimeSettings));
 }
 
 // =====================================================================================================================
@@ -69,6 +73,74 @@ SettingsLoader::~SettingsLoader()
             pSettingsService->UnregisterComponent(m_pComponentName);
         }
     }
+
+    FreeRuntimeSettings();
+}
+
+// =====================================================================================================================
+// Frees the copies which pCurrent replaced, back to the finalized settings. The caller must make sure nobody still
+// reads them.
+void SettingsLoader::FreeRetiredRuntimeSettings(
+    RuntimeSettings* pCurrent)
+{
+    if (pCurrent != &m_runtimeSettings)
+    {
+        RuntimeSettings* pRuntimeSettings = pCurrent->pPrev;
+
+        while (pRuntimeSettings != &m_runtimeSettings)
+        {
+            RuntimeSettings*const pPrev = pRuntimeSettings->pPrev;
+            PAL_SAFE_DELETE(pRuntimeSettings, m_pDevice->GetPlatform());
+            pRuntimeSettings = pPrev;
+        }
+
+        pCurrent->pPrev = &m_runtimeSettings;
+    }
+}
+
+// =====================================================================================================================
+// Frees every runtime settings copy published by ReloadRuntimeSettings(). The caller must make sure nobody still reads
+// them.
+void SettingsLoader::FreeRuntimeSettings()
+{
+    PAL_ASSERT(m_runtimeReaders == 0);
+
+    FreeRetiredRuntimeSettings(m_pRuntimeSettings);
+
+    if (m_pRuntimeSettings != &m_runtimeSettings)
+    {
+        PAL_SAFE_DELETE(m_pRuntimeSettings, m_pDevice->GetPlatform());
+    }
+
+    m_pRuntimeSettings = &m_runtimeSettings;
+}
+
+// =====================================================================================================================
+// Returns the most recently published runtime settings and keeps them from being freed until the matching call to
+// ReleaseRuntimeSettings(). The reader count is raised before the pointer is read, so a reload which sees no readers
+// after publishing a new copy knows that every later reader gets the new copy.
+const RuntimeSettings* SettingsLoader::AcquireRuntimeSettings() const
+{
+    AtomicIncrement(&m_runtimeReaders);
+
+    return m_pRuntimeSettings;
+}
+
+// =====================================================================================================================
+void SettingsLoader::ReleaseRuntimeSettings() const
+{
+    PAL_ASSERT(m_runtimeReaders > 0);
+
+    AtomicDecrement(&m_runtimeReaders);
+}
+
+// =====================================================================================================================
+RuntimeSettingsRef::RuntimeSettingsRef(
+    const Device& device)
+    :
+    m_loader(*device.GetSettingsLoader()),
+    m_pSettings(m_loader.AcquireRuntimeSettings())
+{
 }
 
 // =====================================================================================================================
@@ -209,6 +281,114 @@ void SettingsLoader::FinalizeSettings()
 {
     ValidateSettings();
     GenerateSettingHash();
+
+    // Runtime settings published by earlier reloads predate the settings which were just finalized.
+    FreeRuntimeSettings();
+
+    m_runtimeSettings.cmdBufDumpMode                 = m_settings.cmdBufDumpMode;
+    m_runtimeSettings.cmdBufDumpFormat               = m_settings.cmdBufDumpFormat;
+    m_runtimeSettings.submitTimeCmdBufDumpStartFrame = m_settings.submitTimeCmdBufDumpStartFrame;
+    m_runtimeSettings.submitTimeCmdBufDumpEndFrame   = m_settings.submitTimeCmdBufDumpEndFrame;
+    m_runtimeSettings.pipelineElfLogConfig           = m_settings.pipelineElfLogConfig;
+    m_runtimeSettings.pPrev                          = nullptr;
+    Strncpy(m_runtimeSettings.cmdBufDumpDirectory,
+            m_settings.cmdBufDumpDirectory,
+            sizeof(m_runtimeSettings.cmdBufDumpDirectory));
+}
+
+// =====================================================================================================================
+// Reads a directory setting from the settings file into pDirectory, which must hold MaxPathStrLen characters. Like in
+// ValidateSettings(), the directory is relative to the debug file path. pDirectory is left alone if the setting isn't
+// in the file.
+void SettingsLoader::ReadRuntimeDirectory(
+    const char* pSettingName,
+    char*       pDirectory
+    ) const
+{
+    char subDir[MaxPathStrLen] = {};
+
+    if (m_pDevice->ReadSetting(pSettingName,
+                               ValueType::Str,
+                               &subDir[0],
+                               InternalSettingScope::PrivatePalKey,
+                               sizeof(subDir)))
+    {
+        const char* pRootPath = m_pDevice->GetDebugFilePath();
+        if (pRootPath != nullptr)
+        {
+            Snprintf(pDirectory, MaxPathStrLen, "%s/%s", pRootPath, subDir);
+        }
+        else
+        {
+            Strncpy(pDirectory, subDir, MaxPathStrLen);
+        }
+    }
+}
+
+// =====================================================================================================================
+// Re-reads the settings which are safe to change while the device is in use, after the settings file was reloaded, and
+// publishes them as a new RuntimeSettings copy. Settings removed from the file keep their current values, and the
+// settings hash is deliberately left alone because none of these settings affect pipeline compilation. Only one thread
+// may reload at a time.
+//
+// The copies the new one replaces are freed right away if no reader holds a RuntimeSettingsRef; otherwise they stay
+// chained to the new copy and are freed by the next reload which finds no readers.
+void SettingsLoader::ReloadRuntimeSettings()
+{
+    RuntimeSettings*const pCurrent = m_pRuntimeSettings;
+    RuntimeSettings*const pNew     = PAL_NEW(RuntimeSettings, m_pDevice->GetPlatform(), AllocInternal);
+
+    if (pNew != nullptr)
+    {
+        *pNew       = *pCurrent;
+        pNew->pPrev = pCurrent;
+
+        m_pDevice->ReadSetting(pCmdBufDumpModeStr,
+                               ValueType::Uint,
+                               &pNew->cmdBufDumpMode,
+                               InternalSettingScope::PrivatePalKey);
+
+        m_pDevice->ReadSetting(pCmdBufDumpFormatStr,
+                               ValueType::Uint,
+                               &pNew->cmdBufDumpFormat,
+                               InternalSettingScope::PrivatePalKey);
+
+        m_pDevice->ReadSetting(pSubmitTimeCmdBufDumpStartFrameStr,
+                               ValueType::Uint,
+                               &pNew->submitTimeCmdBufDumpStartFrame,
+                               InternalSettingScope::PrivatePalKey);
+
+        m_pDevice->ReadSetting(pSubmitTimeCmdBufDumpEndFrameStr,
+                               ValueType::Uint,
+                               &pNew->submitTimeCmdBufDumpEndFrame,
+                               InternalSettingScope::PrivatePalKey);
+
+        m_pDevice->ReadSetting(pPipelineElfLogConfig_LogInternalStr,
+                               ValueType::Boolean,
+                               &pNew->pipelineElfLogConfig.logInternal,
+                               InternalSettingScope::PrivatePalKey);
+
+        m_pDevice->ReadSetting(pPipelineElfLogConfig_LogExternalStr,
+                               ValueType::Boolean,
+                               &pNew->pipelineElfLogConfig.logExternal,
+                               InternalSettingScope::PrivatePalKey);
+
+        m_pDevice->ReadSetting(pPipelineElfLogConfig_LogHashStr,
+                               ValueType::Uint64,
+                               &pNew->pipelineElfLogConfig.logHash,
+                               InternalSettingScope::PrivatePalKey);
+
+        ReadRuntimeDirectory(pCmdBufDumpDirectoryStr, &pNew->cmdBufDumpDirectory[0]);
+        ReadRuntimeDirectory(pPipelineElfLogConfig_LogDirectoryStr, &pNew->pipelineElfLogConfig.logDirectory[0]);
+
+        AtomicExchangePointer(reinterpret_cast<void*volatile*>(&m_pRuntimeSettings), pNew);
+
+        // The compare-and-swap is a full barrier, so the reader count can't be read before the new copy is published.
+        if (AtomicCompareAndSwap(&m_runtimeReaders, 0, 0) == 0)
+        {
+            FreeRetiredRuntimeSettings(pNew);
+        }
+    }
 }
 
 // =====================================================================================================================
@@ -33,6 +33,23 @@ namespace Pal
 
 class Device;
 
+// =====================================================================================================================
+// The settings which may change while the device is in use, when the settings file is watched (see AMD_CONFIG_WATCH).
+// A reload never modifies a published copy: it publishes a new one instead, so a reader which pins the current copy
+// with a RuntimeSettingsRef sees consistent values for as long as it holds the reference.
+struct RuntimeSettings
+{
+    CmdBufDumpMode                              cmdBufDumpMode;
+    CmdBufDumpFormat                            cmdBufDumpFormat;
+    char                                        cmdBufDumpDirectory[MaxPathStrLen];
+    uint32                                      submitTimeCmdBufDumpStartFrame;
+    uint32                                      submitTimeCmdBufDumpEndFrame;
+    decltype(PalSettings::pipelineElfLogConfig) pipelineElfLogConfig;
+
+    // The copy this one replaced, if it could not be freed yet because a reader may still be using it.
+    RuntimeSettings*                            pPrev;
+};
+
 // =====================================================================================================================
 // This class is responsible for loading the PAL Core runtime settings structure specified in the constructor
 class SettingsLoader : public ISettingsLoader
@@ -43,10 +60,14 @@ public:
 
     virtual Result Init() override;
     void FinalizeSettings();
+    void ReloadRuntimeSettings();
 
     const PalSettings& GetSettings() const { return m_settings; };
     PalSettings* GetSettingsPtr() { return &m_settings; }
 
+    const RuntimeSettings* AcquireRuntimeSettings() const;
+    void ReleaseRuntimeSettings() const;
+
 protected:
     void ValidateSettings();
 
@@ -59,6 +80,10 @@ private:
 
     void OverrideDefaults();
 
+    void ReadRuntimeDirectory(const char* pSettingName, char* pDirectory) const;
+    void FreeRetiredRuntimeSettings(RuntimeSettings* pCurrent);
+    void FreeRuntimeSettings();
+
     #if PAL_ENABLE_PRINTS_ASSERTS
         void InitDpLevelSettings();
     #endif
@@ -66,6 +91,10 @@ private:
     Device*      m_pDevice;
     PalSettings  m_settings;
 
+    RuntimeSettings           m_runtimeSettings;   // Runtime settings as they were when the settings were finalized.
+    RuntimeSettings* volatile m_pRuntimeSettings;  // The most recently published runtime settings.
+    mutable volatile uint32   m_runtimeReaders;    // Number of live RuntimeSettingsRefs.
+
     // auto-generated functions
     virtual void SetupDefaults() override;
     virtual void ReadSettings() override;
@@ -76,4 +105,25 @@ private:
     const char*const m_pComponentName;
 };
 
+// =====================================================================================================================
+// Pins the runtime settings which are current when it is constructed, so that a concurrent reload can't free them, and
+// gives access to them until it is destroyed. Copies retired while any reference is alive are freed by a later reload,
+// so references should only be held for the duration of a single operation.
+class RuntimeSettingsRef
+{
+public:
+    explicit RuntimeSettingsRef(const Device& device);
+    ~RuntimeSettingsRef() { m_loader.ReleaseRuntimeSettings(); }
+
+    const RuntimeSettings& operator*() const  { return *m_pSettings; }
+    const RuntimeSettings* operator->() const { return m_pSettings; }
+
+private:
+    const SettingsLoader&        m_loader;
+    const RuntimeSettings*const  m_pSettings;
+
+    PAL_DISALLOW_COPY_AND_ASSIGN(RuntimeSettingsRef);
+    PAL_DISALLOW_DEFAULT_CTOR(RuntimeSettingsRef);
+};
+
 } // Pal
@@ -235,6 +235,17 @@ Result SwapChain::WaitIdle()
     return m_pScheduler->WaitIdle();
 }
 
+#if PAL_CLIENT_INTERFACE_MAJOR_VERSION >= 642
+// =====================================================================================================================
+Result SwapChain::GetPresentTimings(
+    uint32*              pNumRecords,
+    PresentTimingRecord* pRecords,
+    PresentTimingStats*  pStats)
+{
+    return m_pScheduler->GetPresentTimings(pNumRecords, pRecords, pStats);
+}
+#endif
+
 // =====================================================================================================================
 // Issues a present for an image in this swap chain using its present scheduler.
 Result SwapChain::Present(
@@ -58,6 +58,13 @@ public:
 
     virtual bool NeedWindowSizeChangedCheck() const override { return true; }
 
+#if PAL_CLIENT_INTERFACE_MAJOR_VERSION >= 642
+    virtual Result GetPresentTimings(
+        uint32*              pNumRecords,
+        PresentTimingRecord* pRecords,
+        PresentTimingStats*  pStats) override;
+#endif
+
     // These begin and end a swap chain present. The present scheduler must call PresentComplete once it has scheduled
     // the present and all necessary synchronization.
     Result Present(const PresentSwapChainInfo& presentInfo, IQueue* pQueue);
@@ -0,0 +1,216 @@
+/*
+ ***********************************************************************************************************************
+ *
+ *  Copyright (c) 2016-2020 Advanced Micro Devices, Inc. All Rights Reserved.
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy
+ *  of this software and associated documentation files (the "Software"), to deal
+ *  in the Software without restriction, including without limitation the rights
+ *  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *  copies of the Software, and to permit persons to whom the Software is
+ *  furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in all
+ *  copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ *  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *  SOFTWARE.
+ *
+ **********************************************************************************************************************/
+
+#include "palCodeObjectStore.h"
+#include "palHashMapImpl.h"
+#include "palSysMemory.h"
+
+using namespace Pal;
+
+namespace GpuUtil
+{
+
+// =====================================================================================================================
+CodeObjectStore::CodeObjectStore(
+    IPlatform* pPlatform)
+    :
+    m_pPlatform(pPlatform),
+    m_refCount(1),
+    m_entries(512, pPlatform)
+{
+    memset(&m_stats, 0, sizeof(m_stats));
+}
+
+// =====================================================================================================================
+CodeObjectStore::~CodeObjectStore()
+{
+    for (auto iter = m_entries.Begin(); iter.Get() != nullptr; iter.Next())
+    {
+        FreeEntry(iter.Get()->value);
+    }
+}
+
+// =====================================================================================================================
+Result CodeObjectStore::Create(
+    IPlatform*        pPlatform,
+    CodeObjectStore** ppStore)
+{
+    Result result = Result::ErrorOutOfMemory;
+
+    CodeObjectStore* pStore = PAL_NEW(CodeObjectStore, pPlatform, Util::SystemAllocType::AllocObject)(pPlatform);
+
+    if (pStore != nullptr)
+    {
+        result = pStore->Init();
+
+        if (result == Result::Success)
+        {
+            *ppStore = pStore;
+        }
+        else
+        {
+            pStore->~CodeObjectStore();
+            PAL_FREE(pStore, pPlatform);
+        }
+    }
+
+    return result;
+}
+
+// =====================================================================================================================
+Result CodeObjectStore::Init()
+{
+    Result result = m_lock.Init();
+
+    if (result == Result::Success)
+    {
+        result = m_entries.Init();
+    }
+
+    return result;
+}
+
+// =====================================================================================================================
+void CodeObjectStore::AddRef()
+{
+    Util::AtomicIncrement(&m_refCount);
+}
+
+// =====================================================================================================================
+void CodeObjectStore::Release()
+{
+    PAL_ASSERT(m_refCount > 0);
+
+    if (Util::AtomicDecrement(&m_refCount) == 0)
+    {
+        IPlatform*const pPlatform = m_pPlatform;
+
+        this->~CodeObjectStore();
+        PAL_FREE(this, pPlatform);
+    }
+}
+
+// =====================================================================================================================
+// Frees the records owned by an entry, but not the entry itself.
+void CodeObjectStore::FreeRecords(
+    Entry* pEntry)
+{
+    PAL_SAFE_FREE(pEntry->codeObject.pRecord, m_pPlatform);
+
+    for (uint32 i = 0; i < pEntry->numShaderRecords; ++i)
+    {
+        PAL_SAFE_FREE(pEntry->shaderRecords[i].pRecord, m_pPlatform);
+    }
+}
+
+// =====================================================================================================================
+// Frees a heap-allocated entry along with its records.
+void CodeObjectStore::FreeEntry(
+    Entry* pEntry)
+{
+    FreeRecords(pEntry);
+    PAL_FREE(pEntry, m_pPlatform);
+}
+
+// =====================================================================================================================
+const CodeObjectStore::Entry* CodeObjectStore::Find(
+    uint64 hash)
+{
+    Util::MutexAuto lock(&m_lock);
+
+    Entry*const* ppEntry = m_entries.FindKey(hash);
+
+    if (ppEntry != nullptr)
+    {
+        m_stats.numHits++;
+    }
+
+    return (ppEntry != nullptr) ? *ppEntry : nullptr;
+}
+
+// =====================================================================================================================
+const CodeObjectStore::Entry* CodeObjectStore::Insert(
+    uint64       hash,
+    const Entry& entry)
+{
+    // Copy the entry before taking the lock; it is freed again if another thread won the race.
+    Entry* pNew = static_cast<Entry*>(PAL_MALLOC(sizeof(Entry), m_pPlatform, Util::SystemAllocType::AllocInternal));
+
+    const Entry* pStored = nullptr;
+
+    if (pNew == nullptr)
+    {
+        // The store takes ownership of the records even on failure.
+        Entry copy = entry;
+        FreeRecords(&copy);
+    }
+    else
+    {
+        *pNew = entry;
+
+        Util::MutexAuto lock(&m_lock);
+
+        Entry*const* ppEntry = m_entries.FindKey(hash);
+
+        if (ppEntry != nullptr)
+        {
+            pStored = *ppEntry;
+            m_stats.numHits++;
+        }
+        else if (m_entries.Insert(hash, pNew) == Result::Success)
+        {
+            pStored = pNew;
+
+            m_stats.numCodeObjects++;
+            m_stats.codeObjectBytes += pNew->codeObject.recordSize;
+
+            for (uint32 i = 0; i < pNew->numShaderRecords; ++i)
+            {
+                m_stats.numShaderRecords++;
+                m_stats.shaderRecordBytes += pNew->shaderRecords[i].recordSize;
+            }
+        }
+
+        if (pStored != pNew)
+        {
+            FreeEntry(pNew);
+        }
+    }
+
+    return pStored;
+}
+
+// =====================================================================================================================
+void CodeObjectStore::GetStats(
+    CodeObjectStoreStats* pStats
+    ) const
+{
+    Util::MutexAuto lock(&m_lock);
+
+    *pStats               = m_stats;
+    pStats->numReferences = m_refCount;
+}
+
+} // GpuUtil
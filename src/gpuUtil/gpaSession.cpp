@@ -392,7 +392,12 @@ GpaSession::GpaSession(
 #endif
     uint16               rgpInstrumentationSpecVer,
     uint16               rgpInstrumentationApiVer,
+#if PAL_CLIENT_INTERFACE_MAJOR_VERSION >= 642
+    PerfExpMemDeque*     pAvailablePerfExpMem,
+    CodeObjectStore*     pCodeObjectStore)
+#else
     PerfExpMemDeque*     pAvailablePerfExpMem)
+#endif
     :
     m_pDevice(pDevice),
     m_timestampAlignment(0),
@@ -428,6 +433,11 @@ GpaSession::GpaSession(
     m_curPsoCorrelationRecords(m_pPlatform),
     m_shaderRecordsCache(m_pPlatform),
     m_curShaderRecords(m_pPlatform),
+#if PAL_CLIENT_INTERFACE_MAJOR_VERSION >= 642
+    m_pCodeObjectStore(pCodeObjectStore),
+#else
+    m_pCodeObjectStore(nullptr),
+#endif
     m_timedQueuesArray(m_pPlatform),
     m_queueEvents(m_pPlatform),
     m_timestampCalibrations(m_pPlatform),
@@ -439,6 +449,11 @@ GpaSession::GpaSession(
     memset(&m_curLocalInvisGpuMem,       0, sizeof(m_curLocalInvisGpuMem));
 
     m_flags.u32All = 0;
+
+    if (m_pCodeObjectStore != nullptr)
+    {
+        m_pCodeObjectStore->AddRef();
+    }
 }
 
 // =====================================================================================================================
@@ -538,24 +553,12 @@ GpaSession::~GpaSession()
         PAL_SAFE_FREE(m_pCmdAllocator, m_pPlatform);
     }
 
-    // Clear the code object records cache.
-    while (m_codeObjectRecordsCache.NumElements() > 0)
-    {
-        SqttCodeObjectDatabaseRecord* pRecord = nullptr;
-        m_codeObjectRecordsCache.PopFront(&pRecord);
-        PAL_ASSERT(pRecord != nullptr);
-
-        PAL_SAFE_FREE(pRecord, m_pPlatform);
-    }
-
-    // Clear the shader records cache.
-    while (m_shaderRecordsCache.NumElements() > 0)
+    // The code object and shader records caches only point into the store, which frees them once no session
+    // references it anymore.
+    if (m_pCodeObjectStore != nullptr)
     {
-        ShaderRecord shaderRecord = {};
-        m_shaderRecordsCache.PopFront(&shaderRecord);
-        PAL_ASSERT(shaderRecord.pRecord != nullptr);
-
-        PAL_SAFE_FREE(shaderRecord.pRecord, m_pPlatform);
+        m_pCodeObjectStore->Release();
+        m_pCodeObjectStore = nullptr;
     }
 }
 
@@ -594,6 +597,7 @@ GpaSession::GpaSession(
     m_curPsoCorrelationRecords(m_pPlatform),
     m_shaderRecordsCache(m_pPlatform),
     m_curShaderRecords(m_pPlatform),
+    m_pCodeObjectStore(src.m_pCodeObjectStore),
     m_timedQueuesArray(m_pPlatform),
     m_queueEvents(m_pPlatform),
     m_timestampCalibrations(m_pPlatform),
@@ -605,6 +609,11 @@ GpaSession::GpaSession(
     memset(&m_curLocalInvisGpuMem,       0, sizeof(m_curLocalInvisGpuMem));
 
     m_flags.u32All = 0;
+
+    if (m_pCodeObjectStore != nullptr)
+    {
+        m_pCodeObjectStore->AddRef();
+    }
 }
 
 // =====================================================================================================================
@@ -720,6 +729,13 @@ Result GpaSession::Init()
     {
         result = m_registeredApiHashes.Init();
     }
+    if ((result == Result::Success) && (m_pCodeObjectStore == nullptr))
+    {
+        result = CodeObjectStore::Create(m_pPlatform, &m_pCodeObjectStore);
+    }
+
+    // Records are allocated with this session's platform but freed by the store, so both must agree.
+    PAL_ASSERT((m_pCodeObjectStore == nullptr) || (m_pCodeObjectStore->GetPlatform() == m_pPlatform));
 
     // CopySession specific work
     if ((result == Result::Success) && (m_pSrcSession != nullptr))
@@ -2606,6 +2622,112 @@ void GpaSession::DestroyTimedQueueState(
     PAL_SAFE_FREE(pQueueState, m_pPlatform);
 }
 
+// =====================================================================================================================
+// Copies the code object of a pipeline or library into a new record in RGP code object database format.
+template <typename CodeObjectSource>
+Result GpaSession::CreateCodeObjectRecord(
+    const CodeObjectSource*  pSource,
+    CodeObjectStore::Record* pRecord)
+{
+    SqttCodeObjectDatabaseRecord record = {};
+
+    Result result = pSource->GetCodeObject(&record.recordSize, nullptr);
+
+    if (result == Result::Success)
+    {
+        PAL_ASSERT(record.recordSize != 0);
+
+        // Pad the record size to the nearest multiple of 4 bytes per the RGP file format spec.
+        record.recordSize = Util::RoundUpToMultiple(record.recordSize, 4U);
+
+        // Allocate space to store all the information for one record.
+        void* pCodeObjectRecord = PAL_MALLOC((sizeof(SqttCodeObjectDatabaseRecord) + record.recordSize),
+                                             m_pPlatform,
+                                             Util::SystemAllocType::AllocInternal);
+
+        if (pCodeObjectRecord != nullptr)
+        {
+            // Write the record header.
+            memcpy(pCodeObjectRecord, &record, sizeof(record));
+
+            // Write the code object binary.
+            result = pSource->GetCodeObject(&record.recordSize, Util::VoidPtrInc(pCodeObjectRecord, sizeof(record)));
+
+            if (result != Result::Success)
+            {
+                // Deallocate if some error occurred.
+                PAL_SAFE_FREE(pCodeObjectRecord, m_pPlatform);
+            }
+        }
+        else
+        {
+            result = Result::ErrorOutOfMemory;
+        }
+
+        pRecord->recordSize = static_cast<uint32>(sizeof(SqttCodeObjectDatabaseRecord) + record.recordSize);
+        pRecord->pRecord    = pCodeObjectRecord;
+    }
+
+    return result;
+}
+
+// =====================================================================================================================
+// Hands freshly captured records to the code object store, or frees them if capturing them failed.
+Result GpaSession::StoreCodeObjectRecords(
+    uint64                         codeObjectHash,
+    Result                         captureResult,
+    CodeObjectStore::Entry*        pEntry,
+    const CodeObjectStore::Entry** ppStored)
+{
+    Result result = captureResult;
+
+    if (result == Result::Success)
+    {
+        // If another session stored the same code object in the meantime, its records are used instead.
+        *ppStored = m_pCodeObjectStore->Insert(codeObjectHash, *pEntry);
+
+        if (*ppStored == nullptr)
+        {
+            result = Result::ErrorOutOfMemory;
+        }
+    }
+    else
+    {
+        PAL_SAFE_FREE(pEntry->codeObject.pRecord, m_pPlatform);
+
+        for (uint32 i = 0; i < pEntry->numShaderRecords; ++i)
+        {
+            PAL_SAFE_FREE(pEntry->shaderRecords[i].pRecord, m_pPlatform);
+        }
+    }
+
+    return result;
+}
+
+// =====================================================================================================================
+// Adds references to a stored pipeline's or library's records to this session's caches.
+Result GpaSession::AddCodeObjectRecords(
+    const CodeObjectStore::Entry& entry)
+{
+    m_registerPipelineLock.LockForWrite();
+
+    Result result = m_codeObjectRecordsCache.PushBack(
+                        static_cast<SqttCodeObjectDatabaseRecord*>(entry.codeObject.pRecord));
+
+    for (uint32 i = 0; ((result == Result::Success) && (i < entry.numShaderRecords)); ++i)
+    {
+        ShaderRecord shaderRecord = {};
+        shaderRecord.recordSize   = entry.shaderRecords[i].recordSize;
+        shaderRecord.pRecord      = entry.shaderRecords[i].pRecord;
+
+        result = m_shaderRecordsCache.PushBack(shaderRecord);
+    }
+
+    m_registerPipelineLock.UnlockForWrite();
+
+    return result;
+}
+
 // =====================================================================================================================
 // Registers a pipeline with the GpaSession. Returns AlreadyExists on duplicate PAL pipeline.
 Result GpaSession::RegisterPipeline(
@@ -2656,75 +2778,42 @@ Result GpaSession::RegisterPipeline(
 
     if (result == Result::Success)
     {
-        // Cache the pipeline binary in GpaSession-owned memory.
-        SqttCodeObjectDatabaseRecord record = {};
-
-        void* pCodeObjectRecord = nullptr;
-
-        result = pPipeline->GetCodeObject(&record.recordSize, nullptr);
+        const uint64                  codeObjectHash = pipeInfo.internalPipelineHash.unique;
+        const CodeObjectStore::Entry* pEntry         = m_pCodeObjectStore->Find(codeObjectHash);
 
-        if (result == Result::Success)
+        if (pEntry == nullptr)
         {
-            PAL_ASSERT(record.recordSize != 0);
-
-            // Pad the record size to the nearest multiple of 4 bytes per the RGP file format spec.
-            record.recordSize = Util::RoundUpToMultiple(record.recordSize, 4U);
+            // No session sharing the store has seen this pipeline yet; capture its binary and shader ISA.
+            CodeObjectStore::Entry entry = {};
 
-            // Allocate space to store all the information for one record.
-            pCodeObjectRecord = PAL_MALLOC((sizeof(SqttCodeObjectDatabaseRecord) + record.recordSize),
-                                           m_pPlatform,
-                                           Util::SystemAllocType::AllocInternal);
+            result = CreateCodeObjectRecord(pPipeline, &entry.codeObject);
 
-            if (pCodeObjectRecord != nullptr)
+            for (uint32 i = 0; ((i < NumShaderTypes) && (result == Result::Success)); ++i)
             {
-                // Write the record header.
-                memcpy(pCodeObjectRecord, &record, sizeof(record));
+                // Extract shader data from the pipeline.
+                // The upper 64-bits of the shader hash can be 0 when 64-bit CRCs are used
+                if (ShaderHashIsNonzero(pipeInfo.shader[i].hash))
+                {
+                    ShaderRecord shaderRecord = {};
 
-                // Write the pipeline binary.
-                result = pPipeline->GetCodeObject(&record.recordSize,
-                                                   Util::VoidPtrInc(pCodeObjectRecord, sizeof(record)));
+                    result = CreateShaderRecord(static_cast<ShaderType>(i), pPipeline, &shaderRecord);
+                    PAL_ASSERT(result == Result::Success);
 
-                if (result != Result::Success)
-                {
-                    // Deallocate if some error occurred.
-                    PAL_SAFE_FREE(pCodeObjectRecord, m_pPlatform)
+                    if (result == Result::Success)
+                    {
+                        entry.shaderRecords[entry.numShaderRecords].recordSize = shaderRecord.recordSize;
+                        entry.shaderRecords[entry.numShaderRecords].pRecord    = shaderRecord.pRecord;
+                        entry.numShaderRecords++;
+                    }
                 }
             }
-            else
-            {
-                result = Result::ErrorOutOfMemory;
-            }
-        }
-
-        // Local copy of shader data that will later be copied into the shaderRecords list under lock.
-        ShaderRecord pShaderRecords[NumShaderTypes];
-        uint32 numShaders = 0;
-
-        for (uint32 i = 0; ((i < NumShaderTypes) && (result == Result::Success)); ++i)
-        {
-            // Extract shader data from the pipeline.
-            // The upper 64-bits of the shader hash can be 0 when 64-bit CRCs are used
-            if (ShaderHashIsNonzero(pipeInfo.shader[i].hash))
-            {
-                result = CreateShaderRecord(static_cast<ShaderType>(i), pPipeline, &pShaderRecords[numShaders]);
-                PAL_ASSERT(result == Result::Success);
 
-                ++numShaders;
-            }
+            result = StoreCodeObjectRecords(codeObjectHash, result, &entry, &pEntry);
         }
 
-        if (result == Result::Success)
+        if (pEntry != nullptr)
         {
-            m_registerPipelineLock.LockForWrite();
-
-            m_codeObjectRecordsCache.PushBack(static_cast<SqttCodeObjectDatabaseRecord*>(pCodeObjectRecord));
-
-            for (uint32 i = 0; ((result == Result::Success) && (i < numShaders)); ++i)
-            {
-                result = m_shaderRecordsCache.PushBack(pShaderRecords[i]);
-            }
-
-            m_registerPipelineLock.UnlockForWrite();
+            result = AddCodeObjectRecords(*pEntry);
         }
     }
 
@@ -2789,53 +2878,21 @@ Result GpaSession::RegisterLibrary(
 
     if (result == Result::Success)
     {
-        // Cache the code object binary in GpaSession-owned memory.
-        SqttCodeObjectDatabaseRecord record = {};
+        const uint64                  codeObjectHash = libraryInfo.internalLibraryHash.unique;
+        const CodeObjectStore::Entry* pEntry         = m_pCodeObjectStore->Find(codeObjectHash);
 
-        void* pCodeObjectRecord = nullptr;
-
-        result = pLibrary->GetCodeObject(&record.recordSize, nullptr);
-
-        if (result == Result::Success)
+        if (pEntry == nullptr)
         {
-            PAL_ASSERT(record.recordSize != 0);
-
-            // Pad the record size to the nearest multiple of 4 bytes per the RGP file format spec.
-            record.recordSize = Util::RoundUpToMultiple(record.recordSize, 4U);
+            // No session sharing the store has seen this library yet; capture its binary.
+            CodeObjectStore::Entry entry = {};
 
-            // Allocate space to store all the information for one record.
-            pCodeObjectRecord = PAL_MALLOC((sizeof(SqttCodeObjectDatabaseRecord) + record.recordSize),
-                                           m_pPlatform,
-                                           Util::SystemAllocType::AllocInternal);
-
-            if (pCodeObjectRecord != nullptr)
-            {
-                // Write the record header.
-                memcpy(pCodeObjectRecord, &record, sizeof(record));
-
-                // Write the code object binary.
-                result = pLibrary->GetCodeObject(&record.recordSize,
-                                                 Util::VoidPtrInc(pCodeObjectRecord, sizeof(record)));
-
-                if (result != Result::Success)
-                {
-                    // Deallocate if some error occurred.
-                    PAL_SAFE_FREE(pCodeObjectRecord, m_pPlatform)
-                }
-            }
-            else
-            {
-                result = Result::ErrorOutOfMemory;
-            }
+            result = CreateCodeObjectRecord(pLibrary, &entry.codeObject);
+            result = StoreCodeObjectRecords(codeObjectHash, result, &entry, &pEntry);
         }
 
-        if (result == Result::Success)
+        if (pEntry != nullptr)
         {
-            m_registerPipelineLock.LockForWrite();
-
-            m_codeObjectRecordsCache.PushBack(static_cast<SqttCodeObjectDatabaseRecord*>(pCodeObjectRecord));
-
-            m_registerPipelineLock.UnlockForWrite();
+            result = AddCodeObjectRecords(*pEntry);
         }
     }
 
@@ -372,21 +372,9 @@ Result GpaSession::TraceSample::GetSpmTraceResults(
     void* pSrcBufferStart = Util::VoidPtrInc(m_pPerfExpResults,
                                              static_cast<size_t>(m_pSpmTraceLayout->offset));
 
-    // Extract timestamps from m_perfExpResults
-    uint32 numSpmDwords = static_cast<uint32*>(pSrcBufferStart)[0];
-
     // Move to the actual start of the Spm data. The first dword is the wptr. There are 32 bytes of
     // reserved fields after which the data begins.
-    void* pSrcDataStart = Util::VoidPtrInc(pSrcBufferStart, NumMetadataBytes);
-    uint64* pTimestamp = static_cast<uint64*>(pSrcDataStart);
-
-    for (int32 sample = 0; sample < m_numSpmSamples; ++sample)
-    {
-        // RGP Spm output: Write the timestamps.
-        static_cast<uint64*>(pDstBuffer)[sample] = *pTimestamp;
-
-        pTimestamp += SampleSizeInQWords;
-    }
+    const void* pSrcDataStart = Util::VoidPtrInc(pSrcBufferStart, NumMetadataBytes);
 
     // Beginning of the SpmCounterInfo section.
     SpmCounterInfo* pCounterInfo =
@@ -406,30 +394,56 @@ Result GpaSession::TraceSample::GetSpmTraceResults(
         curCounterDataOffset += CounterDataSizeInBytes;
     }
 
-    // Read pointer points to the first segment of the first sample.
-    uint16* pSample = static_cast<uint16*>(pSrcDataStart);
-
-    // Index within the SPM ring buffer, which is considered an array of uint16.
-    gpusize index = 0;
-    gpusize offset = 0;
+    // The ring is sample-major but RGP wants the values counter-major. Gathering each counter straight from the ring
+    // would re-read every sample once per counter with a large stride, out of memory which is typically uncached or
+    // write-combined. Instead, copy blocks of whole samples in ring order into a cached staging tile and transpose each
+    // block from there, so the GPU memory is only read once and sequentially.
+    const uint32 sampleSizeInBytes = m_pSpmTraceLayout->sampleSizeInBytes;
+    const uint32 numSamples        = static_cast<uint32>(Util::Max(m_numSpmSamples, 0));
+    const uint32 samplesPerTile    = Util::Max(SpmTransposeTileSizeInBytes / sampleSizeInBytes, 1u);
 
-    // Write pointer points to the beginning ofthe first counter data.
-    uint16* pDstCounterData = static_cast<uint16*>(Util::VoidPtrInc(pDstBuffer, CounterDataOffset));
+    void* pTile = PAL_MALLOC(samplesPerTile * sampleSizeInBytes, m_pAllocator, Util::AllocInternalTemp);
 
-    for (uint32 counter = 0; counter < m_numSpmCounters; counter++)
+    if (pTile == nullptr)
+    {
+        result = Result::ErrorOutOfMemory;
+    }
+    else
     {
-        offset = m_pSpmTraceLayout->counterData[counter].offset;
+        uint64* pDstTimestamps  = static_cast<uint64*>(pDstBuffer);
+        uint16* pDstCounterData = static_cast<uint16*>(Util::VoidPtrInc(pDstBuffer, CounterDataOffset));
 
-        for (int32 sample = 0; sample < m_numSpmSamples; sample++)
+        for (uint32 firstSample = 0; firstSample < numSamples; firstSample += samplesPerTile)
         {
-            index = offset + (sample * SampleSizeInWords);
+            const uint32 numTileSamples = Util::Min(samplesPerTile, numSamples - firstSample);
 
-            // RGP SPM OUTPUT: write the delta values of the current counter for all samples.
-            (*pDstCounterData) = pSample[index];
-            pDstCounterData++;
+            memcpy(pTile,
+                   Util::VoidPtrInc(pSrcDataStart, static_cast<size_t>(firstSample) * sampleSizeInBytes),
+                   numTileSamples * sampleSizeInBytes);
 
-        } // Iterate over samples.
-    } // Iterate over counters.
+            // RGP Spm output: Write the timestamps, which are the first qword of each sample.
+            const uint64* pTileQwords = static_cast<const uint64*>(pTile);
+            for (uint32 sample = 0; sample < numTileSamples; sample++)
+            {
+                pDstTimestamps[firstSample + sample] = pTileQwords[sample * SampleSizeInQWords];
+            }
+
+            // RGP SPM OUTPUT: write the delta values of every counter for the samples in this tile.
+            const uint16* pTileWords = static_cast<const uint16*>(pTile);
+            for (uint32 counter = 0; counter < m_numSpmCounters; counter++)
+            {
+                const uint16* pSrc = pTileWords + m_pSpmTraceLayout->counterData[counter].offset;
+                uint16*       pDst = pDstCounterData + (static_cast<size_t>(counter) * numSamples) + firstSample;
+
+                for (uint32 sample = 0; sample < numTileSamples; sample++)
+                {
+                    pDst[sample] = pSrc[sample * SampleSizeInWords];
+                }
+            }
+        }
+
+        PAL_SAFE_FREE(pTile, m_pAllocator);
+    }
 
     return result;
 }
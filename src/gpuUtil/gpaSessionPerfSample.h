@@ -195,6 +195,10 @@ public:
 private:
     static const Pal::uint32 MaxNumCountersPerBitline = 16;
 
+    // Size of the cached staging tile used to transpose the SPM ring. Small enough to stay resident in the L1/L2 caches
+    // while a block of samples is transposed.
+    static const Pal::uint32 SpmTransposeTileSizeInBytes = 16 * 1024;
+
     Pal::uint32 CountNumSamples(void* pBufferStart);
 
     // Common trace specific memory properties.
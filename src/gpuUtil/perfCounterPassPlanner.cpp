@@ -0,0 +1,269 @@
+/*
+ ***********************************************************************************************************************
+ *
+ *  Copyright (c) 2016-2020 Advanced Micro Devices, Inc. All Rights Reserved.
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy
+ *  of this software and associated documentation files (the "Software"), to deal
+ *  in the Software without restriction, including without limitation the rights
+ *  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *  copies of the Software, and to permit persons to whom the Software is
+ *  furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in all
+ *  copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ *  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *  SOFTWARE.
+ *
+ **********************************************************************************************************************/
+
+#include "palPerfCounterPassPlanner.h"
+#include "palInlineFuncs.h"
+#include "palSysMemory.h"
+
+using namespace Pal;
+
+namespace GpuUtil
+{
+
+// =====================================================================================================================
+PerfCounterPassPlanner::PerfCounterPassPlanner(
+    IPlatform* pPlatform)
+    :
+    m_pPlatform(pPlatform),
+    m_numCounters(0),
+    m_numPasses(0),
+    m_pPassCounters(nullptr),
+    m_pPassOffsets(nullptr),
+    m_pOriginalIndex(nullptr),
+    m_pCounterPass(nullptr)
+{
+}
+
+// =====================================================================================================================
+PerfCounterPassPlanner::~PerfCounterPassPlanner()
+{
+    FreePlan();
+}
+
+// =====================================================================================================================
+void PerfCounterPassPlanner::FreePlan()
+{
+    // All plan arrays live in the allocation which starts with the pass counters.
+    PAL_SAFE_FREE(m_pPassCounters, m_pPlatform);
+
+    m_numCounters    = 0;
+    m_numPasses      = 0;
+    m_pPassOffsets   = nullptr;
+    m_pOriginalIndex = nullptr;
+    m_pCounterPass   = nullptr;
+}
+
+// =====================================================================================================================
+// Every block instance can sample a fixed number of counters at once, so the n-th counter which the client asks of a
+// block instance simply goes into pass n / limit. This never needs more passes than the most oversubscribed instance
+// dictates, which is the lower bound for any plan.
+Result PerfCounterPassPlanner::Plan(
+    const PerfExperimentProperties& properties,
+    PerfCounterType                 counterType,
+    uint32                          numCounters,
+    const PerfCounterId*            pCounters)
+{
+    FreePlan();
+
+    Result result = ((numCounters > 0) && (pCounters == nullptr)) ? Result::ErrorInvalidPointer : Result::Success;
+
+    // Each block instance gets one usage counter; find where each block's counters start.
+    uint32 blockBase[static_cast<uint32>(GpuBlock::Count)] = {};
+    uint32 numSlots = 0;
+
+    for (uint32 block = 0; block < static_cast<uint32>(GpuBlock::Count); ++block)
+    {
+        blockBase[block] = numSlots;
+        numSlots        += properties.blocks[block].instanceCount;
+    }
+
+    uint32* pSlotUsage = nullptr;
+
+    if ((result == Result::Success) && (numCounters > 0))
+    {
+        pSlotUsage = static_cast<uint32*>(PAL_CALLOC(sizeof(uint32) * Util::Max(numSlots, 1u),
+                                                     m_pPlatform,
+                                                     Util::SystemAllocType::AllocInternalTemp));
+
+        const size_t planSize = (sizeof(PerfCounterId) * numCounters) + // m_pPassCounters
+                                (sizeof(uint32) * numCounters)        + // m_pOriginalIndex
+                                (sizeof(uint32) * numCounters)        + // m_pCounterPass
+                                (sizeof(uint32) * (numCounters + 1));   // m_pPassOffsets, at most one pass per counter
+
+        m_pPassCounters = static_cast<PerfCounterId*>(PAL_MALLOC(planSize,
+                                                                 m_pPlatform,
+                                                                 Util::SystemAllocType::AllocInternal));
+
+        if ((pSlotUsage == nullptr) || (m_pPassCounters == nullptr))
+        {
+            result = Result::ErrorOutOfMemory;
+        }
+        else
+        {
+            m_pOriginalIndex = reinterpret_cast<uint32*>(m_pPassCounters + numCounters);
+            m_pCounterPass   = m_pOriginalIndex + numCounters;
+            m_pPassOffsets   = m_pCounterPass + numCounters;
+        }
+    }
+
+    for (uint32 idx = 0; (result == Result::Success) && (idx < numCounters); ++idx)
+    {
+        const PerfCounterId&          counter    = pCounters[idx];
+        const uint32                  blockIdx   = static_cast<uint32>(counter.block);
+        const GpuBlockPerfProperties* pBlockInfo = (blockIdx < static_cast<uint32>(GpuBlock::Count))
+                                                   ? &properties.blocks[blockIdx]
+                                                   : nullptr;
+
+        // The maximum number of counters depends on whether they are streamed or globally sampled.
+        uint32 maxCounters = 0;
+
+        if (pBlockInfo != nullptr)
+        {
+            maxCounters = (counterType == PerfCounterType::Spm) ? pBlockInfo->maxSpmCounters
+                                                                : pBlockInfo->maxGlobalSharedCounters;
+        }
+
+        if ((pBlockInfo == nullptr)                          ||
+            (pBlockInfo->available == false)                ||
+            (counter.instance >= pBlockInfo->instanceCount)  ||
+            (counter.eventId > pBlockInfo->maxEventId)       ||
+            (maxCounters == 0))
+        {
+            result = Result::ErrorInvalidValue;
+        }
+        else
+        {
+            // All DF instances share the same set of global block counters.
+            const uint32 instance = (counter.block == GpuBlock::DfMall) ? 0 : counter.instance;
+            const uint32 pass     = pSlotUsage[blockBase[blockIdx] + instance]++ / maxCounters;
+
+            m_pCounterPass[idx] = pass;
+            m_numPasses         = Util::Max(m_numPasses, pass + 1);
+        }
+    }
+
+    if ((result == Result::Success) && (numCounters > 0))
+    {
+        // Counting sort by pass, which keeps the client's order within each pass.
+        memset(m_pPassOffsets, 0, sizeof(uint32) * (m_numPasses + 1));
+
+        for (uint32 idx = 0; idx < numCounters; ++idx)
+        {
+            m_pPassOffsets[m_pCounterPass[idx] + 1]++;
+        }
+
+        for (uint32 pass = 0; pass < m_numPasses; ++pass)
+        {
+            m_pPassOffsets[pass + 1] += m_pPassOffsets[pass];
+        }
+
+        // Use the counting slots of the pass offsets as insertion cursors, then shift them back into place.
+        for (uint32 idx = 0; idx < numCounters; ++idx)
+        {
+            const uint32 pos = m_pPassOffsets[m_pCounterPass[idx]]++;
+
+            m_pPassCounters[pos]  = pCounters[idx];
+            m_pOriginalIndex[pos] = idx;
+        }
+
+        for (uint32 pass = m_numPasses; pass > 0; --pass)
+        {
+            m_pPassOffsets[pass] = m_pPassOffsets[pass - 1];
+        }
+        m_pPassOffsets[0] = 0;
+
+        m_numCounters = numCounters;
+    }
+
+    PAL_SAFE_FREE(pSlotUsage, m_pPlatform);
+
+    if (result != Result::Success)
+    {
+        FreePlan();
+    }
+
+    return result;
+}
+
+// =====================================================================================================================
+const PerfCounterId* PerfCounterPassPlanner::GetPassCounters(
+    uint32  pass,
+    uint32* pNumCounters
+    ) const
+{
+    PAL_ASSERT(pass < m_numPasses);
+
+    *pNumCounters = m_pPassOffsets[pass + 1] - m_pPassOffsets[pass];
+
+    return &m_pPassCounters[m_pPassOffsets[pass]];
+}
+
+// =====================================================================================================================
+void PerfCounterPassPlanner::MergePassResults(
+    uint32        pass,
+    const uint64* pPassResults,
+    uint64*       pResults
+    ) const
+{
+    PAL_ASSERT(pass < m_numPasses);
+
+    for (uint32 pos = m_pPassOffsets[pass]; pos < m_pPassOffsets[pass + 1]; ++pos)
+    {
+        pResults[m_pOriginalIndex[pos]] = pPassResults[pos - m_pPassOffsets[pass]];
+    }
+}
+
+// =====================================================================================================================
+Result PerfCounterPassPlanner::GetResults(
+    const GpaSession& session,
+    const uint32*     pSampleIds,
+    uint64*           pResults
+    ) const
+{
+    Result result = Result::Success;
+
+    // Holds the results of one pass; no pass has more counters than the whole plan.
+    uint64* pScratch = nullptr;
+
+    if (m_numCounters > 0)
+    {
+        pScratch = static_cast<uint64*>(PAL_MALLOC(sizeof(uint64) * m_numCounters,
+                                                   m_pPlatform,
+                                                   Util::SystemAllocType::AllocInternalTemp));
+
+        if (pScratch == nullptr)
+        {
+            result = Result::ErrorOutOfMemory;
+        }
+    }
+
+    for (uint32 pass = 0; (result == Result::Success) && (pass < m_numPasses); ++pass)
+    {
+        size_t size = sizeof(uint64) * (m_pPassOffsets[pass + 1] - m_pPassOffsets[pass]);
+
+        result = session.GetResults(pSampleIds[pass], &size, pScratch);
+
+        if (result == Result::Success)
+        {
+            MergePassResults(pass, pScratch, pResults);
+        }
+    }
+
+    PAL_SAFE_FREE(pScratch, m_pPlatform);
+
+    return result;
+}
+
+} // GpuUtil
@@ -275,6 +275,19 @@ void* AtomicExchangePointer(
     return __sync_lock_test_and_set(ppTarget, pValue);
 }
 
+// =====================================================================================================================
+// Thread-safe method to compare and swap two pointer values.
+// Returns the value at (*ppTarget) before this method was called.
+void* AtomicCompareAndSwapPointer(
+    void*volatile* ppTarget,
+    void*          pOld,
+    void*          pNew)
+{
+    PAL_ASSERT(IsPow2Aligned(reinterpret_cast<size_t>(ppTarget), sizeof(void*)));
+
+    return __sync_val_compare_and_swap(ppTarget, pOld, pNew);
+}
+
 // =====================================================================================================================
 // Atomically add two 32-bit integers, returning the result of the addition.
 uint32 AtomicAdd(
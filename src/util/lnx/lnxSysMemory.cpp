@@ -24,7 +24,9 @@
  **********************************************************************************************************************/
 
 #include "palSysMemory.h"
+#include <cstdio>
 #include <cstdlib>
+#include <cstring>
 #include <unistd.h>
 #include <sys/mman.h>
 
@@ -80,6 +82,92 @@ size_t VirtualPageSize()
     return sysconf(_SC_PAGESIZE);
 }
 
+// =====================================================================================================================
+// Returns the size of a transparent huge page, or zero if transparent huge pages are disabled.
+static size_t QueryHugePageSize()
+{
+    size_t hugePageSize = 0;
+    char   buffer[64]   = {};
+
+    // The "enabled" file lists all modes with the active one in brackets. Both "always" and "madvise" let us request
+    // huge pages with madvise().
+    FILE* pFile = fopen("/sys/kernel/mm/transparent_hugepage/enabled", "r");
+    if (pFile != nullptr)
+    {
+        const bool enabled = (fgets(&buffer[0], sizeof(buffer), pFile) != nullptr) &&
+                             (strstr(&buffer[0], "[never]") == nullptr);
+        fclose(pFile);
+
+        pFile = enabled ? fopen("/sys/kernel/mm/transparent_hugepage/hpage_pmd_size", "r") : nullptr;
+        if (pFile != nullptr)
+        {
+            if (fgets(&buffer[0], sizeof(buffer), pFile) != nullptr)
+            {
+                hugePageSize = static_cast<size_t>(strtoull(&buffer[0], nullptr, 10));
+            }
+            fclose(pFile);
+        }
+    }
+
+    return hugePageSize;
+}
+
+// =====================================================================================================================
+// Returns the size of the huge pages which the OS can transparently back virtual memory with.
+size_t VirtualHugePageSize()
+{
+    // The sysfs files are read once; changing the transparent huge page mode at runtime isn't picked up.
+    static const size_t HugePageSize = QueryHugePageSize();
+
+    return HugePageSize;
+}
+
+// =====================================================================================================================
+// Faults in the specified range of committed memory, optionally asking for it to be backed by huge pages first.
+Result VirtualPrefault(
+    void*  pMem,
+    size_t sizeInBytes,
+    bool   useHugePages)
+{
+    Result result = Result::Success;
+
+    if (sizeInBytes == 0)
+    {
+        result = Result::ErrorInvalidValue;
+    }
+    else if (pMem == nullptr)
+    {
+        result = Result::ErrorInvalidPointer;
+    }
+    else
+    {
+        if (useHugePages && ((VirtualHugePageSize() == 0) || (madvise(pMem, sizeInBytes, MADV_HUGEPAGE) != 0)))
+        {
+            result = Result::Unsupported;
+        }
+
+        bool populated = false;
+#if defined(MADV_POPULATE_WRITE)
+        populated = (madvise(pMem, sizeInBytes, MADV_POPULATE_WRITE) == 0);
+#endif
+
+        if (populated == false)
+        {
+            // Older kernels can't populate page tables on request, so touch one byte per page instead. The byte is
+            // written back unchanged to fault the page in writable without modifying the memory.
+            volatile uint8*const pBytes   = static_cast<volatile uint8*>(pMem);
+            const size_t         pageSize = VirtualPageSize();
+
+            for (size_t offset = 0; offset < sizeInBytes; offset += pageSize)
+            {
+                pBytes[offset] = pBytes[offset];
+            }
+        }
+    }
+
+    return result;
+}
+
 // =====================================================================================================================
 // Reserves the specified amount of virtual address space.
 Result VirtualReserve(
@@ -100,12 +188,35 @@ Result VirtualReserve(
         result = Result::ErrorInvalidPointer;
     }
 
+    // mmap only aligns to the page size, so larger alignments are handled by over-reserving and trimming the excess.
+    const size_t pageSize = VirtualPageSize();
+    const size_t extraBytes = ((pMem == nullptr) && (alignment > pageSize)) ? alignment : 0;
+
     if (result == Result::Success)
     {
-        void* pMemory = mmap(pMem, sizeInBytes, PROT_NONE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+        void* pMemory = mmap(pMem, sizeInBytes + extraBytes, PROT_NONE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
 
         if ((pMemory != nullptr) && (pMemory != MAP_FAILED))
         {
+            if (extraBytes > 0)
+            {
+                void*const   pAligned  = VoidPtrAlign(pMemory, alignment);
+                const size_t headBytes = VoidPtrDiff(pAligned, pMemory);
+                const size_t tailBytes = extraBytes - headBytes;
+
+                if (headBytes > 0)
+                {
+                    munmap(pMemory, headBytes);
+                }
+
+                if (tailBytes > 0)
+                {
+                    munmap(VoidPtrInc(pAligned, sizeInBytes), tailBytes);
+                }
+
+                pMemory = pAligned;
+            }
+
             PAL_ASSERT(ppOut != nullptr);
             (*ppOut) = pMemory;
         }
@@ -207,6 +207,15 @@ void* GetThreadLocalValue(
     return pthread_getspecific(key);
 }
 
+// =====================================================================================================================
+// Returns an identifier for the calling thread.
+uint64 GetIdOfCurrentThread()
+{
+    static_assert(sizeof(pthread_t) <= sizeof(uint64), "pthread_t does not fit in a uint64.");
+
+    return static_cast<uint64>(pthread_self());
+}
+
 // =====================================================================================================================
 // Sets the value that the current thread has associated with the given key.
 Result SetThreadLocalValue(
@@ -40,6 +40,12 @@ namespace Util
 namespace Abi
 {
 
+// =====================================================================================================================
+PipelineAbiReader::~PipelineAbiReader()
+{
+    PAL_SAFE_DELETE(m_pSymbolsMap, &m_allocator);
+}
+
 // =====================================================================================================================
 Result PipelineAbiReader::Init()
 {
@@ -55,12 +61,19 @@ Result PipelineAbiReader::Init()
     if (result == Result::Success)
     {
         memset(&m_pipelineSymbols, 0, sizeof(m_pipelineSymbols));
-        result = m_genericSymbolsMap.Init();
+
+        // The section headers are only walked once the ELF has been validated above. The index is rebuilt from
+        // scratch if Init() is called again.
+        PAL_SAFE_DELETE(m_pSymbolsMap, &m_allocator);
+        m_pSymbolsMap = PAL_NEW(SymbolMap, &m_allocator, AllocInternal)(Max(16u, CountSymbols(m_elfReader) / 4),
+                                                                         &m_allocator);
+        result = (m_pSymbolsMap != nullptr) ? m_pSymbolsMap->Init() : Result::ErrorOutOfMemory;
     }
 
     if (result == Result::Success)
     {
-        // Cache symbols so we don't have to search them when looking up
+        // Cache symbols so we don't have to search them when looking up. Each symbol costs one hash insertion, which
+        // keeps this linear in the symbol count even for code objects which export many functions.
         for (ElfReader::SectionId sectionIndex = 0; sectionIndex < m_elfReader.GetNumSections(); sectionIndex++)
         {
             if (m_elfReader.GetSectionType(sectionIndex) != ElfReader::SectionHeaderType::SymTab)
@@ -76,21 +89,17 @@ Result PipelineAbiReader::Init()
                     continue;
                 }
 
-                const char* pName = symbols.GetSymbolName(symbolIndex);
-                PipelineSymbolType pipelineSymbolType = GetSymbolTypeFromName(pName);
-
-                if (pipelineSymbolType != PipelineSymbolType::Unknown)
-                {
-                    m_pipelineSymbols[static_cast<uint32>(pipelineSymbolType)] = {sectionIndex, symbolIndex};
-                }
-                else
+                // Later definitions of a name replace earlier ones, matching the linear search this index replaced.
+                bool         existed = false;
+                SymbolEntry* pEntry  = nullptr;
+                result = m_pSymbolsMap->FindAllocate(symbols.GetSymbolName(symbolIndex), &existed, &pEntry);
+                if (result != Result::Success)
                 {
-                    result = m_genericSymbolsMap.Insert(pName, {sectionIndex, symbolIndex});
-                    if (result != Result::Success)
-                    {
-                        break;
-                    }
+                    break;
                 }
+
+                pEntry->m_section = sectionIndex;
+                pEntry->m_index   = symbolIndex;
             }
             if (result != Result::Success)
             {
@@ -99,9 +108,46 @@ Result PipelineAbiReader::Init()
         }
     }
 
+    if (result == Result::Success)
+    {
+        // Resolve the pipeline ABI symbols through the index rather than comparing every symbol name against every
+        // pipeline ABI symbol name.
+        for (uint32 type = 0; type < static_cast<uint32>(PipelineSymbolType::Count); type++)
+        {
+            if (type == static_cast<uint32>(PipelineSymbolType::Unknown))
+            {
+                continue;
+            }
+
+            const SymbolEntry*const pSymbolEntry = m_pSymbolsMap->FindKey(PipelineAbiSymbolNameStrings[type]);
+            if (pSymbolEntry != nullptr)
+            {
+                m_pipelineSymbols[type] = *pSymbolEntry;
+            }
+        }
+    }
+
     return result;
 }
 
+// =====================================================================================================================
+// Counts the symbols of all symbol tables in the given ELF, used to size the symbol index up front.
+uint32 PipelineAbiReader::CountSymbols(
+    const ElfReader::Reader& elfReader)
+{
+    uint32 numSymbols = 0;
+
+    for (ElfReader::SectionId sectionIndex = 0; sectionIndex < elfReader.GetNumSections(); sectionIndex++)
+    {
+        if (elfReader.GetSectionType(sectionIndex) == ElfReader::SectionHeaderType::SymTab)
+        {
+            numSymbols += ElfReader::Symbols(elfReader, sectionIndex).GetNumSymbols();
+        }
+    }
+
+    return numSymbols;
+}
+
 // =====================================================================================================================
 Result PipelineAbiReader::GetMetadata(
     MsgPackReader*         pReader,
@@ -208,7 +254,7 @@ const Elf::SymbolTableEntry* PipelineAbiReader::GetGenericSymbol(
 {
     PAL_ASSERT(pName != nullptr);
 
-    const SymbolEntry*const pSymbolEntry = m_genericSymbolsMap.FindKey(pName);
+    const SymbolEntry*const pSymbolEntry = (m_pSymbolsMap != nullptr) ? m_pSymbolsMap->FindKey(pName) : nullptr;
 
     const Elf::SymbolTableEntry* pSymbol = nullptr;
     if (pSymbolEntry != nullptr)
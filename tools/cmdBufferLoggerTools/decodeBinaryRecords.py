@@ -0,0 +1,175 @@
+##
+ #######################################################################################################################
+ #
+ #  Copyright (c) 2020 Advanced Micro Devices, Inc. All Rights Reserved.
+ #
+ #  Permission is hereby granted, free of charge, to any person obtaining a copy
+ #  of this software and associated documentation files (the "Software"), to deal
+ #  in the Software without restriction, including without limitation the rights
+ #  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ #  copies of the Software, and to permit persons to whom the Software is
+ #  furnished to do so, subject to the following conditions:
+ #
+ #  The above copyright notice and this permission notice shall be included in all
+ #  copies or substantial portions of the Software.
+ #
+ #  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ #  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ #  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ #  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ #  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ #  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ #  SOFTWARE.
+ #
+ #######################################################################################################################
+
+# Decodes the BinaryRecords written by the CmdBufferLogger layer when its binaryRecords annotation is set.
+#
+# The layer writes one fixed-size record per annotated call into a NOP packet payload instead of formatting comment
+# strings. Calls without a record encoding, or whose arguments don't fit into a record, still write their comment
+# strings. This script scans a binary dump of the command stream for the records and prints the text the layer would
+# have written as comment strings, one annotation per line.
+#
+# Usage: decodeBinaryRecords.py <command buffer dump> [functionIds.h] [client interface major version]
+#
+# The call names are read from the CmdBufCallIdStrings table in functionIds.h so they always match the layer. The
+# interface version must match the one the driver was built with because it selects entries in that table.
+
+import os
+import re
+import struct
+import sys
+
+BinaryRecordSignature = 0x524C4243
+BinaryRecordMaxArgs   = 10
+BinaryRecordDwords    = 2 + BinaryRecordMaxArgs
+
+DefaultFunctionIds       = os.path.join(os.path.dirname(os.path.abspath(__file__)),
+                                        "..", "..", "src", "core", "layers", "functionIds.h")
+DefaultInterfaceVersion  = 0xFFFFFFFF
+
+# Returns the CmdBufCallIdStrings table, evaluating the interface version checks found inside of it.
+def ReadCallNames(path, interfaceVersion):
+    with open(path, "r") as functionIds:
+        text = functionIds.read()
+
+    table = re.search(r"CmdBufCallIdStrings\[\]\s*=\s*\{(.*?)\};", text, re.DOTALL)
+    if table is None:
+        sys.exit("Can't find CmdBufCallIdStrings in " + path)
+
+    names  = []
+    active = [True]
+    for line in table.group(1).splitlines():
+        line = line.strip()
+        check = re.match(r"#if\s+PAL_CLIENT_INTERFACE_MAJOR_VERSION\s*(>=|<)\s*(\d+)", line)
+        if check is not None:
+            version = int(check.group(2))
+            taken   = (interfaceVersion >= version) if (check.group(1) == ">=") else (interfaceVersion < version)
+            active.append(active[-1] and taken)
+        elif line.startswith("#else"):
+            taken = not active.pop()
+            active.append(active[-1] and taken)
+        elif line.startswith("#endif"):
+            active.pop()
+        elif line.startswith("\"") and active[-1]:
+            names.append(line.split("\"")[1])
+    return names
+
+def Hex64(args, index):
+    return (args[index + 1] << 32) | args[index]
+
+def DecodeBindPipeline(args):
+    lines = ["PipelineBindPoint = " + ("PipelineBindPoint::Compute" if args[0] == 0 else "PipelineBindPoint::Graphics")]
+    if args[1] != 0:
+        lines.append("PipelineStableHash      = 0x%016X" % Hex64(args, 2))
+        lines.append("PipelineUniqueHash      = 0x%016X" % Hex64(args, 4))
+        lines.append("PipelineApiPsoHash      = 0x%016X" % Hex64(args, 6))
+    else:
+        lines.append("Pipeline = Null")
+    return lines
+
+def DecodeSetUserData(args):
+    lines = ["User Data Type = " + ("Compute" if args[0] == 0 else "Graphics"),
+             "First Entry    = %u" % args[1],
+             "Entry Count    = %u" % args[2],
+             "Entries:"]
+    values = args[3:]
+    for first in range(0, len(values), 4):
+        lines.append("\t" + "".join("0x%08X " % value for value in values[first:first + 4]))
+    return lines
+
+def DecodeDraw(args):
+    return ["First Vertex   = 0x%08x" % args[0],
+            "Vertex Count   = 0x%08x" % args[1],
+            "First Instance = 0x%08x" % args[2],
+            "Instance Count = 0x%08x" % args[3],
+            "Draw Id = 0x%08x"        % args[4]]
+
+def DecodeDrawIndexed(args):
+    return ["First Index    = 0x%08x" % args[0],
+            "Index Count    = 0x%08x" % args[1],
+            "Vertex Offset  = 0x%08x" % args[2],
+            "First Instance = 0x%08x" % args[3],
+            "Instance Count = 0x%08x" % args[4],
+            "Draw Id = 0x%08x"        % args[5]]
+
+def DecodeDispatch(args):
+    return ["XDim = 0x%08x" % args[0],
+            "YDim = 0x%08x" % args[1],
+            "ZDim = 0x%08x" % args[2]]
+
+def DecodeBarrier(args):
+    # Barriers with pipe points, events, targets or transitions are annotated with text, so all of the lists are empty.
+    return ["BarrierInfo:",
+            "barrierInfo.flags = 0x%0X"                     % args[0],
+            "barrierInfo.waitPoint = 0x%X"                  % args[1],
+            "barrierInfo.pipePointWaitCount = %u"           % args[2],
+            "barrierInfo.gpuEventWaitCount = %u"            % args[3],
+            "barrierInfo.rangeCheckedTargetWaitCount = %u"  % args[4],
+            "barrierInfo.transitionCount = %u"              % args[5],
+            "barrierInfo.globalSrcCacheMask = 0x%08X"       % args[6],
+            "barrierInfo.globalDstCacheMask = 0x%08X"       % args[7],
+            "barrierInfo.reason = 0x%08X"                   % args[8]]
+
+# Maps call names to the functions which decode their packed arguments. Records of other calls carry no arguments.
+Decoders = {
+    "CmdBindPipeline()" : DecodeBindPipeline,
+    "CmdSetUserData()"  : DecodeSetUserData,
+    "CmdDraw()"         : DecodeDraw,
+    "CmdDrawIndexed()"  : DecodeDrawIndexed,
+    "CmdDispatch()"     : DecodeDispatch,
+    "CmdBarrier()"      : DecodeBarrier,
+}
+
+def DecodeRecords(data, names):
+    dwordCount = len(data) // 4
+    dwords     = struct.unpack("<%uI" % dwordCount, data[:dwordCount * 4])
+
+    index = 0
+    while index + BinaryRecordDwords <= dwordCount:
+        if dwords[index] == BinaryRecordSignature:
+            callId   = dwords[index + 1] & 0xFFFF
+            argCount = dwords[index + 1] >> 16
+            if (callId < len(names)) and (argCount <= BinaryRecordMaxArgs):
+                args = list(dwords[index + 2:index + 2 + argCount])
+                print(names[callId])
+                decoder = Decoders.get(names[callId])
+                if (decoder is not None) and (argCount > 0):
+                    for line in decoder(args):
+                        print(line)
+                index += BinaryRecordDwords
+                continue
+        index += 1
+
+def main():
+    if len(sys.argv) < 2:
+        sys.exit("Usage: decodeBinaryRecords.py <command buffer dump> [functionIds.h] [interface major version]")
+
+    functionIds      = sys.argv[2] if len(sys.argv) > 2 else DefaultFunctionIds
+    interfaceVersion = int(sys.argv[3]) if len(sys.argv) > 3 else DefaultInterfaceVersion
+
+    with open(sys.argv[1], "rb") as dump:
+        DecodeRecords(dump.read(), ReadCallNames(functionIds, interfaceVersion))
+
+if __name__ == "__main__":
+    main()
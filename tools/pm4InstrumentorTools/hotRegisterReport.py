@@ -0,0 +1,111 @@
+##
+ #######################################################################################################################
+ #
+ #  Copyright (c) 2020 Advanced Micro Devices, Inc. All Rights Reserved.
+ #
+ #  Permission is hereby granted, free of charge, to any person obtaining a copy
+ #  of this software and associated documentation files (the "Software"), to deal
+ #  in the Software without restriction, including without limitation the rights
+ #  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ #  copies of the Software, and to permit persons to whom the Software is
+ #  furnished to do so, subject to the following conditions:
+ #
+ #  The above copyright notice and this permission notice shall be included in all
+ #  copies or substantial portions of the Software.
+ #
+ #  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ #  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ #  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ #  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ #  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ #  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ #  SOFTWARE.
+ #
+ #######################################################################################################################
+
+
+# Prints a summary of the .json statistics file the Pm4Instrumentor layer writes next to each queue's .csv log.
+#
+# Usage: hotRegisterReport.py <pm4 instrumentor .json file> [number of rows per table]
+#
+# File format (version 1). All register addresses are dword offsets into register space.
+#   {
+#     "version"      : 1,
+#     "queueType"    : <string>,   Type of the queue the statistics were gathered on.
+#     "frames"       : <uint>,     Number of frames presented when the file was written.
+#     "cmdBufCount"  : <uint>,     Number of command buffers submitted on the queue.
+#     "shRegisters"  : [ <register>, ... ],
+#     "ctxRegisters" : [ <register>, ... ],
+#     "pipelines"    : [ <pipeline>, ... ]
+#   }
+#
+#   <register> = {
+#     "addr"           : <uint>,   Register address. Only registers which were written at least once are listed.
+#     "total"          : <uint>,   Number of times the register was written before PM4 optimization.
+#     "kept"           : <uint>,   Number of those writes which the PM4 optimizer kept.
+#     "redundantRatio" : <float>,  Fraction of the writes which the PM4 optimizer removed.
+#     "rollCauses"     : <uint>    ctxRegisters only: number of times this register was the first context register
+#                                  written since the previous draw, i.e. the write which caused the context roll.
+#   }
+#
+#   <pipeline> = {
+#     "hash"           : <string>, Stable internal pipeline hash as a hex string.
+#     "bindPoint"      : <string>, "Compute" or "Graphics".
+#     "calls"          : <uint>,   Number of draws or dispatches issued with the pipeline bound.
+#     "userDataBytes"  : <uint>,   PM4 bytes written validating user-data (SH register churn) for those calls.
+#     "pipelineBytes"  : <uint>,   PM4 bytes written binding the pipeline for those calls.
+#   }
+
+import json
+import sys
+
+DefaultRowCount = 20
+
+def PrintRegisters(title, registers, sortKey, rowCount):
+    print(title)
+    print("  %-8s %12s %12s %10s %12s" % ("Addr", "Total", "Kept", "Redundant", "RollCauses"))
+    for register in sorted(registers, key=sortKey, reverse=True)[:rowCount]:
+        print("  0x%04X   %12u %12u %9.1f%% %12s" % (register["addr"],
+                                                    register["total"],
+                                                    register["kept"],
+                                                    register["redundantRatio"] * 100.0,
+                                                    register.get("rollCauses", "-")))
+    print("")
+
+def PrintPipelines(pipelines, rowCount):
+    print("Pipelines by user-data bytes")
+    print("  %-18s %-8s %10s %14s %14s %10s" %
+          ("Hash", "BindPt", "Calls", "UserDataBytes", "PipelineBytes", "Bytes/Call"))
+    for pipeline in sorted(pipelines, key=lambda p: p["userDataBytes"], reverse=True)[:rowCount]:
+        perCall = pipeline["userDataBytes"] / pipeline["calls"] if pipeline["calls"] > 0 else 0.0
+        print("  %-18s %-8s %10u %14u %14u %10.1f" % (pipeline["hash"],
+                                                      pipeline["bindPoint"],
+                                                      pipeline["calls"],
+                                                      pipeline["userDataBytes"],
+                                                      pipeline["pipelineBytes"],
+                                                      perCall))
+    print("")
+
+def main():
+    if len(sys.argv) < 2:
+        sys.exit("Usage: hotRegisterReport.py <pm4 instrumentor .json file> [number of rows per table]")
+
+    rowCount = int(sys.argv[2]) if len(sys.argv) > 2 else DefaultRowCount
+
+    with open(sys.argv[1], "r") as jsonFile:
+        stats = json.load(jsonFile)
+
+    if stats.get("version") != 1:
+        sys.exit("Unsupported file version: " + str(stats.get("version")))
+
+    print("Queue %s: %u frames, %u command buffers\n" % (stats["queueType"], stats["frames"], stats["cmdBufCount"]))
+
+    redundantSets = lambda r: r["total"] - r["kept"]
+    PrintRegisters("SH registers by redundant writes",      stats["shRegisters"],  redundantSets, rowCount)
+    PrintRegisters("Context registers by redundant writes", stats["ctxRegisters"], redundantSets, rowCount)
+    PrintRegisters("Context registers by context rolls caused",
+                   stats["ctxRegisters"], lambda r: r["rollCauses"], rowCount)
+    PrintPipelines(stats["pipelines"], rowCount)
+
+if __name__ == "__main__":
+    main()